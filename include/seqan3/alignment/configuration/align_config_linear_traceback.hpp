@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_traceback configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::detail
+{
+//!\brief The number of cells above which the traceback is computed in linear memory if not configured otherwise.
+//!\ingroup alignment_configuration
+inline constexpr uint64_t default_linear_traceback_threshold{uint64_t{1} << 30};
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+/*!\brief Sets the size of the dynamic programming matrix above which the traceback is computed in linear memory.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Computing the alignment or the front coordinate of an unbanded alignment requires a traceback through the dynamic
+ * programming matrix. By default, one trace direction is stored for every cell of the matrix, which needs
+ * \f$ O(N*M) \f$ memory. If the matrix has more cells than the value of this configuration, the traceback is instead
+ * computed with the divide and conquer algorithm of Myers and Miller in \f$ O(N+M) \f$ memory at the cost of roughly
+ * doubling the runtime. A value of `0` always uses the linear memory traceback.
+ *
+ * If this configuration is not given, the linear memory traceback is used for matrices with more than
+ * \f$ 2^{30} \f$ cells.
+ * The configuration has no effect if only the score or the back coordinate is computed and it cannot be combined with
+ * seqan3::align_cfg::band.
+ *
+ * If several optimal alignments exist, the linear memory traceback might return a different, but equally scored
+ * alignment than the traceback over the full matrix.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/alignment/configuration/align_cfg_linear_traceback_example.cpp example
+ */
+struct linear_traceback : public pipeable_config_element<linear_traceback, uint64_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::linear_traceback};
+};
+
+} // namespace seqan3::align_cfg
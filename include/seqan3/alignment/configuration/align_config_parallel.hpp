@@ -0,0 +1,41 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::parallel configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Enables the parallel execution of the pairwise alignments.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this configuration is given, the sequence pairs passed to seqan3::align_pairwise are distributed over the given
+ * number of threads. A value of `0` uses as many threads as the hardware supports.
+ * The threads fetch the next sequence pair as soon as they become idle, such that pairs of very different lengths
+ * do not leave the other threads waiting. The results of the returned seqan3::alignment_range are still ordered
+ * like the input sequence pairs.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/alignment/configuration/align_cfg_parallel_example.cpp example
+ */
+struct parallel : public pipeable_config_element<parallel, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::parallel};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::vectorise configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief The configuration element type for seqan3::align_cfg::vectorise.
+ * \ingroup alignment_configuration
+ */
+struct vectorise_tag : public pipeable_config_element<vectorise_tag, bool>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::vectorise};
+};
+
+/*!\brief Enables the inter-sequence vectorised alignment computation.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this configuration is given, seqan3::align_pairwise packs several sequence pairs into the lanes of a
+ * seqan3::simd::simd_type and computes their alignments simultaneously. The number of packed pairs depends on the
+ * instruction set of the target machine and on the score range required for the respective pairs: The algorithm uses
+ * 8 bit lanes whenever the maximal possible score fits into them and falls back to 16 bit or 32 bit lanes otherwise.
+ * Hence, the results are always the same as for the scalar computation.
+ *
+ * The vectorised alignment is available for \ref seqan3::global_alignment "global" and
+ * \ref seqan3::local_alignment "local" alignments with affine gap costs, where only the score is computed.
+ * It cannot be combined with seqan3::align_cfg::band or seqan3::align_cfg::max_error. Using it with free end-gaps or
+ * with a result configuration other than seqan3::with_score throws seqan3::invalid_alignment_configuration.
+ * The vectorised computation can be combined with seqan3::align_cfg::parallel.
+ *
+ * If the configuration computes the \ref seqan3::align_cfg::edit "edit distance", the bit-parallel algorithm of
+ * Myers is vectorised instead, i.e. every lane holds the bit-vectors of one second sequence. This is in particular
+ * efficient if many short sequences are aligned against the same first sequence, e.g. when verifying reads against
+ * a candidate region. In this case free end-gaps in the first sequence are supported, and the
+ * seqan3::with_back_coordinate can be computed in addition to the score.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/alignment/configuration/align_cfg_vectorise_example.cpp example
+ */
+inline constexpr vectorise_tag vectorise{true};
+
+} // namespace seqan3::align_cfg
@@ -91,7 +91,9 @@ namespace seqan3
  * | front coordinate | \f$ O(N^2/w) \f$  | \f$ O(N^2/w) \f$ |
  * | alignment        | \f$ O(N^2/w) \f$  | \f$ O(N^2/w) \f$ |
  *
- * \f$ w \f$ is the size of a machine word.
+ * \f$ w \f$ is the size of a machine word. If the edit distance is combined with seqan3::align_cfg::band, only the
+ * band is computed, which reduces the runtime and the space of the front coordinate and the alignment to
+ * \f$ O(N*k/w) \f$, where \f$ k \f$ is the size of the band.
  *
  * For all other algorithms that compute the standard dynamic programming algorithm the following worst case holds:
  *
@@ -113,6 +115,16 @@ namespace seqan3
  *
  * \f$ k \f$ is the size of the band.
  *
+ * ### Parallel execution
+ *
+ * If the configuration contains seqan3::align_cfg::parallel, the alignments are computed concurrently by the given
+ * number of threads. The results are still returned in the order of the input sequence pairs.
+ *
+ * ### Vectorised execution
+ *
+ * If the configuration contains seqan3::align_cfg::vectorise, several sequence pairs are aligned simultaneously
+ * using SIMD instructions. See seqan3::align_cfg::vectorise for the supported configurations.
+ *
  * ### Thread safety
  *
  * This function is re-entrant, i.e. it is always safe to call in parallel with different inputs. It is thread-safe,
@@ -148,9 +160,21 @@ constexpr auto align_pairwise(sequence_t && seq, alignment_config_t const & conf
     // Configure the alignment algorithm.
     auto kernel = detail::alignment_configurator::configure<decltype(seq_view)>(config);
     // Create a two-way executor for the alignment.
-    detail::alignment_executor_two_way exec{std::move(seq_view), kernel};
-    // Return the range over the alignments.
-    return alignment_range{std::move(exec)};
+    if constexpr (alignment_config_t::template exists<align_cfg::parallel>())
+    {
+        detail::alignment_executor_two_way exec{std::move(seq_view),
+                                                kernel,
+                                                detail::execution_handler_parallel{get<align_cfg::parallel>(config)
+                                                                                       .value}};
+        // Return the range over the alignments.
+        return alignment_range{std::move(exec)};
+    }
+    else
+    {
+        detail::alignment_executor_two_way exec{std::move(seq_view), kernel};
+        // Return the range over the alignments.
+        return alignment_range{std::move(exec)};
+    }
 }
 //!\endcond
 
@@ -22,6 +22,7 @@
 #include <seqan3/alignment/pairwise/policy/affine_gap_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/linear_memory_traceback.hpp>
 #include <seqan3/alignment/scoring/gap_scheme.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_base.hpp>
 
@@ -77,6 +78,10 @@ private:
 
     //!\brief Check if the alignment is banded.
     static constexpr bool is_banded = std::remove_reference_t<config_t>::template exists<align_cfg::band>();
+    //!\brief Check if the traceback needs to be computed.
+    static constexpr bool with_traceback =
+        std::remove_reference_t<config_t>::template exists<align_cfg::result<with_front_coordinate_type>>() ||
+        std::remove_reference_t<config_t>::template exists<align_cfg::result<with_alignment_type>>();
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -124,7 +129,8 @@ public:
      * ### Complexity
      *
      * The code always runs in \f$ O(N^2) \f$ time and depending on the configuration requires at least \f$ O(N) \f$
-     * and at most \f$ O(N^2) \f$ space.
+     * and at most \f$ O(N^2) \f$ space. If the traceback is computed and the matrix exceeds the threshold configured
+     * with seqan3::align_cfg::linear_traceback, the traceback is computed in \f$ O(N) \f$ space.
      */
     template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
     auto operator()(first_range_t && first_range, second_range_t && second_range)
@@ -137,7 +143,17 @@ public:
         // ----------------------------------------------------------------------------
 
         // We need to allocate the score_matrix and maybe the trace_matrix.
-        this->allocate_matrix(first_range, second_range);
+        if constexpr (with_traceback)
+        {
+            this->allocate_matrix(first_range,
+                                  second_range,
+                                  cfg_ptr->template value_or<align_cfg::linear_traceback>(
+                                      default_linear_traceback_threshold));
+        }
+        else
+        {
+            this->allocate_matrix(first_range, second_range);
+        }
 
         // Initialise cache variables to keep frequently used variables close to the CPU registers.
         auto cache = this->make_cache(cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1},
@@ -176,7 +192,8 @@ public:
             res.back_coordinate = get<3>(cache).coordinate;
             res.front_coordinate = get<0>(compute_traceback(first_range,
                                                             second_range,
-                                                            get<3>(cache).coordinate));
+                                                            get<3>(cache).coordinate,
+                                                            cache));
         }
         if constexpr (config_t::template exists<align_cfg::result<with_alignment_type>>())
         {
@@ -184,7 +201,8 @@ public:
             res.back_coordinate = get<3>(cache).coordinate;
             std::tie(res.front_coordinate, res.alignment) = compute_traceback(first_range,
                                                                               second_range,
-                                                                              get<3>(cache).coordinate);
+                                                                              get<3>(cache).coordinate,
+                                                                              cache);
         }
         return alignment_result{res};
     }
@@ -310,7 +328,8 @@ public:
             res.front_coordinate =
                 get<0>(compute_traceback(first_range,
                                          second_range,
-                                         get<3>(cache).coordinate));
+                                         get<3>(cache).coordinate,
+                                         cache));
         }
         if constexpr (config_t::template exists<align_cfg::result<with_alignment_type>>())
         {
@@ -318,7 +337,8 @@ public:
             res.back_coordinate = this->map_banded_coordinate_to_range_position(get<3>(cache).coordinate);
             std::tie(res.front_coordinate, res.alignment) = compute_traceback(first_range,
                                                                               second_range,
-                                                                              get<3>(cache).coordinate);
+                                                                              get<3>(cache).coordinate,
+                                                                              cache);
         }
         return alignment_result{res};
     }
@@ -503,22 +523,27 @@ private:
     * \param[in] first_range    The first sequence.
     * \param[in] second_range   The second sequence.
     * \param[in] back_coordinate The back coordinate within the matrix where the traceback starts.
+    * \param[in] cache          The cache holding the gap scores the matrix was computed with.
     *
     * \details
     *
     * First parses the traceback and computes the gap segments for the sequences. Then applies the gap segments
     * to the infix of the corresponding range and return the aligned sequence.
     */
-    template <typename first_range_t, typename second_range_t>
+    template <typename first_range_t, typename second_range_t, typename cache_t>
     auto compute_traceback(first_range_t & first_range,
                            second_range_t & second_range,
-                           alignment_coordinate back_coordinate)
+                           alignment_coordinate back_coordinate,
+                           cache_t const & cache)
     {
         using first_seq_value_type = value_type_t<first_range_t>;
         using second_seq_value_type = value_type_t<second_range_t>;
 
         // Parse the traceback
-        auto [front_coordinate, first_gap_segments, second_gap_segments] = this->parse_traceback(back_coordinate);
+        auto [front_coordinate, first_gap_segments, second_gap_segments] = trace_gap_segments(first_range,
+                                                                                              second_range,
+                                                                                              back_coordinate,
+                                                                                              cache);
 
         auto fill_aligned_sequence = [](auto & aligned_sequence, auto & gap_segments, size_t const normalise)
         {
@@ -569,6 +594,54 @@ private:
         return std::tuple{front_coordinate, std::tuple{first_aligned_seq, second_aligned_seq}};
     }
 
+    /*!\brief Parses the traceback starting from the given back coordinate.
+     * \tparam    first_range_t   The type of the first sequence.
+     * \tparam    second_range_t  The type of the second sequence.
+     * \param[in] first_range     The first sequence.
+     * \param[in] second_range    The second sequence.
+     * \param[in] back_coordinate The back coordinate within the matrix where the traceback starts.
+     * \param[in] cache           The cache holding the gap scores the matrix was computed with.
+     *
+     * \details
+     *
+     * Reads the traceback from the stored trace matrix or, if the trace matrix was not stored because the matrix
+     * exceeds the seqan3::align_cfg::linear_traceback threshold, recomputes it with
+     * seqan3::detail::affine_linear_memory_traceback. The recomputation uses the score type and the gap scores of
+     * the cache, such that it scores the cells exactly like the kernel that computed the matrix.
+     */
+    template <typename first_range_t, typename second_range_t, typename cache_t>
+    auto trace_gap_segments([[maybe_unused]] first_range_t & first_range,
+                            [[maybe_unused]] second_range_t & second_range,
+                            alignment_coordinate const & back_coordinate,
+                            [[maybe_unused]] cache_t const & cache)
+    {
+        if constexpr (!is_banded)
+        {
+            if (this->use_linear_traceback)
+            {
+                using std::get;
+
+                auto const & scoring_scheme = get<align_cfg::scoring>(*cfg_ptr).value;
+                auto align_ends_cfg = cfg_ptr->template value_or<align_cfg::aligned_ends>(free_ends_none);
+                constexpr bool is_local = config_t::template exists<align_cfg::mode<detail::local_alignment_type>>();
+
+                // The cache stores the gap open score plus the gap score and the gap score in the kernel's score type.
+                using score_t = remove_cvref_t<decltype(get<2>(cache))>;
+                affine_linear_memory_traceback<remove_cvref_t<decltype(scoring_scheme)>, score_t>
+                    traceback{scoring_scheme, get<1>(cache), get<2>(cache)};
+
+                return traceback(first_range,
+                                 second_range,
+                                 back_coordinate,
+                                 is_local || align_ends_cfg[0],
+                                 is_local || align_ends_cfg[2],
+                                 is_local);
+            }
+        }
+
+        return this->parse_traceback(back_coordinate);
+    }
+
     //!\brief The alignment configuration stored on the heap.
     std::shared_ptr<config_t> cfg_ptr{};
 };
@@ -0,0 +1,395 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::alignment_algorithm_vectorised.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/policy/simd_affine_gap_policy.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/deferred_crtp_base.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the scores of many pairwise alignments using inter-sequence
+ *        vectorisation.
+ * \ingroup pairwise_alignment
+ * \tparam config_t             The configuration type; must be of type seqan3::configuration.
+ * \tparam algorithm_policies_t Template parameter pack with the policies to determine the execution of the algorithm;
+ *                              must be wrapped as seqan3::detail::deferred_crtp_base.
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::alignment_algorithm, this algorithm is not invoked with a single sequence pair but
+ * with a batch of sequence pairs. The batch is split into groups, where every sequence pair of a group is assigned
+ * to one lane of a seqan3::simd::simd_type. The sequences of a group are transposed into an inter-sequence layout,
+ * i.e. the i-th simd vector holds the ranks of the i-th letter of every sequence in the group, such that all pairs
+ * of the group are computed with the same instructions. Lanes of shorter sequences are padded; their cells
+ * outside of the respective matrix do not influence the cells inside of it.
+ *
+ * ### Score width
+ *
+ * For every group the algorithm determines the maximal absolute score that can occur within the matrices. If it fits
+ * into `int8_t` the group is computed with 8 bit lanes, otherwise with `int16_t` lanes and as last resort with
+ * `int32_t` lanes. Hence, the computation never saturates and yields the same scores as the scalar algorithm while
+ * packing as many pairs as possible into one vector.
+ *
+ * ### Scoring
+ *
+ * If both sequences have the same alphabet and the scoring scheme assigns the same score to all matches and the
+ * same score to all mismatches, the substitution scores are computed with a vectorised comparison of the ranks.
+ * Otherwise, the scores are looked up lane by lane in a precomputed substitution table.
+ */
+template <typename config_t, typename ...algorithm_policies_t>
+class alignment_algorithm_vectorised :
+    public invoke_deferred_crtp_base<algorithm_policies_t,
+                                     alignment_algorithm_vectorised<config_t, algorithm_policies_t...>>...
+{
+private:
+
+    //!\brief Check if the alignment is local.
+    static constexpr bool is_local =
+        std::remove_reference_t<config_t>::template exists<align_cfg::mode<detail::local_alignment_type>>();
+
+    //!\brief The substitution scores and meta information about the scoring scheme used by the current batch.
+    struct substitution_table
+    {
+        //!\brief The scores for every pair of ranks stored in row major order.
+        std::vector<int32_t> scores{};
+        //!\brief The alphabet size of the second sequences.
+        size_t second_alphabet_size{};
+        //!\brief Whether all matches share one score and all mismatches share another one.
+        bool is_simple{};
+        //!\brief The maximal absolute value within the table or the gap scores.
+        int64_t max_abs_score{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr alignment_algorithm_vectorised()                                                   = default; //!< Defaulted
+    constexpr alignment_algorithm_vectorised(alignment_algorithm_vectorised const &)             = default; //!< Defaulted
+    constexpr alignment_algorithm_vectorised(alignment_algorithm_vectorised &&)                  = default; //!< Defaulted
+    constexpr alignment_algorithm_vectorised & operator=(alignment_algorithm_vectorised const &) = default; //!< Defaulted
+    constexpr alignment_algorithm_vectorised & operator=(alignment_algorithm_vectorised &&)      = default; //!< Defaulted
+    ~alignment_algorithm_vectorised()                                                            = default; //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \details
+     *
+     * Maintains a copy of the configuration object on the heap using a std::shared_ptr.
+     */
+    explicit constexpr alignment_algorithm_vectorised(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
+    {}
+    //!\}
+
+    /*!\brief Computes the alignment scores of all sequence pairs in the batch.
+     * \tparam    batch_t The type of the batch; must model std::ranges::RandomAccessRange over tuples containing two
+     *                    sequences that model std::ranges::ForwardRange.
+     * \param[in] batch   The batch of sequence pairs.
+     * \returns A std::vector with one seqan3::alignment_result per sequence pair in the order of the batch.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * This function does not modify the state of the algorithm and can be called concurrently.
+     *
+     * ### Complexity
+     *
+     * \f$ O(N^2/l) \f$ time per group, where \f$ l \f$ is the number of lanes, and \f$ O(N) \f$ space.
+     */
+    template <std::ranges::RandomAccessRange batch_t>
+    auto operator()(batch_t & batch) const
+    {
+        assert(cfg_ptr != nullptr);
+
+        using std::get;
+        using first_range_t  = std::remove_reference_t<std::tuple_element_t<0, value_type_t<batch_t>>>;
+        using second_range_t = std::remove_reference_t<std::tuple_element_t<1, value_type_t<batch_t>>>;
+        using result_value_t = typename align_result_selector<first_range_t, second_range_t, config_t>::type;
+
+        std::vector<alignment_result<result_value_t>> results(std::ranges::size(batch));
+
+        substitution_table const table = make_substitution_table<value_type_t<first_range_t>,
+                                                                 value_type_t<second_range_t>>();
+
+        for (size_t group_begin = 0; group_begin < results.size();)
+        {
+            if (compute_group<int8_t, result_value_t>(batch, group_begin, results, table))
+                continue;
+            if (compute_group<int16_t, result_value_t>(batch, group_begin, results, table))
+                continue;
+
+            compute_group<int32_t, result_value_t>(batch, group_begin, results, table);
+        }
+
+        return results;
+    }
+
+private:
+
+    /*!\brief Precomputes the substitution scores for every pair of letters.
+     * \tparam first_alphabet_t  The alphabet type of the first sequences.
+     * \tparam second_alphabet_t The alphabet type of the second sequences.
+     */
+    template <typename first_alphabet_t, typename second_alphabet_t>
+    substitution_table make_substitution_table() const
+    {
+        auto const & scoring_scheme = get<align_cfg::scoring>(*cfg_ptr).value;
+        auto const & gaps = cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+
+        constexpr size_t first_size  = alphabet_size_v<first_alphabet_t>;
+        constexpr size_t second_size = alphabet_size_v<second_alphabet_t>;
+
+        substitution_table table{};
+        table.scores.resize(first_size * second_size);
+        table.second_alphabet_size = second_size;
+        table.is_simple = std::is_same_v<first_alphabet_t, second_alphabet_t>;
+
+        for (size_t r1 = 0; r1 < first_size; ++r1)
+        {
+            for (size_t r2 = 0; r2 < second_size; ++r2)
+            {
+                int32_t const score = scoring_scheme.score(assign_rank_to(r1, first_alphabet_t{}),
+                                                           assign_rank_to(r2, second_alphabet_t{}));
+                table.scores[r1 * second_size + r2] = score;
+                table.max_abs_score = std::max<int64_t>(table.max_abs_score, std::abs(score));
+            }
+        }
+
+        if constexpr (std::is_same_v<first_alphabet_t, second_alphabet_t> && first_size > 1)
+        {
+            for (size_t r1 = 0; r1 < first_size; ++r1)
+                for (size_t r2 = 0; r2 < second_size; ++r2)
+                    table.is_simple &= table.scores[r1 * second_size + r2] == ((r1 == r2) ? table.scores[0]
+                                                                                          : table.scores[1]);
+        }
+
+        table.max_abs_score = std::max<int64_t>(table.max_abs_score,
+                                                std::abs(static_cast<int64_t>(gaps.get_gap_open_score()) +
+                                                         static_cast<int64_t>(gaps.get_gap_score())));
+        table.max_abs_score = std::max<int64_t>(table.max_abs_score, std::abs(gaps.get_gap_score()));
+        return table;
+    }
+
+    /*!\brief Computes the next group of the batch if the scores fit into `score_t`.
+     * \tparam score_t        The scalar type of the simd lanes.
+     * \tparam result_value_t The type of the alignment result value.
+     * \param[in]     batch       The batch of sequence pairs.
+     * \param[in,out] group_begin The position of the first sequence pair of the group; advanced by the group size
+     *                            if the group was computed.
+     * \param[out]    results     The results of the batch.
+     * \param[in]     table       The substitution table.
+     * \returns `true` if the group was computed, `false` if `score_t` is too narrow.
+     */
+    template <typename score_t, typename result_value_t, typename batch_t, typename results_t>
+    bool compute_group(batch_t & batch,
+                       size_t & group_begin,
+                       results_t & results,
+                       substitution_table const & table) const
+    {
+        using std::get;
+        using simd_t = simd_type_t<score_t>;
+        constexpr size_t lanes = simd_traits<simd_t>::length;
+
+        size_t const group_size = std::min(lanes, results.size() - group_begin);
+
+        // ----------------------------------------------------------------------------
+        // Check that no score can exceed the lane width.
+        // ----------------------------------------------------------------------------
+
+        std::array<size_t, lanes> first_sizes{};
+        std::array<size_t, lanes> second_sizes{};
+        size_t max_first_size = 0;
+        size_t max_second_size = 0;
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            auto & [first_seq, second_seq] = batch[group_begin + lane];
+            first_sizes[lane] = static_cast<size_t>(std::ranges::distance(first_seq));
+            second_sizes[lane] = static_cast<size_t>(std::ranges::distance(second_seq));
+            max_first_size = std::max(max_first_size, first_sizes[lane]);
+            max_second_size = std::max(max_second_size, second_sizes[lane]);
+        }
+
+        if constexpr (!std::is_same_v<score_t, int32_t>) // int32_t is the scalar score type and always used last.
+        {
+            int64_t const max_score = static_cast<int64_t>(std::numeric_limits<score_t>::max());
+            int64_t const bound = static_cast<int64_t>(max_first_size + max_second_size + 2) * table.max_abs_score;
+            size_t const max_rank = std::max(table.scores.size() / std::max<size_t>(table.second_alphabet_size, 1),
+                                             table.second_alphabet_size);
+
+            if (bound > max_score || static_cast<int64_t>(max_rank) > max_score + 1)
+                return false;
+        }
+
+        // ----------------------------------------------------------------------------
+        // Transpose the sequences into the inter-sequence layout.
+        // ----------------------------------------------------------------------------
+
+        std::vector<simd_t> first_ranks(max_first_size, fill<simd_t>(0));
+        std::vector<simd_t> second_ranks(max_second_size, fill<simd_t>(0));
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            auto & [first_seq, second_seq] = batch[group_begin + lane];
+
+            size_t pos = 0;
+            for (auto && letter : first_seq)
+                first_ranks[pos++][lane] = static_cast<score_t>(to_rank(letter));
+
+            pos = 0;
+            for (auto && letter : second_seq)
+                second_ranks[pos++][lane] = static_cast<score_t>(to_rank(letter));
+        }
+
+        // ----------------------------------------------------------------------------
+        // Initialise the first column.
+        // ----------------------------------------------------------------------------
+
+        auto const & gaps = cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+        auto cache = this->template make_cache<simd_t>(gaps);
+        auto const & [gap_open, gap_extend, zero] = cache;
+
+        // The score of a leading gap of the given length.
+        auto leading_gap = [&] (size_t const length)
+        {
+            if (is_local || length == 0)
+                return zero;
+
+            return fill<simd_t>(static_cast<score_t>(gaps.get_gap_open_score() + gaps.get_gap_score() * length));
+        };
+
+        std::vector<simd_t> main_column(max_first_size + 1);
+        std::vector<simd_t> hz_column(max_first_size + 1);
+        for (size_t row = 0; row <= max_first_size; ++row)
+        {
+            main_column[row] = leading_gap(row);
+            hz_column[row] = main_column[row] + gap_open;
+        }
+
+        std::array<score_t, lanes> scores{};
+        auto capture_scores = [&] (size_t const column)
+        {
+            for (size_t lane = 0; lane < group_size; ++lane)
+                if (second_sizes[lane] == column)
+                    scores[lane] = main_column[first_sizes[lane]][lane];
+        };
+
+        // Masks selecting the lanes for which a cell lies within the respective matrix (only used for local).
+        std::vector<simd_t> row_masks{};
+        simd_t best = zero;
+        if constexpr (is_local)
+        {
+            row_masks.resize(max_first_size + 1, fill<simd_t>(0));
+            for (size_t row = 0; row <= max_first_size; ++row)
+                for (size_t lane = 0; lane < group_size; ++lane)
+                    row_masks[row][lane] = (row <= first_sizes[lane]) ? static_cast<score_t>(-1) : 0;
+        }
+        else
+        {
+            capture_scores(0);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Compute the matrices column by column.
+        // ----------------------------------------------------------------------------
+
+        simd_t const match = fill<simd_t>(static_cast<score_t>(table.scores[0]));
+        simd_t const mismatch = fill<simd_t>(static_cast<score_t>(table.scores.size() > 1 ? table.scores[1]
+                                                                                            : table.scores[0]));
+
+        for (size_t column = 1; column <= max_second_size; ++column)
+        {
+            simd_t const & second_rank = second_ranks[column - 1];
+            simd_t diagonal = main_column[0];
+            main_column[0] = leading_gap(column);
+            simd_t vt_score = main_column[0] + gap_open;
+
+            simd_t column_mask = fill<simd_t>(0);
+            if constexpr (is_local)
+            {
+                for (size_t lane = 0; lane < group_size; ++lane)
+                    column_mask[lane] = (column <= second_sizes[lane]) ? static_cast<score_t>(-1) : 0;
+            }
+
+            for (size_t row = 1; row <= max_first_size; ++row)
+            {
+                simd_t const & first_rank = first_ranks[row - 1];
+                simd_t score;
+
+                if (table.is_simple)
+                {
+                    score = this->blend(first_rank == second_rank, match, mismatch);
+                }
+                else
+                {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        score[lane] = static_cast<score_t>(table.scores[first_rank[lane] * table.second_alphabet_size +
+                                                                        second_rank[lane]]);
+                }
+
+                this->compute_cell(main_column[row], hz_column[row], vt_score, diagonal, cache, score);
+
+                if constexpr (is_local)
+                    best = this->max(best, main_column[row] & row_masks[row] & column_mask);
+            }
+
+            if constexpr (!is_local)
+                capture_scores(column);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Write the results.
+        // ----------------------------------------------------------------------------
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            if constexpr (is_local)
+                scores[lane] = best[lane];
+
+            result_value_t res{};
+            res.score = static_cast<int32_t>(scores[lane]);
+            results[group_begin + lane] = alignment_result{res};
+        }
+
+        group_begin += group_size;
+        return true;
+    }
+
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<config_t> cfg_ptr{};
+};
+
+} // namespace seqan3::detail
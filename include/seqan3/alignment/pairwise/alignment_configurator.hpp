@@ -20,9 +20,12 @@
 #include <seqan3/alignment/configuration/all.hpp>
 #include <seqan3/alignment/pairwise/policy/all.hpp>
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/alignment_algorithm_vectorised.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_vectorised.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/metafunction/deferred_crtp_base.hpp>
@@ -264,6 +267,14 @@ public:
 
             return configure<sequences_t>(cfg | align_cfg::result{with_score});
         }
+        else if constexpr (config_t::template exists<align_cfg::vectorise_tag>())
+        {
+            // ----------------------------------------------------------------------------
+            // Configure the type-erased inter-sequence vectorised alignment function.
+            // ----------------------------------------------------------------------------
+
+            return configure_vectorised<sequences_t>(cfg);
+        }
         else
         {
             // ----------------------------------------------------------------------------
@@ -343,10 +354,114 @@ public:
 
 private:
 
+    /*!\brief Configures the inter-sequence vectorised alignment algorithm.
+     * \tparam sequences_t The range type containing the sequence pairs.
+     * \tparam config_t    The alignment configuration type.
+     * \param[in] cfg      The passed configuration object.
+     *
+     * \returns A std::function that computes the results for a batch of sequence pairs.
+     *
+     * \details
+     *
+     * Edit distance configurations are computed with seqan3::detail::pairwise_alignment_edit_distance_vectorised,
+     * all other configurations with seqan3::detail::alignment_algorithm_vectorised.
+     *
+     * \throws seqan3::invalid_alignment_configuration if anything else than the score is requested, if the back
+     *         coordinate is requested for an alignment that is not an edit distance, or if free end-gaps are
+     *         configured for a global alignment that is not an edit distance.
+     */
+    template <typename sequences_t, typename config_t>
+    static constexpr auto configure_vectorised(config_t const & cfg)
+    {
+        using first_seq_t = std::tuple_element_t<0, value_type_t<std::remove_reference_t<sequences_t>>>;
+        using second_seq_t = std::tuple_element_t<1, value_type_t<std::remove_reference_t<sequences_t>>>;
+
+        using result_t = alignment_result<typename align_result_selector<std::remove_reference_t<first_seq_t>,
+                                                                         std::remove_reference_t<second_seq_t>,
+                                                                         config_t>::type>;
+        using batch_t = std::vector<std::tuple<first_seq_t &, second_seq_t &>>;
+        using function_wrapper_t = std::function<std::vector<result_t>(batch_t &)>;
+
+        // ----------------------------------------------------------------------------
+        // Test some basic preconditions
+        // ----------------------------------------------------------------------------
+
+        using alignment_contract_t = alignment_contract<sequences_t, config_t>;
+
+        static_assert(alignment_contract_t::expects_alignment_configuration(),
+                      "Alignment configuration error: "
+                      "The alignment can only be configured with alignment configurations.");
+
+        static_assert(alignment_contract_t::expects_valid_scoring_scheme(),
+                      "Alignment configuration error: "
+                      "Either the scoring scheme was not configured or the given scoring scheme cannot be invoked with "
+                      "the value types of the passed sequences.");
+
+        // ----------------------------------------------------------------------------
+        // Check if invalid configuration was used.
+        // ----------------------------------------------------------------------------
+
+        constexpr bool with_score = config_t::template exists<align_cfg::result<with_score_type>>();
+        constexpr bool with_back_coordinate =
+            config_t::template exists<align_cfg::result<with_back_coordinate_type>>();
+
+        if constexpr (!with_score && !with_back_coordinate)
+            throw invalid_alignment_configuration{"The align_cfg::vectorise configuration can only be used to compute "
+                                                  "the score or, for the edit distance, the back coordinate."};
+
+        using local_t = std::bool_constant<config_t::template exists<align_cfg::mode<detail::local_alignment_type>>()>;
+
+        if constexpr (!local_t::value)
+        {
+            // Use the vectorised edit distance under the same conditions as the scalar edit distance.
+            auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+            auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+            auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
+
+            if (gaps.get_gap_open_score() == 0 &&
+                !(align_ends_cfg[2] || align_ends_cfg[3]) &&
+                align_ends_cfg[0] == align_ends_cfg[1])
+            {
+                if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>,
+                                                          nucleotide_scoring_scheme>)
+                {
+                    if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0) &&
+                        (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
+                        return configure_edit_distance<function_wrapper_t>(cfg);
+                }
+            }
+
+            if (align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3])
+                throw invalid_alignment_configuration{"The align_cfg::vectorise configuration cannot be combined "
+                                                      "with free end-gaps."};
+        }
+
+        if constexpr (!with_score)
+            throw invalid_alignment_configuration{"The align_cfg::vectorise configuration can only compute the back "
+                                                  "coordinate of edit distance alignments."};
+
+        // ----------------------------------------------------------------------------
+        // Configure the algorithm
+        // ----------------------------------------------------------------------------
+
+        using gap_t = deferred_crtp_base<simd_affine_gap_policy, local_t>;
+        return function_wrapper_t{alignment_algorithm_vectorised<config_t, gap_t>{cfg}};
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
      * \param[in] cfg             The passed configuration object.
+     *
+     * \details
+     *
+     * If seqan3::align_cfg::vectorise is given, the inter-sequence vectorised
+     * seqan3::detail::pairwise_alignment_edit_distance_vectorised is configured. Otherwise, if
+     * seqan3::align_cfg::band is given, the banded edit distance seqan3::detail::edit_distance_banded_wrapper is
+     * configured, and the unbanded seqan3::detail::edit_distance_wrapper else.
+     *
+     * \throws seqan3::invalid_alignment_configuration if seqan3::align_cfg::band and seqan3::align_cfg::max_error
+     *         are both given.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
@@ -355,8 +470,10 @@ private:
         // Unsupported configurations
         // ----------------------------------------------------------------------------
 
-        if constexpr (config_t::template exists<align_cfg::band>())
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
+        if constexpr (config_t::template exists<align_cfg::band>() &&
+                      config_t::template exists<align_cfg::max_error>())
+            throw invalid_alignment_configuration{"The align_cfg::max_error configuration cannot be combined with "
+                                                  "the align_cfg::band configuration."};
 
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
@@ -374,7 +491,14 @@ private:
                 using is_semi_global_type [[maybe_unused]] = remove_cvref_t<decltype(is_semi_global)>;
             };
 
-            return function_wrapper_t{edit_distance_wrapper<remove_cvref_t<config_t>, edit_traits_type>{cfg}};
+            using cfg_t = remove_cvref_t<config_t>;
+
+            if constexpr (config_t::template exists<align_cfg::vectorise_tag>())
+                return function_wrapper_t{pairwise_alignment_edit_distance_vectorised<cfg_t, edit_traits_type>{cfg}};
+            else if constexpr (config_t::template exists<align_cfg::band>())
+                return function_wrapper_t{edit_distance_banded_wrapper<cfg_t, edit_traits_type>{cfg}};
+            else
+                return function_wrapper_t{edit_distance_wrapper<cfg_t, edit_traits_type>{cfg}};
         };
 
         // Check if it has free ends set for the first sequence trailing gaps.
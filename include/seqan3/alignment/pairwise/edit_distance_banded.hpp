@@ -0,0 +1,754 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains a pairwise alignment algorithm for edit distance restricted to a static band.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/alignment_score_matrix.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates an alignment using the edit distance restricted to a static band.
+ * \ingroup pairwise_alignment
+ * \tparam database_t     \copydoc pairwise_alignment_edit_distance_banded::database_type
+ * \tparam query_t        \copydoc pairwise_alignment_edit_distance_banded::query_type
+ * \tparam align_config_t The type of the alignment config; must contain seqan3::align_cfg::band.
+ * \tparam traits_t       The traits type; must model seqan3::detail::EditDistanceTrait.
+ *
+ * \details
+ *
+ * Only cells whose diagonal `column - row` lies within the bounds of the configured seqan3::static_band are part of
+ * an alignment. Instead of computing the bit-vectors for the entire column as
+ * seqan3::detail::pairwise_alignment_edit_distance_unbanded does, the bit-vectors cover a window of
+ * `upper_bound - lower_bound + 1` rows, which starts at the upper diagonal of the band. Whenever the band moves
+ * down by one row, the window is shifted by one bit (Hyyrö's diagonal band). Hence, computing the alignment takes
+ * \f$ O(N \cdot k / w) \f$ time, where \f$ k \f$ is the band width and \f$ w \f$ is the size of a machine word.
+ *
+ * The cells directly above and below the band are replaced by the value of their diagonal predecessor plus one.
+ * Such a cell never improves the score of a cell inside of the band, so the cells inside of the band are computed
+ * exactly as if every cell outside of the band was infinite. Because the window does not start in the first row
+ * anymore, the score of the row above the window is tracked explicitly for every column.
+ *
+ * The window of every column is kept for the traceback, which requires \f$ O(N \cdot k / w) \f$ memory.
+ */
+template <std::ranges::ViewableRange database_t,
+          std::ranges::ViewableRange query_t,
+          typename align_config_t,
+          EditDistanceTrait traits_t = default_edit_distance_trait_type>
+class pairwise_alignment_edit_distance_banded
+{
+    /*!\name Befriended classes
+     * \{
+     */
+    //!\brief Befriend seqan3::detail::alignment_score_matrix<pairwise_alignment_edit_distance_banded>
+    friend alignment_score_matrix<pairwise_alignment_edit_distance_banded>;
+    //!\brief Befriend seqan3::detail::alignment_trace_matrix<pairwise_alignment_edit_distance_banded>
+    friend alignment_trace_matrix<pairwise_alignment_edit_distance_banded>;
+    //!\}
+
+    //!\brief The horizontal/database sequence.
+    database_t database;
+    //!\brief The vertical/query sequence.
+    query_t query;
+    //!\brief The configuration.
+    align_config_t config;
+
+public:
+    //!\brief The type of one machine word.
+    using word_type = typename std::remove_reference_t<traits_t>::word_type;
+    //!\brief The type of the score.
+    using score_type = int;
+    //!\brief The type of the database sequence.
+    using database_type = std::remove_reference_t<database_t>;
+    //!\brief The type of the query sequence.
+    using query_type = std::remove_reference_t<query_t>;
+    //!\brief The type of the score matrix.
+    using score_matrix_type = detail::alignment_score_matrix<pairwise_alignment_edit_distance_banded>;
+    //!\brief The type of the trace matrix.
+    using trace_matrix_type = detail::alignment_trace_matrix<pairwise_alignment_edit_distance_banded>;
+
+    //!\brief The size of one machine word.
+    static constexpr uint8_t word_size = sizeof(word_type) * 8;
+
+private:
+    //!\brief The alphabet type of the query sequence.
+    using query_alphabet_type = std::remove_reference_t<reference_t<query_type>>;
+
+    //!\brief Whether the alignment is a semi-global alignment or not.
+    static constexpr bool is_semi_global = traits_t::is_semi_global_type::value;
+    //!\brief Whether the alignment is a global alignment or not.
+    static constexpr bool is_global = !is_semi_global;
+
+    static_assert(8 * sizeof(word_type) <= 64, "we assume at most uint64_t as word_type");
+    static_assert(std::remove_reference_t<align_config_t>::template exists<align_cfg::band>(),
+                  "The band configuration is required for the banded edit distance.");
+
+    //!\brief The lower diagonal of the band, limited to the size of the query.
+    int64_t lower_diagonal{};
+    //!\brief The upper diagonal of the band, limited to the size of the database.
+    int64_t upper_diagonal{};
+    //!\brief The number of rows covered by the bit-vectors.
+    size_t window_size{};
+    //!\brief The number of machine words covering the window.
+    size_t block_count{};
+    //!\brief The number of machine words per letter in #bit_masks.
+    size_t mask_block_count{};
+    //!\brief The last column that contains cells of the band.
+    size_t last_column{};
+
+    //!\brief The machine words which stores the positive vertical differences of the window.
+    std::vector<word_type> vp{};
+    //!\brief The machine words which stores the negative vertical differences of the window.
+    std::vector<word_type> vn{};
+    //!\brief The machine words which translate a letter of the query into a bit mask.
+    //!\details In contrast to the window the bit masks cover the entire query followed by a padding of zeros.
+    std::vector<word_type> bit_masks{};
+
+    //!\brief The windows of each computation step.
+    edit_distance_trace_storage<word_type> trace_storage{};
+    //!\brief The score of the row above the window of each computation step.
+    std::vector<score_type> window_scores{};
+
+    //!\brief The best score of the alignment in the last row (if is_semi_global = true) or in the last cell.
+    score_type _best_score{};
+    //!\brief The column of the best score.
+    size_t _best_score_col{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief The class template parameter may resolve to an lvalue reference which prohibits default constructibility.
+    pairwise_alignment_edit_distance_banded() = delete;
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded(pairwise_alignment_edit_distance_banded const &) = default;
+    pairwise_alignment_edit_distance_banded(pairwise_alignment_edit_distance_banded &&) = default; //!< Defaulted
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded & operator=(pairwise_alignment_edit_distance_banded const &) = default;
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded & operator=(pairwise_alignment_edit_distance_banded &&) = default;
+    ~pairwise_alignment_edit_distance_banded() = default;                                         //!< Defaulted
+
+    /*!\brief Constructor
+     * \param[in] _database \copydoc database
+     * \param[in] _query    \copydoc query
+     * \param[in] _config   \copydoc config
+     * \param[in] _traits   The traits object. Only the type information will be used.
+     * \param[in] _storage  The storage for the windows; its memory is reused (see #release_trace_storage).
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not contain the first cell (global) or the
+     *         first row (semi-global), or if it does not contain the last cell (global) or the last row (semi-global).
+     */
+    pairwise_alignment_edit_distance_banded(database_t && _database,
+                                            query_t && _query,
+                                            align_config_t _config,
+                                            traits_t const & SEQAN3_DOXYGEN_ONLY(_traits) = traits_t{},
+                                            edit_distance_trace_storage<word_type> _storage = {}) :
+        database{std::forward<database_t>(_database)},
+        query{std::forward<query_t>(_query)},
+        config{std::forward<align_config_t>(_config)},
+        trace_storage{std::move(_storage)}
+    {
+        static constexpr size_t alphabet_size = alphabet_size_v<query_alphabet_type>;
+
+        auto const & band = get<align_cfg::band>(config).value;
+        int64_t const database_size = std::ranges::size(database);
+        int64_t const query_size = std::ranges::size(query);
+
+        // ----------------------------------------------------------------------------
+        // Check valid band settings.
+        // ----------------------------------------------------------------------------
+
+        if (band.upper_bound < 0 || (is_global && band.lower_bound > 0))
+        {
+            throw invalid_alignment_configuration
+            {
+                "Invalid band error: The band of the edit distance must contain the begin of the alignment matrix."
+            };
+        }
+
+        if (query_size + band.lower_bound > database_size ||
+            (is_global && database_size - query_size > band.upper_bound))
+        {
+            throw invalid_alignment_configuration
+            {
+                "Invalid band error: The band of the edit distance must contain the end of the alignment matrix."
+            };
+        }
+
+        // ----------------------------------------------------------------------------
+        // Initialise the window.
+        // ----------------------------------------------------------------------------
+
+        // Diagonals outside of the matrix do not change the result but would blow up the window.
+        lower_diagonal = std::max(band.lower_bound, -query_size);
+        upper_diagonal = std::min(band.upper_bound, database_size);
+
+        window_size = std::max<size_t>(1, std::min<size_t>(query_size, upper_diagonal - lower_diagonal + 1));
+        block_count = (window_size - 1 + word_size) / word_size;
+        mask_block_count = (query_size + window_size - 1 + word_size) / word_size + 1;
+
+        if constexpr (is_global)
+            last_column = database_size;
+        else
+            last_column = std::min(database_size, query_size + upper_diagonal);
+
+        bit_masks.resize(alphabet_size * mask_block_count, 0);
+
+        // encoding the letters as bit-vectors
+        for (size_t j = 0; j < std::ranges::size(query); j++)
+        {
+            size_t i = mask_block_count * to_rank(query[j]) + j / word_size;
+            bit_masks[i] |= (word_type)1 << (j % word_size);
+        }
+    }
+    //!\}
+
+private:
+
+    //!\brief The first row of the window in the given column.
+    size_t window_begin(size_t const col) const noexcept
+    {
+        return std::max<int64_t>(1, static_cast<int64_t>(col) - upper_diagonal);
+    }
+
+    //!\brief The last row of the band in the given column.
+    int64_t band_end(size_t const col) const noexcept
+    {
+        return std::min<int64_t>(std::ranges::size(query), static_cast<int64_t>(col) - lower_diagonal);
+    }
+
+    //!\brief Whether the cell lies within the band and the computed part of the matrix.
+    bool is_in_band(size_t const col, size_t const row) const noexcept
+    {
+        int64_t const diagonal = static_cast<int64_t>(col) - static_cast<int64_t>(row);
+
+        return col <= last_column &&
+               row <= std::ranges::size(query) &&
+               diagonal >= lower_diagonal &&
+               diagonal <= upper_diagonal;
+    }
+
+    /*!\brief Extracts the bit mask of the letter for the current window.
+     * \param[in] rank  The rank of the database letter.
+     * \param[in] begin The first row of the window.
+     * \param[in] block The block of the window.
+     */
+    word_type window_bit_mask(size_t const rank, size_t const begin, size_t const block) const noexcept
+    {
+        size_t const offset = begin - 1 + block * word_size;
+        size_t const index = mask_block_count * rank + offset / word_size;
+        size_t const shift = offset % word_size;
+
+        word_type mask = bit_masks[index] >> shift;
+        if (shift != 0)
+            mask |= bit_masks[index + 1] << (word_size - shift);
+        return mask;
+    }
+
+    //!\brief Returns the number of set bits.
+    static score_type popcount(word_type const word) noexcept
+    {
+        return std::bitset<word_size>(word).count();
+    }
+
+    /*!\brief Returns the score of a cell of a computed column.
+     * \param[in] col The column of the cell.
+     * \param[in] row The row of the cell; must lie within the window or be the row above the window.
+     */
+    score_type column_score(size_t const col, size_t const row) const noexcept
+    {
+        size_t const begin = window_begin(col);
+        assert(row + 1 >= begin && row < begin + window_size);
+
+        score_type score = window_scores[col];
+        if (row + 1 == begin)
+            return score;
+
+        size_t const last = row - begin;
+        size_t const offset = trace_storage.column_offsets[col];
+        for (size_t block = 0; block <= last / word_size; ++block)
+        {
+            word_type mask = static_cast<word_type>(~0);
+            if (block == last / word_size)
+                mask >>= word_size - 1 - last % word_size;
+
+            score += popcount(trace_storage.vp[offset + block] & mask);
+            score -= popcount(trace_storage.vn[offset + block] & mask);
+        }
+
+        return score;
+    }
+
+    //!\brief Returns the score of a cell or seqan3::detail::matrix_inf if the cell lies outside of the band.
+    score_type cell_score(size_t const col, size_t const row) const noexcept
+    {
+        if (!is_in_band(col, row))
+            return matrix_inf<score_type>;
+
+        return column_score(col, row);
+    }
+
+    //!\brief One compute step in one column.
+    void compute_step(word_type b, word_type & vp, word_type & vn, word_type & carry_d0, word_type & carry_hp,
+                      word_type & carry_hn)
+    {
+        word_type x, d0, t, hp, hn;
+
+        x = b | vn;
+        t = vp + (x & vp) + carry_d0;
+
+        d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        carry_d0 = (carry_d0 != (word_type)0) ? t <= vp : t < vp;
+
+        x = (hp << 1) | carry_hp;
+        vn = x & d0;
+        vp = (hn << 1) | ~(x | d0) | carry_hn;
+
+        carry_hp = hp >> (word_size - 1);
+        carry_hn = hn >> (word_size - 1);
+    }
+
+    //!\brief Shifts the window down by one row; the new last row has a positive vertical difference.
+    void shift_window()
+    {
+        for (size_t block = 0; block < block_count; ++block)
+        {
+            word_type const next_vp = (block + 1 < block_count) ? vp[block + 1] : 0;
+            word_type const next_vn = (block + 1 < block_count) ? vn[block + 1] : 0;
+            vp[block] = (vp[block] >> 1) | (next_vp << (word_size - 1));
+            vn[block] = (vn[block] >> 1) | (next_vn << (word_size - 1));
+        }
+
+        word_type const last_row = (word_type)1 << ((window_size - 1) % word_size);
+        vp.back() |= last_row;
+        vn.back() &= ~last_row;
+    }
+
+    //!\brief Sets a positive vertical difference for all rows of the window below the band.
+    void mask_below_band(size_t const col)
+    {
+        int64_t const last = band_end(col) - static_cast<int64_t>(window_begin(col));
+
+        for (size_t block = 0; block < block_count; ++block)
+        {
+            int64_t const first = block * word_size;
+            if (last >= first + word_size - 1)
+                continue;
+
+            word_type const keep = (last < first) ? 0 : static_cast<word_type>(~0) >> (word_size - 1 - (last - first));
+            vp[block] |= ~keep;
+            vn[block] &= keep;
+        }
+    }
+
+    //!\brief Add a computation step.
+    void add_state(score_type const window_score)
+    {
+        trace_storage.push_back(vp, vn, block_count);
+        window_scores.push_back(window_score);
+    }
+
+    //!\brief Updates the best score with the score of the last row of the given column.
+    void update_best_score(size_t const col)
+    {
+        if constexpr (is_semi_global)
+        {
+            if (!is_in_band(col, std::ranges::size(query)))
+                return;
+
+            score_type const score = column_score(col, std::ranges::size(query));
+            _best_score_col = (score <= _best_score) ? col : _best_score_col;
+            _best_score     = (score <= _best_score) ? score : _best_score;
+        }
+    }
+
+    //!\brief Compute the alignment.
+    void _compute()
+    {
+        vp.assign(block_count, static_cast<word_type>(~0));
+        vn.assign(block_count, 0);
+
+        trace_storage.clear();
+        trace_storage.reserve(last_column + 1, block_count);
+        window_scores.clear();
+        window_scores.reserve(last_column + 1);
+
+        _best_score = matrix_inf<score_type>;
+        _best_score_col = 0;
+
+        // The first column is 0, 1, 2, ... independent of the band.
+        score_type window_score = 0;
+        add_state(window_score);
+        update_best_score(0);
+
+        for (size_t col = 1; col <= last_column; ++col)
+        {
+            word_type carry_hp;
+            if (window_begin(col) != window_begin(col - 1))
+            {
+                // The new row above the window lies above the band and is set to its left neighbour plus one.
+                window_score += static_cast<score_type>(vp[0] & 1) - static_cast<score_type>(vn[0] & 1) + 1;
+                carry_hp = 1;
+                shift_window();
+            }
+            else
+            {
+                // The row above the window is the first row of the matrix.
+                carry_hp = is_global ? 1 : 0;
+                window_score += carry_hp;
+            }
+
+            word_type carry_d0{0}, carry_hn{0};
+            size_t const rank = to_rank((query_alphabet_type) database[col - 1]);
+
+            for (size_t block = 0; block < block_count; ++block)
+            {
+                word_type b = window_bit_mask(rank, window_begin(col), block);
+                compute_step(b, vp[block], vn[block], carry_d0, carry_hp, carry_hn);
+            }
+
+            mask_below_band(col);
+            add_state(window_score);
+            update_best_score(col);
+        }
+
+        if constexpr (is_global)
+        {
+            _best_score_col = last_column;
+            _best_score = column_score(last_column, std::ranges::size(query));
+        }
+    }
+
+public:
+
+    /*!\brief Generic invocable interface.
+     * \param[in,out] res The alignment result to fill.
+     * \returns A reference to the filled alignment result.
+     */
+    template <typename result_value_type>
+    alignment_result<result_value_type> & operator()(alignment_result<result_value_type> & res)
+    {
+        _compute();
+        result_value_type res_vt{};
+        if constexpr (!std::is_same_v<decltype(res_vt.score), std::nullopt_t *>)
+        {
+            res_vt.score = score();
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.back_coordinate), std::nullopt_t *>)
+        {
+            res_vt.back_coordinate = back_coordinate();
+        }
+
+        [[maybe_unused]] alignment_trace_matrix matrix = trace_matrix();
+        if constexpr (!std::is_same_v<decltype(res_vt.front_coordinate), std::nullopt_t *>)
+        {
+            res_vt.front_coordinate = alignment_front_coordinate(matrix, res_vt.back_coordinate);
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.alignment), std::nullopt_t *>)
+        {
+            res_vt.alignment = alignment_trace(database, query, matrix, res_vt.back_coordinate);
+        }
+        res = alignment_result<result_value_type>{res_vt};
+        return res;
+    }
+
+    /*!\brief Moves the storage of the windows out of the algorithm.
+     * \returns The storage, which can be passed to the next alignment to reuse its memory.
+     *
+     * \details
+     *
+     * After calling this function the score matrix, trace matrix and the alignment cannot be accessed anymore.
+     */
+    edit_distance_trace_storage<word_type> release_trace_storage() noexcept
+    {
+        return std::move(trace_storage);
+    }
+
+    //!\brief Return the score of the alignment.
+    score_type score() const noexcept
+    {
+        return -_best_score;
+    }
+
+    //!\brief Return the score matrix of the alignment.
+    score_matrix_type score_matrix() const noexcept
+    {
+        return score_matrix_type{*this};
+    }
+
+    //!\brief Return the trace matrix of the alignment.
+    trace_matrix_type trace_matrix() const noexcept
+    {
+        return trace_matrix_type{*this};
+    }
+
+    //!\brief Return the begin position of the alignment
+    alignment_coordinate front_coordinate() const noexcept
+    {
+        alignment_coordinate back = back_coordinate();
+        return alignment_front_coordinate(trace_matrix(), back);
+    }
+
+    //!\brief Return the end position of the alignment
+    alignment_coordinate back_coordinate() const noexcept
+    {
+        size_t col = std::max<size_t>(_best_score_col, 1) - 1;
+        return {column_index_type{col}, row_index_type{std::ranges::size(query) - 1}};
+    }
+
+    //!\brief Return the alignment, i.e. the actual base pair matching.
+    auto alignment() const noexcept
+    {
+        return alignment_trace(database, query, trace_matrix(), back_coordinate());
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::pairwise_alignment_edit_distance_banded
+ * \{
+ */
+template<typename database_t, typename query_t, typename config_t>
+pairwise_alignment_edit_distance_banded(database_t && database, query_t && query, config_t config)
+    -> pairwise_alignment_edit_distance_banded<database_t, query_t, config_t>;
+
+template<typename database_t, typename query_t, typename config_t, typename traits_t>
+pairwise_alignment_edit_distance_banded(database_t && database, query_t && query, config_t config, traits_t)
+    -> pairwise_alignment_edit_distance_banded<database_t, query_t, config_t, traits_t>;
+
+template<typename database_t, typename query_t, typename config_t, typename traits_t, typename word_t>
+pairwise_alignment_edit_distance_banded(database_t && database,
+                                        query_t && query,
+                                        config_t config,
+                                        traits_t,
+                                        edit_distance_trace_storage<word_t>)
+    -> pairwise_alignment_edit_distance_banded<database_t, query_t, config_t, traits_t>;
+//!\}
+
+// ----------------------------------------------------------------------------
+// edit_distance_banded_wrapper
+// ----------------------------------------------------------------------------
+
+/*!\brief This type wraps the call to the seqan3::detail::pairwise_alignment_edit_distance_banded algorithm.
+ * \implements std::Invocable
+ * \tparam config_t The configuration type.
+ * \tparam traits_t The traits type; must model seqan3::detail::EditDistanceTrait.
+ *
+ * \details
+ *
+ * The banded counterpart of seqan3::detail::edit_distance_wrapper. It owns the storage for the windows computed by
+ * the algorithm and hands it over to every invocation, such that consecutive alignments reuse the same memory.
+ */
+template <typename config_t, typename traits_t = default_edit_distance_trait_type>
+class edit_distance_banded_wrapper
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_banded_wrapper() = default;                                            //!< Defaulted
+    edit_distance_banded_wrapper(edit_distance_banded_wrapper &&) = default;             //!< Defaulted
+    edit_distance_banded_wrapper & operator=(edit_distance_banded_wrapper &&) = default; //!< Defaulted
+    ~edit_distance_banded_wrapper() = default;                                           //!< Defaulted
+
+    //!\brief Copies the configuration, but not the storage of the windows.
+    edit_distance_banded_wrapper(edit_distance_banded_wrapper const & other) : cfg_ptr{other.cfg_ptr}
+    {}
+
+    //!\brief Copies the configuration, but not the storage of the windows.
+    edit_distance_banded_wrapper & operator=(edit_distance_banded_wrapper const & other)
+    {
+        cfg_ptr = other.cfg_ptr;
+        return *this;
+    }
+
+    /*!\brief Constructs the wrapper with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     */
+    edit_distance_banded_wrapper(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
+    {}
+    //!}
+
+    /*!\brief Invokes the actual alignment computation given two sequences.
+     * \tparam    first_range_t  The type of the first sequence; must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence; must model std::ForwardRange.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        using result_t = typename detail::align_result_selector<remove_cvref_t<first_range_t>,
+                                                                remove_cvref_t<second_range_t>,
+                                                                remove_cvref_t<config_t>>::type;
+
+        pairwise_alignment_edit_distance_banded algo{first_range,
+                                                     second_range,
+                                                     *cfg_ptr,
+                                                     traits_t{},
+                                                     std::move(trace_storage)};
+        alignment_result<result_t> res{};
+        algo(res);
+        trace_storage = algo.release_trace_storage();
+        return res;
+    }
+
+private:
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<remove_cvref_t<config_t>> cfg_ptr{};
+    //!\brief The storage of the windows reused by consecutive invocations.
+    edit_distance_trace_storage<typename traits_t::word_type> trace_storage{};
+};
+
+//!\cond
+template<typename database_t, typename query_t, typename align_config_t, typename traits_t>
+class alignment_score_matrix<pairwise_alignment_edit_distance_banded<database_t, query_t, align_config_t, traits_t>>
+{
+public:
+
+    using alignment_type = pairwise_alignment_edit_distance_banded<database_t, query_t, align_config_t, traits_t>;
+    using entry_type = typename alignment_type::score_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_score_matrix() = default;                                           //!< Defaulted
+    alignment_score_matrix(alignment_score_matrix const &) = default;             //!< Defaulted
+    alignment_score_matrix(alignment_score_matrix &&) = default;                  //!< Defaulted
+    alignment_score_matrix & operator=(alignment_score_matrix const &) = default; //!< Defaulted
+    alignment_score_matrix & operator=(alignment_score_matrix &&) = default;      //!< Defaulted
+    ~alignment_score_matrix() = default;                                          //!< Defaulted
+
+    alignment_score_matrix(alignment_type const & alignment) : alignment_ptr{std::addressof(alignment)}
+    {}
+    //!\}
+
+    size_t rows() const noexcept
+    {
+        return std::ranges::size(alignment_ptr->query) + 1;
+    }
+
+    size_t cols() const noexcept
+    {
+        return std::ranges::size(alignment_ptr->database) + 1;
+    }
+
+    // Cells outside of the band are seqan3::detail::matrix_inf.
+    entry_type at(size_t const row, size_t const col) const noexcept
+    {
+        return alignment_ptr->cell_score(col, row);
+    }
+
+private:
+    alignment_type const * alignment_ptr{nullptr};
+};
+
+template<typename database_t, typename query_t, typename align_config_t, typename traits_t>
+class alignment_trace_matrix<pairwise_alignment_edit_distance_banded<database_t, query_t, align_config_t, traits_t>>
+{
+public:
+
+    using alignment_type = pairwise_alignment_edit_distance_banded<database_t, query_t, align_config_t, traits_t>;
+    using score_matrix_type = alignment_score_matrix<alignment_type>;
+    using score_type = typename score_matrix_type::entry_type;
+    using entry_type = trace_directions;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_trace_matrix() = default;                                           //!< Defaulted
+    alignment_trace_matrix(alignment_trace_matrix const &) = default;             //!< Defaulted
+    alignment_trace_matrix(alignment_trace_matrix &&) = default;                  //!< Defaulted
+    alignment_trace_matrix & operator=(alignment_trace_matrix const &) = default; //!< Defaulted
+    alignment_trace_matrix & operator=(alignment_trace_matrix &&) = default;      //!< Defaulted
+    ~alignment_trace_matrix() = default;                                          //!< Defaulted
+
+    alignment_trace_matrix(alignment_type const & alignment) :
+        alignment_ptr{std::addressof(alignment)}, _score_matrix{alignment}
+    {}
+    //!\}
+
+    size_t rows() const noexcept
+    {
+        return _score_matrix.rows();
+    }
+
+    size_t cols() const noexcept
+    {
+        return _score_matrix.cols();
+    }
+
+    // Predecessors outside of the band are never part of the trace.
+    entry_type at(size_t const row, size_t const col) const noexcept
+    {
+        entry_type direction{};
+
+        score_type const curr = _score_matrix.at(row, col);
+        if (curr == matrix_inf<score_type>)
+            return direction;
+
+        auto comes_from = [&] (size_t const prev_row, size_t const prev_col, score_type const cost)
+        {
+            score_type const prev = _score_matrix.at(prev_row, prev_col);
+            return prev != matrix_inf<score_type> && curr == prev + cost;
+        };
+
+        if (row > 0 && col > 0)
+        {
+            bool is_match = alignment_ptr->query[row - 1] == alignment_ptr->database[col - 1];
+            if (comes_from(row - 1, col - 1, is_match ? 0 : 1))
+                direction |= entry_type::diagonal;
+        }
+
+        if (row > 0 && comes_from(row - 1, col, 1))
+            direction |= entry_type::up;
+
+        if (col > 0 && comes_from(row, col - 1, 1))
+            direction |= entry_type::left;
+
+        return direction;
+    }
+
+    score_matrix_type const & score_matrix() const noexcept
+    {
+        return _score_matrix;
+    }
+
+private:
+    alignment_type const * alignment_ptr{nullptr};
+    score_matrix_type _score_matrix{};
+};
+//!\endcond
+
+} // namespace seqan3::detail
@@ -13,8 +13,8 @@
 #pragma once
 
 #include <algorithm>
-#include <bitset>
 #include <utility>
+#include <vector>
 
 #include <range/v3/algorithm/copy.hpp>
 
@@ -63,6 +63,92 @@ struct default_edit_distance_trait_type
     using is_semi_global_type = std::false_type;
 };
 
+/*!\brief The flat storage of the vertical differences computed by
+ *        seqan3::detail::pairwise_alignment_edit_distance_unbanded.
+ * \ingroup pairwise_alignment
+ * \tparam word_t The type of one machine word.
+ *
+ * \details
+ *
+ * The bit-vectors `vp` and `vn` of all computed columns are appended to two contiguous vectors, such that a column
+ * does not require its own heap allocation. The blocks of column `i` are stored in the range
+ * `[column_offsets[i], column_offsets[i + 1])`. A column might store fewer blocks than the query occupies, which is
+ * the case if seqan3::align_cfg::max_error is set and only the blocks up to the last active cell are kept. The
+ * vertical differences of blocks that are not stored are assumed to be `+1`, which is an upper bound for the score
+ * of these cells. Since the stored scores of these cells exceed the maximal error, they are never part of a valid
+ * trace.
+ *
+ * Clearing the storage keeps the allocated memory, such that it can be reused for the next alignment.
+ */
+template <typename word_t>
+struct edit_distance_trace_storage
+{
+    //!\brief The size of one machine word.
+    static constexpr size_t word_size = sizeof(word_t) * 8;
+
+    //!\brief The machine words storing the positive vertical differences of all columns.
+    std::vector<word_t> vp{};
+    //!\brief The machine words storing the negative vertical differences of all columns.
+    std::vector<word_t> vn{};
+    //!\brief The position of the first block of every column; has one more entry than columns are stored.
+    std::vector<size_t> column_offsets{};
+
+    //!\brief Removes all columns but keeps the allocated memory.
+    void clear() noexcept
+    {
+        vp.clear();
+        vn.clear();
+        column_offsets.clear();
+        column_offsets.push_back(0);
+    }
+
+    /*!\brief Reserves the memory for the given number of columns.
+     * \param[in] column_count The number of columns.
+     * \param[in] block_count  The expected number of blocks per column.
+     */
+    void reserve(size_t const column_count, size_t const block_count)
+    {
+        vp.reserve(column_count * block_count);
+        vn.reserve(column_count * block_count);
+        column_offsets.reserve(column_count + 1);
+    }
+
+    /*!\brief Appends a column.
+     * \param[in] column_vp   The positive vertical differences of the column.
+     * \param[in] column_vn   The negative vertical differences of the column.
+     * \param[in] block_count The number of blocks to store starting from the first block.
+     */
+    void push_back(std::vector<word_t> const & column_vp,
+                   std::vector<word_t> const & column_vn,
+                   size_t const block_count)
+    {
+        assert(block_count <= column_vp.size());
+        assert(!column_offsets.empty());
+
+        vp.insert(vp.end(), column_vp.begin(), column_vp.begin() + block_count);
+        vn.insert(vn.end(), column_vn.begin(), column_vn.begin() + block_count);
+        column_offsets.push_back(vp.size());
+    }
+
+    /*!\brief Returns the vertical difference between the given cell and its upper neighbour.
+     * \param[in] column The column of the cell.
+     * \param[in] row    The row of the cell (excluding the initial row).
+     * \returns `1`, `0` or `-1`.
+     */
+    int delta(size_t const column, size_t const row) const noexcept
+    {
+        if (column + 1 >= column_offsets.size())
+            return 1;
+
+        size_t const block = column_offsets[column] + row / word_size;
+        if (block >= column_offsets[column + 1])
+            return 1;
+
+        word_t const mask = static_cast<word_t>(1) << (row % word_size);
+        return ((vp[block] & mask) ? 1 : 0) - ((vn[block] & mask) ? 1 : 0);
+    }
+};
+
 /*!\brief This calculates an alignment using the edit distance and without a band.
  * \ingroup pairwise_alignment
  * \tparam database_t     \copydoc pairwise_alignment_edit_distance_unbanded::database_type
@@ -123,6 +209,10 @@ private:
     static constexpr bool is_semi_global = traits_t::is_semi_global_type::value;
     //!\brief Whether the alignment is a global alignment or not.
     static constexpr bool is_global = !is_semi_global;
+    //!\brief Whether the begin position or the alignment is requested, i.e. whether the columns must be stored.
+    static constexpr bool with_trace =
+        std::remove_reference_t<align_config_t>::template exists<align_cfg::result<with_front_coordinate_type>>() ||
+        std::remove_reference_t<align_config_t>::template exists<align_cfg::result<with_alignment_type>>();
 
     //!\brief How to pre-initialize hp.
     static constexpr word_type hp0 = is_global ? 1 : 0;
@@ -173,22 +263,21 @@ private:
     //!\brief The end position of the database.
     database_iterator database_it_end{};
 
-    //!\brief The state of one column computation.
-    struct state_type
-    {
-        //!\copydoc pairwise_alignment_edit_distance_unbanded::vp
-        std::vector<word_type> vp{};
-        //!\copydoc pairwise_alignment_edit_distance_unbanded::vn
-        std::vector<word_type> vn{};
-    };
-
-    //!\brief The collection of each computation step.
-    std::vector<state_type> states{};
+    //!\brief The vertical differences of each computation step.
+    edit_distance_trace_storage<word_type> trace_storage{};
 
-    //!\brief Add a computation step
+    /*!\brief Add a computation step.
+     * \details If #use_max_errors is true only the blocks up to the last active cell are stored. Nothing is stored
+     * unless #with_trace is true.
+     */
     void add_state()
     {
-        states.push_back(state_type{vp, vn});
+        if constexpr (!with_trace)
+            return;
+        else if constexpr (use_max_errors)
+            trace_storage.push_back(vp, vn, std::min(last_block + 1, vp.size()));
+        else
+            trace_storage.push_back(vp, vn, vp.size());
     }
 
 public:
@@ -212,11 +301,14 @@ public:
      * \param[in] _query    \copydoc query
      * \param[in] _config   \copydoc config
      * \param[in] _traits   The traits object. Only the type information will be used.
+     * \param[in] _storage  The storage for the vertical differences; its memory is reused (see
+     *                      #release_trace_storage).
      */
     pairwise_alignment_edit_distance_unbanded(database_t && _database,
                                               query_t && _query,
                                               align_config_t _config,
-                                              traits_t const & SEQAN3_DOXYGEN_ONLY(_traits) = traits_t{}) :
+                                              traits_t const & SEQAN3_DOXYGEN_ONLY(_traits) = traits_t{},
+                                              edit_distance_trace_storage<word_type> _storage = {}) :
         database{std::forward<database_t>(_database)},
         query{std::forward<query_t>(_query)},
         config{std::forward<align_config_t>(_config)},
@@ -224,7 +316,8 @@ public:
         _best_score{static_cast<score_type>(query.size())},
         _best_score_col{ranges::begin(database)},
         database_it{ranges::begin(database)},
-        database_it_end{ranges::end(database)}
+        database_it_end{ranges::end(database)},
+        trace_storage{std::move(_storage)}
     {
         static constexpr size_t alphabet_size = alphabet_size_v<query_alphabet_type>;
 
@@ -264,6 +357,9 @@ public:
             bit_masks[i] |= (word_type)1 << (j % word_size);
         }
 
+        trace_storage.clear();
+        if constexpr (with_trace)
+            trace_storage.reserve(database.size() + 1, last_block + 1);
         add_state();
     }
     //!\}
@@ -436,35 +532,58 @@ public:
             res_vt.back_coordinate = back_coordinate();
         }
 
-        [[maybe_unused]] alignment_trace_matrix matrix = trace_matrix();
-        if constexpr (!std::is_same_v<decltype(res_vt.front_coordinate), std::nullopt_t *>)
+        if constexpr (with_trace)
         {
-            res_vt.front_coordinate = alignment_front_coordinate(matrix, res_vt.back_coordinate);
-        }
+            alignment_trace_matrix matrix = trace_matrix();
+            if constexpr (!std::is_same_v<decltype(res_vt.front_coordinate), std::nullopt_t *>)
+            {
+                res_vt.front_coordinate = alignment_front_coordinate(matrix, res_vt.back_coordinate);
+            }
 
-        if constexpr (!std::is_same_v<decltype(res_vt.alignment), std::nullopt_t *>)
-        {
-            res_vt.alignment = alignment_trace(database, query, matrix, res_vt.back_coordinate);
+            if constexpr (!std::is_same_v<decltype(res_vt.alignment), std::nullopt_t *>)
+            {
+                res_vt.alignment = alignment_trace(database, query, matrix, res_vt.back_coordinate);
+            }
         }
         res = alignment_result<result_value_type>{res_vt};
         return res;
     }
 
+    /*!\brief Moves the storage of the vertical differences out of the algorithm.
+     * \returns The storage, which can be passed to the next alignment to reuse its memory.
+     *
+     * \details
+     *
+     * After calling this function the score matrix, trace matrix and the alignment cannot be accessed anymore.
+     */
+    edit_distance_trace_storage<word_type> release_trace_storage() noexcept
+    {
+        return std::move(trace_storage);
+    }
+
     //!\brief Return the score of the alignment.
     score_type score() const noexcept
     {
         return -_best_score;
     }
 
-    //!\brief Return the score matrix of the alignment.
+    /*!\brief Return the score matrix of the alignment.
+     * \details Requires seqan3::align_cfg::result with seqan3::with_front_coordinate or seqan3::with_alignment.
+     */
     score_matrix_type score_matrix() const noexcept
     {
+        static_assert(with_trace, "The score matrix is only stored if the begin position or the alignment is "
+                                  "requested.");
         return score_matrix_type{*this};
     }
 
-    //!\brief Return the trace matrix of the alignment.
+    /*!\brief Return the trace matrix of the alignment.
+     * \details Requires seqan3::align_cfg::result with seqan3::with_front_coordinate or seqan3::with_alignment.
+     */
     trace_matrix_type trace_matrix() const noexcept
     {
+        static_assert(with_trace, "The trace matrix is only stored if the begin position or the alignment is "
+                                  "requested.");
         return trace_matrix_type{*this};
     }
 
@@ -580,6 +699,14 @@ pairwise_alignment_edit_distance_unbanded(database_t && database, query_t && que
 template<typename database_t, typename query_t, typename config_t, typename traits_t>
 pairwise_alignment_edit_distance_unbanded(database_t && database, query_t && query, config_t config, traits_t)
     -> pairwise_alignment_edit_distance_unbanded<database_t, query_t, config_t, traits_t>;
+
+template<typename database_t, typename query_t, typename config_t, typename traits_t, typename word_t>
+pairwise_alignment_edit_distance_unbanded(database_t && database,
+                                          query_t && query,
+                                          config_t config,
+                                          traits_t,
+                                          edit_distance_trace_storage<word_t>)
+    -> pairwise_alignment_edit_distance_unbanded<database_t, query_t, config_t, traits_t>;
 //!\}
 
 // ----------------------------------------------------------------------------
@@ -597,6 +724,10 @@ pairwise_alignment_edit_distance_unbanded(database_t && database, query_t && que
  * if an edit distance should be computed. On invocation it delegates the call to the actual implementation
  * of the edit distance algorithm, while the interface is unified with the execution model of the pairwise alignment
  * algorithms.
+ *
+ * The wrapper owns the storage for the vertical differences computed by the algorithm and hands it over to every
+ * invocation, such that consecutive alignments reuse the same memory. The storage is not shared between copies of
+ * the wrapper, which allows concurrent invocations of different copies.
  */
 template <typename config_t, typename traits_t = default_edit_distance_trait_type>
 class edit_distance_wrapper
@@ -605,12 +736,21 @@ public:
     /*!\name Constructors, destructor and assignment
      * \{
      */
-    constexpr edit_distance_wrapper() = default;                                          //!< Defaulted
-    constexpr edit_distance_wrapper(edit_distance_wrapper const &) = default;             //!< Defaulted
-    constexpr edit_distance_wrapper(edit_distance_wrapper &&) = default;                  //!< Defaulted
-    constexpr edit_distance_wrapper & operator=(edit_distance_wrapper const &) = default; //!< Defaulted
-    constexpr edit_distance_wrapper & operator=(edit_distance_wrapper &&) = default;      //!< Defaulted
-    ~edit_distance_wrapper() = default;                                                   //!< Defaulted
+    edit_distance_wrapper() = default;                                     //!< Defaulted
+    edit_distance_wrapper(edit_distance_wrapper &&) = default;             //!< Defaulted
+    edit_distance_wrapper & operator=(edit_distance_wrapper &&) = default; //!< Defaulted
+    ~edit_distance_wrapper() = default;                                    //!< Defaulted
+
+    //!\brief Copies the configuration, but not the storage of the vertical differences.
+    edit_distance_wrapper(edit_distance_wrapper const & other) : cfg_ptr{other.cfg_ptr}
+    {}
+
+    //!\brief Copies the configuration, but not the storage of the vertical differences.
+    edit_distance_wrapper & operator=(edit_distance_wrapper const & other)
+    {
+        cfg_ptr = other.cfg_ptr;
+        return *this;
+    }
 
     /*!\brief Constructs the wrapper with the passed configuration.
      * \param cfg The configuration to be passed to the algorithm.
@@ -640,14 +780,22 @@ public:
                                                                 remove_cvref_t<second_range_t>,
                                                                 remove_cvref_t<config_t>>::type;
 
-        pairwise_alignment_edit_distance_unbanded algo{first_range, second_range, *cfg_ptr, traits_t{}};
+        pairwise_alignment_edit_distance_unbanded algo{first_range,
+                                                       second_range,
+                                                       *cfg_ptr,
+                                                       traits_t{},
+                                                       std::move(trace_storage)};
         alignment_result<result_t> res{};
-        return algo(res);
+        algo(res);
+        trace_storage = algo.release_trace_storage();
+        return res;
     }
 
 private:
     //!\brief The alignment configuration stored on the heap.
     std::shared_ptr<remove_cvref_t<config_t>> cfg_ptr{};
+    //!\brief The storage of the vertical differences reused by consecutive invocations.
+    edit_distance_trace_storage<typename traits_t::word_type> trace_storage{};
 };
 
 //!\cond
@@ -680,35 +828,17 @@ public:
             [&]{
                 size_t _cols = alignment.database.size() + 1;
                 size_t _rows = alignment.query.size() + 1;
-                std::vector<score_type> scores{};
-                scores.reserve(_cols * _rows);
+                std::vector<score_type> scores(_cols * _rows);
 
                 // init first row with 0, 1, 2, 3, ...
                 for (size_t col = 0; col < _cols; ++col)
                     scores[col] = alignment_type::is_global ? col : 0;
 
-                auto deltas = [&](size_t col)
-                {
-                    return [state = alignment.states[col]](size_t row)
-                    {
-                        using bitset = std::bitset<word_size>;
-
-                        size_t chunk = row / word_size;
-                        size_t row_in_chunk = row % word_size;
-                        word_type vp = state.vp[chunk];
-                        word_type vn = state.vn[chunk];
-
-                        int8_t p = bitset(vp)[row_in_chunk] ? 1 : 0;
-                        int8_t n = bitset(vn)[row_in_chunk] ? 1 : 0;
-                        return p - n;
-                    };
-                };
-
+                auto const & storage = alignment.trace_storage;
                 for (size_t col = 0; col < _cols; ++col)
                 {
-                    auto delta = deltas(col);
                     for (size_t row = 1; row < _rows; ++row)
-                        scores[row * _cols + col] = scores[(row - 1) * _cols + col] + delta(row - 1);
+                        scores[row * _cols + col] = scores[(row - 1) * _cols + col] + storage.delta(col, row - 1);
                 }
 
                 return scores;
@@ -0,0 +1,351 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_edit_distance_vectorised.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance of many sequence pairs using inter-sequence vectorisation of the bit-parallel
+ *        algorithm of Myers.
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type; must be of type seqan3::configuration.
+ * \tparam traits_t The traits type; must model seqan3::detail::EditDistanceTrait. The `word_type` determines the
+ *                  width of the simd lanes.
+ *
+ * \details
+ *
+ * The batch is split into groups, where every sequence pair of a group is assigned to one lane of a
+ * seqan3::simd::simd_type over the `word_type`. Every lane encodes the bit-vectors of its query, i.e. the second
+ * sequence, such that the i-th simd vector of a column holds the i-th block of the vertical differences of every
+ * query in the group. Queries that are longer than one machine word are split into several blocks; the carries
+ * between the blocks are propagated lane-wise. Accordingly, every query of the group is aligned against its
+ * database sequence in a single pass over the columns, and every query obtains its own score and, in the
+ * semi-global case, its own best column.
+ *
+ * If all pairs of a group share the same database sequence, for example if many short reads are verified against
+ * the same candidate region, the pattern bit-vectors of a column are loaded with a single vector access. Otherwise
+ * they are gathered lane by lane.
+ */
+template <typename config_t, EditDistanceTrait traits_t = default_edit_distance_trait_type>
+class pairwise_alignment_edit_distance_vectorised
+{
+private:
+    //!\brief The type of the machine word packed into the simd lanes.
+    using word_type = typename std::remove_reference_t<traits_t>::word_type;
+    //!\brief The simd vector type.
+    using simd_t = simd_type_t<word_type>;
+
+    //!\brief The number of lanes of the simd vector.
+    static constexpr size_t lanes = simd_traits<simd_t>::length;
+    //!\brief The size of one machine word.
+    static constexpr size_t word_size = sizeof(word_type) * 8;
+    //!\brief Whether the alignment is a semi-global alignment or not.
+    static constexpr bool is_semi_global = traits_t::is_semi_global_type::value;
+    //!\brief Whether the alignment is a global alignment or not.
+    static constexpr bool is_global = !is_semi_global;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Defaulted.
+    pairwise_alignment_edit_distance_vectorised() = default;
+    //!\brief Defaulted.
+    pairwise_alignment_edit_distance_vectorised(pairwise_alignment_edit_distance_vectorised const &) = default;
+    //!\brief Defaulted.
+    pairwise_alignment_edit_distance_vectorised(pairwise_alignment_edit_distance_vectorised &&) = default;
+    //!\brief Defaulted.
+    pairwise_alignment_edit_distance_vectorised & operator=(pairwise_alignment_edit_distance_vectorised const &)
+        = default;
+    //!\brief Defaulted.
+    pairwise_alignment_edit_distance_vectorised & operator=(pairwise_alignment_edit_distance_vectorised &&) = default;
+    //!\brief Defaulted.
+    ~pairwise_alignment_edit_distance_vectorised() = default;
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \details
+     *
+     * Maintains a copy of the configuration object on the heap using a std::shared_ptr.
+     */
+    explicit pairwise_alignment_edit_distance_vectorised(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
+    {}
+    //!\}
+
+    /*!\brief Computes the edit distances of all sequence pairs in the batch.
+     * \tparam    batch_t The type of the batch; must model std::ranges::RandomAccessRange over tuples containing two
+     *                    sequences that model std::ranges::ForwardRange.
+     * \param[in] batch   The batch of sequence pairs.
+     * \returns A std::vector with one seqan3::alignment_result per sequence pair in the order of the batch.
+     *
+     * \details
+     *
+     * The result contains the score and, if requested, the back coordinate of the alignment.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * This function does not modify the state of the algorithm and can be called concurrently.
+     *
+     * ### Complexity
+     *
+     * \f$ O(N \cdot \lceil M/w \rceil) \f$ time per group, where \f$ N \f$ is the length of the longest database
+     * sequence, \f$ M \f$ the length of the longest query of the group and \f$ w \f$ the size of the `word_type`.
+     */
+    template <std::ranges::RandomAccessRange batch_t>
+    auto operator()(batch_t & batch) const
+    {
+        assert(cfg_ptr != nullptr);
+
+        using first_range_t  = std::remove_reference_t<std::tuple_element_t<0, value_type_t<batch_t>>>;
+        using second_range_t = std::remove_reference_t<std::tuple_element_t<1, value_type_t<batch_t>>>;
+        using result_value_t = typename align_result_selector<first_range_t, second_range_t, config_t>::type;
+
+        std::vector<alignment_result<result_value_t>> results(std::ranges::size(batch));
+
+        for (size_t group_begin = 0; group_begin < results.size(); group_begin += lanes)
+            compute_group<result_value_t>(batch, group_begin, results);
+
+        return results;
+    }
+
+private:
+
+    //!\brief Reinterprets the mask returned by a comparison of two simd vectors as simd_t.
+    template <typename mask_t>
+    static constexpr simd_t to_simd(mask_t const & mask) noexcept
+    {
+        return reinterpret_cast<simd_t const &>(mask);
+    }
+
+    //!\brief Selects the lanes of `if_true` where the mask is set and the lanes of `if_false` otherwise.
+    static constexpr simd_t blend(simd_t const & mask, simd_t const & if_true, simd_t const & if_false) noexcept
+    {
+        return (if_true & mask) | (if_false & ~mask);
+    }
+
+    //!\brief One compute step of one block in one column for all lanes.
+    static void compute_step(simd_t const & b,
+                             simd_t & hp,
+                             simd_t & hn,
+                             simd_t & vp,
+                             simd_t & vn,
+                             simd_t & carry_d0,
+                             simd_t & carry_hp,
+                             simd_t & carry_hn) noexcept
+    {
+        simd_t const one = fill<simd_t>(1);
+
+        simd_t x = b | vn;
+        simd_t t = vp + (x & vp) + carry_d0;
+
+        simd_t d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        carry_d0 = blend(to_simd(carry_d0 != fill<simd_t>(0)), to_simd(t <= vp), to_simd(t < vp)) & one;
+
+        x = (hp << 1) | carry_hp;
+        vn = x & d0;
+        vp = (hn << 1) | ~(x | d0) | carry_hn;
+
+        carry_hp = hp >> (word_size - 1);
+        carry_hn = hn >> (word_size - 1);
+    }
+
+    /*!\brief Computes the group starting at `group_begin`.
+     * \tparam result_value_t The type of the alignment result value.
+     * \param[in]  batch       The batch of sequence pairs.
+     * \param[in]  group_begin The position of the first sequence pair of the group.
+     * \param[out] results     The results of the batch.
+     */
+    template <typename result_value_t, typename batch_t, typename results_t>
+    void compute_group(batch_t & batch, size_t const group_begin, results_t & results) const
+    {
+        using std::get;
+        using query_alphabet_t = value_type_t<std::remove_reference_t<std::tuple_element_t<1, value_type_t<batch_t>>>>;
+
+        size_t const group_size = std::min(lanes, results.size() - group_begin);
+
+        // ----------------------------------------------------------------------------
+        // Encode the queries as bit-vectors.
+        // ----------------------------------------------------------------------------
+
+        std::array<size_t, lanes> database_sizes{};
+        std::array<size_t, lanes> query_sizes{};
+        size_t max_database_size = 0;
+        size_t block_count = 1;
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            auto & [database, query] = batch[group_begin + lane];
+            database_sizes[lane] = static_cast<size_t>(std::ranges::distance(database));
+            query_sizes[lane] = static_cast<size_t>(std::ranges::distance(query));
+            max_database_size = std::max(max_database_size, database_sizes[lane]);
+            block_count = std::max(block_count, (query_sizes[lane] + word_size - 1) / word_size);
+        }
+
+        simd_t const zero = fill<simd_t>(0);
+        std::vector<simd_t> bit_masks(alphabet_size_v<query_alphabet_t> * block_count, zero);
+        std::vector<simd_t> score_masks(block_count, zero);
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            size_t pos = 0;
+            for (auto && letter : get<1>(batch[group_begin + lane]))
+            {
+                bit_masks[block_count * to_rank(letter) + pos / word_size][lane] |=
+                    static_cast<word_type>(1) << (pos % word_size);
+                ++pos;
+            }
+
+            // The score is tracked in the last row of the respective query.
+            if (pos > 0)
+                score_masks[(pos - 1) / word_size][lane] = static_cast<word_type>(1) << ((pos - 1) % word_size);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Transpose the database sequences into the inter-sequence layout.
+        // ----------------------------------------------------------------------------
+
+        std::vector<simd_t> database_ranks(max_database_size, zero);
+        bool shared_database = true;
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            size_t pos = 0;
+            for (auto && letter : get<0>(batch[group_begin + lane]))
+                database_ranks[pos++][lane] = to_rank(static_cast<query_alphabet_t>(letter));
+
+            shared_database &= database_sizes[lane] == database_sizes[0];
+        }
+
+        for (size_t pos = 0; shared_database && pos < max_database_size; ++pos)
+            for (size_t lane = 1; lane < group_size; ++lane)
+                shared_database &= database_ranks[pos][lane] == database_ranks[pos][0];
+
+        // ----------------------------------------------------------------------------
+        // Compute the columns.
+        // ----------------------------------------------------------------------------
+
+        simd_t const hp0 = fill<simd_t>(is_global ? 1 : 0);
+        std::vector<simd_t> vp(block_count, ~zero);
+        std::vector<simd_t> vn(block_count, zero);
+
+        simd_t sizes{};
+        simd_t score{};
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            sizes[lane] = database_sizes[lane];
+            score[lane] = query_sizes[lane];
+        }
+
+        simd_t best_score = score;
+        simd_t best_column = zero;
+
+        for (size_t column = 1; column <= max_database_size; ++column)
+        {
+            simd_t const & rank = database_ranks[column - 1];
+            simd_t hp, hn;
+            simd_t carry_d0 = zero;
+            simd_t carry_hp = hp0;
+            simd_t carry_hn = zero;
+
+            for (size_t block = 0; block < block_count; ++block)
+            {
+                simd_t b;
+                if (shared_database)
+                {
+                    b = bit_masks[block_count * rank[0] + block];
+                }
+                else
+                {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        b[lane] = bit_masks[block_count * rank[lane] + block][lane];
+                }
+
+                compute_step(b, hp, hn, vp[block], vn[block], carry_d0, carry_hp, carry_hn);
+
+                // Comparisons yield -1 in every selected lane.
+                score = score - to_simd((hp & score_masks[block]) != zero)
+                              + to_simd((hn & score_masks[block]) != zero);
+            }
+
+            simd_t const current_column = fill<simd_t>(column);
+
+            if constexpr (is_global)
+            {
+                best_score = blend(to_simd(current_column == sizes), score, best_score);
+            }
+            else
+            {
+                simd_t const improved = to_simd(score <= best_score) & to_simd(current_column <= sizes);
+                best_score = blend(improved, score, best_score);
+                best_column = blend(improved, fill<simd_t>(column - 1), best_column);
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+        // Write the results.
+        // ----------------------------------------------------------------------------
+
+        for (size_t lane = 0; lane < group_size; ++lane)
+        {
+            result_value_t res{};
+            using score_t = decltype(res.score);
+
+            // An empty query is aligned by inserting the complete database sequence.
+            if (query_sizes[lane] == 0)
+                best_score[lane] = is_global ? database_sizes[lane] : 0;
+
+            res.score = -static_cast<score_t>(best_score[lane]);
+
+            if constexpr (!std::is_same_v<decltype(res.back_coordinate), std::nullopt_t *>)
+            {
+                // The coordinates of empty sequences are clamped to 0 instead of wrapping around.
+                size_t const column = is_global ? std::max<size_t>(database_sizes[lane], 1) - 1 : best_column[lane];
+                size_t const row = std::max<size_t>(query_sizes[lane], 1) - 1;
+                res.back_coordinate = alignment_coordinate{column_index_type{column}, row_index_type{row}};
+            }
+
+            results[group_begin + lane] = alignment_result{res};
+        }
+    }
+
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<config_t> cfg_ptr{};
+};
+
+} // namespace seqan3::detail
@@ -15,17 +15,43 @@
 #include <functional>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/execution/alignment_range.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
 #include <seqan3/alignment/pairwise/execution/execution_handler_sequential.hpp>
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/view/single_pass_input.hpp>
+#include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
 {
 
+/*!\brief Detects whether the alignment algorithm computes a whole batch of sequence pairs per invocation.
+ * \ingroup execution
+ * \tparam alignment_algorithm_t The type of the alignment algorithm.
+ *
+ * \details
+ *
+ * Resolves to std::true_type if `alignment_algorithm_t` is a std::function that is invoked with a batch of sequence
+ * pairs and returns a std::vector with the results, as configured for seqan3::align_cfg::vectorise.
+ */
+template <typename alignment_algorithm_t>
+struct alignment_batch_kernel_traits : std::false_type
+{};
+
+//!\copydoc seqan3::detail::alignment_batch_kernel_traits
+template <typename result_t, typename batch_t>
+struct alignment_batch_kernel_traits<std::function<std::vector<result_t>(batch_t &)>> : std::true_type
+{
+    //!\brief The result type of a single alignment.
+    using result_type = result_t;
+    //!\brief The type of the batch.
+    using batch_type  = batch_t;
+};
+
 /*!\brief A two way executor for pairwise alignments.
  * \ingroup execution
  * \tparam resource_t            The underlying range of sequence pairs to be computed; must model
@@ -38,6 +64,18 @@ namespace seqan3::detail
  * This alignment executor provides an additional buffer over the computed alignments to allow
  * a two-way execution flow. The alignment results can then be accessed in an order-preserving manner using the
  * alignment_executor_two_way::bump() member function.
+ *
+ * If the seqan3::detail::execution_handler_parallel is used, the buffer is filled with a chunk of alignments that
+ * are computed concurrently. Every result is written to the buffer slot that corresponds to the position of its
+ * sequence pair within the resource, such that the order of the results is still the order of the input.
+ *
+ * If the alignment algorithm computes batches of sequence pairs (see seqan3::detail::alignment_batch_kernel_traits),
+ * the chunk is split into batches of seqan3::detail::alignment_executor_two_way::batch_size many sequence pairs and
+ * every batch is handed to the execution handler as a whole.
+ *
+ * The parallel execution keeps one copy of the alignment algorithm per worker thread. The tasks reference the copy of
+ * the thread that runs them instead of copying the algorithm, and the execution handler is destroyed before the chunk
+ * and the buffer, such that no task outlives the data it accesses.
  */
 template <std::ranges::ViewableRange resource_t,
           typename alignment_algorithm_t,
@@ -56,13 +94,33 @@ private:
     using resource_type       = decltype(view::single_pass_input(std::declval<resource_t>()));
     //!\brief The value type of the resource.
     using resource_value_type = value_type_t<resource_type>;
+    //!\brief The reference type of the resource.
+    using resource_reference  = reference_t<resource_type>;
+    //!\}
+
+    //!\brief Whether the alignments are executed asynchronously.
+    static constexpr bool is_parallel = std::is_same_v<execution_handler_t, execution_handler_parallel>;
+    //!\brief Whether the alignment algorithm computes batches of sequence pairs.
+    static constexpr bool is_batch_kernel = alignment_batch_kernel_traits<alignment_algorithm_t>::value;
+
+    /*!\name Chunk types
+     * \{
+     */
+    //!\brief Stores references to lvalues or the prvalues returned by the resource until the chunk was computed.
+    using chunk_value_type = std::conditional_t<std::is_lvalue_reference_v<resource_reference>,
+                                                std::reference_wrapper<std::remove_reference_t<resource_reference>>,
+                                                remove_cvref_t<resource_reference>>;
+    //!\brief The chunk of sequence pairs that are currently processed.
+    using chunk_type       = std::vector<chunk_value_type>;
     //!\}
 
     /*!\name Buffer types
      * \{
      */
     //!\brief The result of invoking the alignment instance.
-    using buffer_value_type = typename alignment_algorithm_t::result_type;
+    using buffer_value_type = typename std::conditional_t<is_batch_kernel,
+                                                          alignment_batch_kernel_traits<alignment_algorithm_t>,
+                                                          alignment_algorithm_t>::result_type;
     //!\brief The internal buffer.
     using buffer_type       = std::vector<buffer_value_type>;
     //!\brief The pointer type of the buffer.
@@ -94,11 +152,17 @@ public:
     alignment_executor_two_way & operator=(alignment_executor_two_way && ) = default;    //!< Defaulted
     ~alignment_executor_two_way() = default;                                             //!< Defaulted
 
-    //!\brief Constructs this executor with the passed range of alignment instances.
+    /*!\brief Constructs this executor with the passed range of alignment instances.
+     * \param[in] resrc The underlying range of sequence pairs.
+     * \param[in] fn    The alignment algorithm to invoke on every sequence pair.
+     * \param[in] exec  The execution handler; defaults to a default constructed instance of execution_handler_t.
+     */
     alignment_executor_two_way(resource_t && resrc,
-                               alignment_algorithm_t fn) :
+                               alignment_algorithm_t fn,
+                               execution_handler_t exec = execution_handler_t{}) :
         resource{std::forward<resource_t &&>(resrc)},
-        kernel{std::move(fn)}
+        kernel{std::move(fn)},
+        exec_handler{std::move(exec)}
     {
         init_buffer();
     }
@@ -175,13 +239,74 @@ private:
         setg(std::ranges::begin(buffer), std::ranges::end(buffer));
 
         // Apply the alignment execution.
-        // TODO: Adapt for async behavior for parallel execution handler.
         size_t count = 0;
-        for (auto resource_iter = std::ranges::begin(resource);
-             count < in_avail() && !is_eof(); ++count, ++resource_iter, ++gptr)
+        if constexpr (is_parallel || is_batch_kernel)
         {
-            auto && [first_seq, second_seq] = *resource_iter;
-            exec_handler.execute(kernel, first_seq, second_seq, [this](auto && res){ *gptr = std::move(res); });
+            // Keep the sequence pairs alive until all asynchronous executions of this chunk have finished.
+            // The chunk never exceeds the reserved capacity, such that the stored elements are not relocated.
+            chunk.clear();
+            for (auto resource_iter = std::ranges::begin(resource);
+                 count < in_avail() && !is_eof(); ++count, ++resource_iter)
+            {
+                chunk.push_back(*resource_iter);
+            }
+
+            if constexpr (is_batch_kernel)
+            {
+                using batch_type = typename alignment_batch_kernel_traits<alignment_algorithm_t>::batch_type;
+
+                std::vector<batch_type> batches((count + batch_size - 1) / batch_size);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    auto && [first_seq, second_seq] = unwrap(chunk[i]);
+                    batches[i / batch_size].emplace_back(first_seq, second_seq);
+                }
+
+                for (auto & batch : batches)
+                {
+                    exec_handler.execute([] (auto & executor, auto & sequence_pairs)
+                                         {
+                                             return executor.local_kernel()(sequence_pairs);
+                                         },
+                                         *this,
+                                         batch,
+                                         [slot = gptr] (auto && results)
+                    {
+                        std::ranges::move(results, slot);
+                    });
+                    gptr += batch.size();
+                }
+
+                exec_handler.wait();
+            }
+            else
+            {
+                for (auto & chunk_element : chunk)
+                {
+                    auto && [first_seq, second_seq] = unwrap(chunk_element);
+                    exec_handler.execute([this] (auto && first, auto && second)
+                                         {
+                                             return local_kernel()(first, second);
+                                         },
+                                         first_seq,
+                                         second_seq,
+                                         [slot = gptr++] (auto && res)
+                    {
+                        *slot = std::move(res);
+                    });
+                }
+
+                exec_handler.wait();
+            }
+        }
+        else
+        {
+            for (auto resource_iter = std::ranges::begin(resource);
+                 count < in_avail() && !is_eof(); ++count, ++resource_iter, ++gptr)
+            {
+                auto && [first_seq, second_seq] = *resource_iter;
+                exec_handler.execute(kernel, first_seq, second_seq, [this](auto && res){ *gptr = std::move(res); });
+            }
         }
 
         // Update the available get position if the buffer was consumed completely.
@@ -195,31 +320,85 @@ private:
      * \{
      */
 
-    //!\brief Initialises the underlying buffer.
+    //!\brief Initialises the underlying buffer and the copies of the alignment algorithm of the worker threads.
     void init_buffer()
     {
-        buffer.resize(1);
+        if constexpr (is_parallel)
+            worker_kernels.assign(exec_handler.thread_count() + 1, kernel); // the last one is for non-worker threads
+
+        if constexpr (is_batch_kernel)
+        {
+            if constexpr (is_parallel)
+                buffer.resize(exec_handler.thread_count() * batch_factor * batch_size);
+            else
+                buffer.resize(batch_size);
+
+            chunk.reserve(buffer.size());
+        }
+        else if constexpr (is_parallel)
+        {
+            buffer.resize(exec_handler.thread_count() * chunk_factor);
+            chunk.reserve(buffer.size());
+        }
+        else
+        {
+            buffer.resize(1);
+        }
+
         setg(std::ranges::end(buffer), std::ranges::end(buffer));
     }
+
+    /*!\brief Returns the copy of the alignment algorithm that belongs to the calling thread.
+     * \details In parallel mode, threads that are not workers of the execution handler share the last copy.
+     */
+    alignment_algorithm_t & local_kernel() noexcept
+    {
+        if constexpr (is_parallel)
+            return worker_kernels[exec_handler.worker_index()];
+        else
+            return kernel;
+    }
+
+    //!\brief Returns the sequence pair stored in the chunk.
+    template <typename chunk_element_t>
+    static constexpr decltype(auto) unwrap(chunk_element_t & element) noexcept
+    {
+        if constexpr (std::is_lvalue_reference_v<resource_reference>)
+            return element.get();
+        else
+            return (element);
+    }
     //!\}
 
+    //!\brief The number of alignments buffered per thread of the parallel execution handler.
+    static constexpr size_t chunk_factor{8};
+    //!\brief The number of sequence pairs passed to one invocation of a batch kernel.
+    static constexpr size_t batch_size{64};
+    //!\brief The number of batches buffered per thread of the parallel execution handler.
+    static constexpr size_t batch_factor{2};
+
     //!\brief Indicates the end-of-stream.
     static constexpr size_t eof{std::numeric_limits<size_t>::max()};
 
-    //!\brief The execution policy.
-    execution_handler_t exec_handler{};
-
     //!\brief The underlying resource containing the alignment instances.
     resource_type resource{};
     //!\brief Selects the correct alignment to execute.
     alignment_algorithm_t kernel{};
+    //!\brief One copy of the alignment algorithm per worker thread (only used for parallel execution).
+    std::vector<alignment_algorithm_t> worker_kernels{};
 
+    //!\brief The sequence pairs of the currently executed chunk (only used for parallel or batch execution).
+    chunk_type chunk{};
     //!\brief The buffer storing the alignment results.
     buffer_type buffer{};
     //!\brief The get pointer in the buffer.
     buffer_pointer gptr{};
     //!\brief The end get pointer in the buffer.
     buffer_pointer egptr{};
+
+    //!\brief The execution policy; declared last, such that pending tasks are finished before any other member is
+    //!       destroyed.
+    execution_handler_t exec_handler{};
 };
 
 /*!\name Type deduction guides
@@ -230,5 +409,10 @@ template <typename resource_rng_t, typename func_t>
 alignment_executor_two_way(resource_rng_t &&, func_t) ->
     alignment_executor_two_way<resource_rng_t, func_t, execution_handler_sequential>;
 
+//!\brief Deduces the execution handler from the third argument.
+template <typename resource_rng_t, typename func_t, typename exec_handler_t>
+alignment_executor_two_way(resource_rng_t &&, func_t, exec_handler_t) ->
+    alignment_executor_two_way<resource_rng_t, func_t, exec_handler_t>;
+
 //!\}
 } // namespace seqan3::detail
@@ -0,0 +1,272 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_parallel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/contrib/parallel/spin_delay.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of alignments.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * This execution handler owns a fixed set of worker threads that are spawned on construction and joined on
+ * destruction. Every call to seqan3::detail::execution_handler_parallel::execute enqueues one alignment task into a
+ * concurrent queue from which the workers fetch the next job as soon as they become idle. Hence, the load is
+ * balanced dynamically between the threads. The call to execute does not block, so the caller must
+ * invoke seqan3::detail::execution_handler_parallel::wait before it accesses the results written by the delegates or
+ * destroys the sequences that were passed to execute.
+ *
+ * Callables passed as lvalues are referenced by the task and callables passed as rvalues are moved into it; none of
+ * them is copied. A referenced callable is shared by all workers that run its tasks, so it must be safe to invoke
+ * concurrently. Callers that need one instance per thread can select it with
+ * seqan3::detail::execution_handler_parallel::worker_index, which reserves the index thread_count() for threads
+ * that are not workers of the handler. Exceptions thrown inside of a task are captured and the first one is rethrown
+ * by the next call to wait.
+ */
+class execution_handler_parallel
+{
+private:
+    //!\brief The type of the tasks stored in the queue.
+    using task_type = std::function<void()>;
+
+    //!\brief The shared state between the handler and the worker threads.
+    struct state_type
+    {
+        //!\brief Constructs the state with the given queue capacity.
+        explicit state_type(size_t const capacity) : queue{capacity}
+        {}
+
+        //!\brief The queue of pending tasks.
+        contrib::fixed_buffer_queue<task_type> queue;
+        //!\brief The number of enqueued tasks that did not finish yet.
+        std::atomic<size_t> pending_tasks{0};
+        //!\brief Guards the access to the captured exception.
+        std::mutex exception_mutex{};
+        //!\brief The first exception thrown by any task.
+        std::exception_ptr exception{};
+    };
+
+public:
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is not copy-constructible or copy-assignable but allows move construction and assignment.
+     * \{
+     */
+    execution_handler_parallel(execution_handler_parallel const &) = delete;             //!< This is a move-only type.
+    execution_handler_parallel(execution_handler_parallel &&) = default;                 //!< Defaulted
+    execution_handler_parallel & operator=(execution_handler_parallel const &) = delete; //!< This is a move-only type.
+
+    //!\brief Move assignment; the worker threads of this handler are joined when `other` is destroyed.
+    execution_handler_parallel & operator=(execution_handler_parallel && other) noexcept
+    {
+        std::swap(state, other.state);
+        std::swap(workers, other.workers);
+        return *this;
+    }
+
+    /*!\brief Constructs the execution handler and spawns the worker threads.
+     * \param thread_count The number of worker threads; a value of `0` is replaced by
+     *                     `std::thread::hardware_concurrency()` (or 1 if this cannot be determined).
+     */
+    explicit execution_handler_parallel(size_t const thread_count)
+    {
+        size_t const num_threads = (thread_count == 0) ? std::max<size_t>(std::thread::hardware_concurrency(), 1u)
+                                                       : thread_count;
+
+        state = std::make_unique<state_type>(num_threads * queue_factor);
+        workers.reserve(num_threads);
+
+        auto * shared_state = state.get();
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            workers.emplace_back([shared_state, i] ()
+            {
+                current_worker_state = shared_state;
+                current_worker_index = i;
+
+                task_type task{};
+                while (shared_state->queue.wait_pop(task) != contrib::queue_op_status::closed)
+                {
+                    task();
+                    task = task_type{};
+                    --shared_state->pending_tasks;
+                }
+            });
+        }
+    }
+
+    //!\brief Default construction uses as many threads as the hardware supports.
+    execution_handler_parallel() : execution_handler_parallel{std::thread::hardware_concurrency()}
+    {}
+
+    //!\brief Waits for all pending tasks, closes the queue and joins the worker threads.
+    ~execution_handler_parallel()
+    {
+        if (state == nullptr) // moved-from
+            return;
+
+        wait_for_pending_tasks();
+        state->queue.close();
+
+        for (auto & worker : workers)
+            if (worker.joinable())
+                worker.join();
+    }
+    //!\}
+
+    /*!\name Execution
+     * \{
+     */
+    /*!\brief Asynchronously invokes the passed alignment instance on one of the worker threads.
+     * \tparam fn_type           The callable that needs to be invoked; must model std::Invocable with first_range_type
+     *                           and second_range_type.
+     * \tparam first_range_type  The type of the first range.
+     * \tparam second_range_type The type of the second range.
+     * \tparam delegate_type     The type of the callable invoked on the std::invoke_result of `fn_type`; must model
+     *                           std::Invocable.
+     *
+     * \param[in] func         The callable invoking the alignment algorithm. An lvalue must stay valid until wait()
+     *                         returns; an rvalue is moved into the task.
+     * \param[in] first_range  The first range. Must stay valid until wait() returns.
+     * \param[in] second_range The second range. Must stay valid until wait() returns.
+     * \param[in] delegate     The callable invoked with the result of the alignment. An lvalue must stay valid until
+     *                         wait() returns; an rvalue is moved into the task.
+     *
+     * \details
+     *
+     * The function returns immediately after the task was enqueued. If the queue is full, the calling thread waits
+     * until a slot becomes available.
+     */
+    template <typename fn_type, typename first_range_type, typename second_range_type, typename delegate_type>
+    //!\cond
+        requires std::Invocable<fn_type, first_range_type, second_range_type> &&
+                 std::Invocable<delegate_type, std::invoke_result_t<fn_type, first_range_type, second_range_type>>
+    //!\endcond
+    void execute(fn_type && func,
+                 first_range_type && first_range,
+                 second_range_type && second_range,
+                 delegate_type && delegate)
+    {
+        assert(state != nullptr);
+
+        ++state->pending_tasks;
+
+        auto * shared_state = state.get();
+        state->queue.push([shared_state,
+                           fn = stored_callable_t<fn_type>{std::forward<fn_type>(func)},
+                           callback = stored_callable_t<delegate_type>{std::forward<delegate_type>(delegate)},
+                           first = std::addressof(first_range),
+                           second = std::addressof(second_range)] () mutable
+        {
+            try
+            {
+                std::invoke(callback, std::invoke(fn,
+                                                  static_cast<first_range_type &&>(*first),
+                                                  static_cast<second_range_type &&>(*second)));
+            }
+            catch (...)
+            {
+                std::lock_guard lock{shared_state->exception_mutex};
+                if (!shared_state->exception)
+                    shared_state->exception = std::current_exception();
+            }
+        });
+    }
+
+    /*!\brief Blocks until all enqueued tasks have been finished.
+     * \throws Rethrows the first exception that was thrown by any of the finished tasks.
+     */
+    void wait()
+    {
+        assert(state != nullptr);
+
+        wait_for_pending_tasks();
+
+        if (state->exception)
+        {
+            std::exception_ptr ex{};
+            std::swap(ex, state->exception);
+            std::rethrow_exception(ex);
+        }
+    }
+
+    //!\brief Returns the number of worker threads.
+    size_t thread_count() const noexcept
+    {
+        return workers.size();
+    }
+
+    /*!\brief Returns the index of the calling worker thread within [0, thread_count()).
+     *
+     * \details
+     *
+     * Returns thread_count() if the calling thread is not a worker of this handler, e.g. the thread that calls
+     * execute or a worker of another handler. Callers that keep one instance per worker can reserve this additional
+     * slot for such threads.
+     */
+    size_t worker_index() const noexcept
+    {
+        assert(state != nullptr);
+
+        return (current_worker_state == state.get()) ? current_worker_index : thread_count();
+    }
+    //!\}
+
+private:
+
+    //!\brief Stores lvalue callables by reference and rvalue callables by value.
+    template <typename callable_t>
+    using stored_callable_t = std::conditional_t<std::is_lvalue_reference_v<callable_t>,
+                                                 std::reference_wrapper<std::remove_reference_t<callable_t>>,
+                                                 remove_cvref_t<callable_t>>;
+
+    //!\brief Spins until the number of pending tasks dropped to zero.
+    void wait_for_pending_tasks()
+    {
+        contrib::spin_delay delay{};
+        while (state->pending_tasks.load() > 0)
+            delay.wait();
+    }
+
+    //!\brief The capacity of the task queue relative to the number of threads.
+    static constexpr size_t queue_factor{4};
+
+    //!\brief The state shared with the worker threads; allocated on the heap to keep the handler movable.
+    std::unique_ptr<state_type> state{};
+    //!\brief The worker threads.
+    std::vector<std::thread> workers{};
+
+    //!\brief The state of the handler that owns the calling thread, or `nullptr` if the thread is not a worker.
+    static inline thread_local state_type const * current_worker_state{nullptr};
+    //!\brief The index of the worker thread; set once when the worker is spawned.
+    static inline thread_local size_t current_worker_index{0};
+};
+
+} // namespace seqan3::detail
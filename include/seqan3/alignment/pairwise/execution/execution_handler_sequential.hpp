@@ -55,6 +55,10 @@ public:
     {
         delegate(func(std::forward<first_range_type>(first_range), std::forward<second_range_type>(second_range)));
     }
+
+    //!\brief Waits for all pending executions. This is a no-op since every execution is blocking.
+    constexpr void wait() noexcept
+    {}
     //!\}
 };
 
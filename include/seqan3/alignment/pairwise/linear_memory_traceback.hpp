@@ -0,0 +1,552 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::affine_linear_memory_traceback.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/policy/unbanded_score_trace_dp_matrix_policy.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the traceback of an affine alignment in memory linear in the length of the sequences.
+ * \ingroup pairwise_alignment
+ * \tparam scoring_scheme_t The type of the scoring scheme.
+ * \tparam score_t          The score type.
+ *
+ * \details
+ *
+ * Given the back coordinate of an optimal alignment, the traceback is computed in two steps:
+ *
+ * 1. If the alignment may start anywhere in the first row, the first column or, for local alignments, anywhere in
+ *    the matrix, the front coordinate is determined by a single backward pass that is anchored in the back
+ *    coordinate and keeps only one column in memory.
+ * 2. The global alignment between the front and the back coordinate is computed with the divide and conquer
+ *    algorithm of Myers and Miller, i.e. the affine version of Hirschberg's algorithm. The matrix is recursively split
+ *    at its middle column. A forward and a backward pass over the respective halves determine the row in which an
+ *    optimal alignment crosses the middle column, such that only the gap segments of the alignment and a constant
+ *    number of matrix columns need to be stored. Sub-problems whose matrix contains at most as many cells as given on
+ *    construction (seqan3::detail::affine_linear_memory_traceback::default_base_case_cells by default) are solved
+ *    with the full matrix.
+ *
+ * The algorithm runs in \f$ O(N*M) \f$ time (about twice the work of the full traceback) and \f$ O(N+M) \f$ space.
+ * If several optimal alignments exist, the returned alignment might differ from the one returned by the traceback
+ * over the full matrix, but it always has the same optimal score.
+ */
+template <typename scoring_scheme_t, typename score_t>
+class affine_linear_memory_traceback
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    affine_linear_memory_traceback() = delete;                                                   //!< Deleted
+    affine_linear_memory_traceback(affine_linear_memory_traceback const &) = default;             //!< Defaulted
+    affine_linear_memory_traceback(affine_linear_memory_traceback &&) = default;                  //!< Defaulted
+    affine_linear_memory_traceback & operator=(affine_linear_memory_traceback const &) = default; //!< Defaulted
+    affine_linear_memory_traceback & operator=(affine_linear_memory_traceback &&) = default;      //!< Defaulted
+    ~affine_linear_memory_traceback() = default;                                                  //!< Defaulted
+
+    /*!\brief Constructs the traceback algorithm.
+     * \param scheme          The scoring scheme used to score two letters. Must outlive this object.
+     * \param gap_open        The score for opening a gap, i.e. the gap open score plus the gap score.
+     * \param gap_extend      The score for extending a gap.
+     * \param base_case_cells The maximal number of cells of a sub-problem that is solved with the full dynamic
+     *                        programming matrix.
+     */
+    affine_linear_memory_traceback(scoring_scheme_t const & scheme,
+                                   score_t const gap_open,
+                                   score_t const gap_extend,
+                                   size_t const base_case_cells = default_base_case_cells) noexcept :
+        scoring_scheme{&scheme},
+        gap_open{gap_open},
+        gap_extend{gap_extend},
+        base_case_cells{base_case_cells}
+    {}
+    //!\}
+
+    /*!\brief Computes the front coordinate and the gap segments of an optimal alignment ending in the back coordinate.
+     * \tparam first_range_t  The type of the first sequence; must model std::ranges::ForwardRange.
+     * \tparam second_range_t The type of the second sequence; must model std::ranges::ForwardRange.
+     * \param[in] first_range         The first sequence.
+     * \param[in] second_range        The second sequence.
+     * \param[in] back_coordinate     The back coordinate of the alignment.
+     * \param[in] free_first_leading  Whether the alignment may start anywhere in the first row.
+     * \param[in] free_second_leading Whether the alignment may start anywhere in the first column.
+     * \param[in] is_local            Whether the alignment may start in any cell of the matrix.
+     *
+     * \returns A tuple containing the front coordinate and the seqan3::detail::gap_segment s for the first and the
+     *          second sequence in the same format as returned by
+     *          seqan3::detail::unbanded_score_trace_dp_matrix_policy::parse_traceback.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    auto operator()(first_range_t & first_range,
+                    second_range_t & second_range,
+                    alignment_coordinate const & back_coordinate,
+                    bool const free_first_leading,
+                    bool const free_second_leading,
+                    bool const is_local)
+    {
+        // Keep the prefixes that end in the back coordinate in random access containers.
+        std::vector<value_type_t<first_range_t>> first_prefix{};
+        first_prefix.reserve(back_coordinate.first);
+        for (auto it = std::ranges::begin(first_range); first_prefix.size() < back_coordinate.first; ++it)
+            first_prefix.push_back(*it);
+
+        std::vector<value_type_t<second_range_t>> second_prefix{};
+        second_prefix.reserve(back_coordinate.second);
+        for (auto it = std::ranges::begin(second_range); second_prefix.size() < back_coordinate.second; ++it)
+            second_prefix.push_back(*it);
+
+        alignment_coordinate front_coordinate{column_index_type{0u}, row_index_type{0u}};
+        if (free_first_leading || free_second_leading || is_local)
+            front_coordinate = find_front_coordinate(first_prefix, second_prefix,
+                                                     free_first_leading, free_second_leading, is_local);
+
+        first_segments.clear();
+        second_segments.clear();
+        current_column = front_coordinate.first;
+        current_row = front_coordinate.second;
+        last_move = trace_move::diagonal;
+
+        compute_alignment(std::ranges::begin(first_prefix) + front_coordinate.first,
+                          std::ranges::begin(first_prefix) + back_coordinate.first,
+                          std::ranges::begin(second_prefix) + front_coordinate.second,
+                          std::ranges::begin(second_prefix) + back_coordinate.second,
+                          false,
+                          false);
+
+        assert(current_column == back_coordinate.first);
+        assert(current_row == back_coordinate.second);
+
+        return std::tuple{front_coordinate, first_segments, second_segments};
+    }
+
+    //!\brief The default maximal number of cells of a sub-problem that is solved with the full matrix.
+    static constexpr size_t default_base_case_cells{1024};
+
+private:
+
+    //!\brief The moves within the alignment matrix.
+    enum struct trace_move : uint8_t
+    {
+        diagonal,   //!< Aligns two letters.
+        vertical,   //!< Aligns a letter of the second sequence with a gap.
+        horizontal  //!< Aligns a letter of the first sequence with a gap.
+    };
+
+    //!\brief A score that can never be part of an optimal alignment but does not overflow if a gap score is added.
+    static constexpr score_t minus_infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+    /*!\brief Determines the front coordinate with a backward pass anchored in the back coordinate.
+     * \param[in] first_prefix        The first sequence up to the back coordinate.
+     * \param[in] second_prefix       The second sequence up to the back coordinate.
+     * \param[in] free_first_leading  Whether the alignment may start anywhere in the first row.
+     * \param[in] free_second_leading Whether the alignment may start anywhere in the first column.
+     * \param[in] is_local            Whether the alignment may start in any cell of the matrix.
+     *
+     * \details
+     *
+     * Among all admissible front coordinates the one with the best score is returned. Ties are broken in favour of
+     * the coordinate that is closest to the back coordinate.
+     */
+    template <typename first_prefix_t, typename second_prefix_t>
+    alignment_coordinate find_front_coordinate(first_prefix_t const & first_prefix,
+                                               second_prefix_t const & second_prefix,
+                                               bool const free_first_leading,
+                                               bool const free_second_leading,
+                                               bool const is_local) const
+    {
+        size_t const columns = first_prefix.size();
+        size_t const rows = second_prefix.size();
+
+        score_t best_score = std::numeric_limits<score_t>::lowest();
+        alignment_coordinate best{column_index_type{columns}, row_index_type{rows}};
+
+        // Columns and rows are counted from the back coordinate towards the origin.
+        auto check = [&] (size_t const column, size_t const row, score_t const score)
+        {
+            bool const admissible = is_local ||
+                                    (free_first_leading && row == rows) ||
+                                    (free_second_leading && column == columns) ||
+                                    (row == rows && column == columns);
+
+            if (admissible && score > best_score)
+            {
+                best_score = score;
+                best = alignment_coordinate{column_index_type{columns - column}, row_index_type{rows - row}};
+            }
+        };
+
+        compute_columns(std::make_reverse_iterator(std::ranges::end(first_prefix)),
+                        std::make_reverse_iterator(std::ranges::begin(first_prefix)),
+                        std::make_reverse_iterator(std::ranges::end(second_prefix)),
+                        std::make_reverse_iterator(std::ranges::begin(second_prefix)),
+                        false,
+                        check);
+
+        return best;
+    }
+
+    /*!\brief Computes the dynamic programming matrix column by column in linear memory.
+     * \param[in] first_begin    The begin of the first sequence.
+     * \param[in] first_end      The end of the first sequence.
+     * \param[in] second_begin   The begin of the second sequence.
+     * \param[in] second_end     The end of the second sequence.
+     * \param[in] free_gap_begin Whether a horizontal gap starting in the origin is not charged with the gap open
+     *                           score.
+     * \param[in] on_cell        A callable invoked with the column index, the row index and the score of every cell.
+     * \returns A pair with the last column of the main matrix and the last column of the horizontal gap matrix.
+     */
+    template <typename first_it_t, typename second_it_t, typename on_cell_t>
+    std::pair<std::vector<score_t>, std::vector<score_t>> compute_columns(first_it_t first_begin,
+                                                                          first_it_t first_end,
+                                                                          second_it_t second_begin,
+                                                                          second_it_t second_end,
+                                                                          bool const free_gap_begin,
+                                                                          on_cell_t && on_cell) const
+    {
+        size_t const rows = std::distance(second_begin, second_end);
+
+        std::vector<score_t> main_column(rows + 1);
+        std::vector<score_t> horizontal_column(rows + 1, minus_infinity);
+        std::vector<score_t> vertical_column(rows + 1, minus_infinity);
+
+        // Initialise the first column.
+        main_column[0] = 0;
+        on_cell(0u, 0u, main_column[0]);
+        for (size_t row = 1; row <= rows; ++row)
+        {
+            vertical_column[row] = (row == 1) ? gap_open : vertical_column[row - 1] + gap_extend;
+            main_column[row] = vertical_column[row];
+            on_cell(0u, row, main_column[row]);
+        }
+
+        score_t const first_horizontal = free_gap_begin ? gap_extend : gap_open;
+        size_t column = 1;
+        for (auto first_it = first_begin; first_it != first_end; ++first_it, ++column)
+        {
+            score_t diagonal = main_column[0];
+            horizontal_column[0] = (column == 1) ? first_horizontal : horizontal_column[0] + gap_extend;
+            main_column[0] = horizontal_column[0];
+            vertical_column[0] = minus_infinity;
+            on_cell(column, 0u, main_column[0]);
+
+            size_t row = 1;
+            for (auto second_it = second_begin; second_it != second_end; ++second_it, ++row)
+            {
+                horizontal_column[row] = std::max<score_t>(horizontal_column[row] + gap_extend,
+                                                           main_column[row] + gap_open);
+                vertical_column[row] = std::max<score_t>(vertical_column[row - 1] + gap_extend,
+                                                         main_column[row - 1] + gap_open);
+
+                score_t const next_diagonal = main_column[row];
+                main_column[row] = std::max<score_t>({diagonal + scoring_scheme->score(*first_it, *second_it),
+                                                      vertical_column[row],
+                                                      horizontal_column[row]});
+                diagonal = next_diagonal;
+                on_cell(column, row, main_column[row]);
+            }
+        }
+
+        return {std::move(main_column), std::move(horizontal_column)};
+    }
+
+    /*!\brief Computes the global alignment of two infixes and records its moves.
+     * \param[in] first_begin    The begin of the first infix.
+     * \param[in] first_end      The end of the first infix.
+     * \param[in] second_begin   The begin of the second infix.
+     * \param[in] second_end     The end of the second infix.
+     * \param[in] free_gap_begin Whether a horizontal gap at the beginning is not charged with the gap open score.
+     * \param[in] free_gap_end   Whether a horizontal gap at the end is not charged with the gap open score.
+     *
+     * \details
+     *
+     * The gap open score is waived for horizontal gaps at the borders of the sub-problem if these gaps continue a gap
+     * of the neighbouring sub-problem. This is needed if the optimal alignment crosses the middle column within a
+     * horizontal gap.
+     */
+    template <typename first_it_t, typename second_it_t>
+    void compute_alignment(first_it_t first_begin,
+                           first_it_t first_end,
+                           second_it_t second_begin,
+                           second_it_t second_end,
+                           bool const free_gap_begin,
+                           bool const free_gap_end)
+    {
+        size_t const columns = std::distance(first_begin, first_end);
+        size_t const rows = std::distance(second_begin, second_end);
+
+        if (columns <= 1 || (columns + 1) * (rows + 1) <= base_case_cells)
+        {
+            compute_base_case(first_begin, first_end, second_begin, second_end, free_gap_begin, free_gap_end);
+            return;
+        }
+
+        auto first_middle = first_begin + columns / 2;
+        auto ignore_cell = [] (size_t, size_t, score_t) {};
+
+        auto [forward_main, forward_horizontal] = compute_columns(first_begin, first_middle,
+                                                                second_begin, second_end,
+                                                                free_gap_begin, ignore_cell);
+
+        auto [backward_main, backward_horizontal] = compute_columns(std::make_reverse_iterator(first_end),
+                                                                  std::make_reverse_iterator(first_middle),
+                                                                  std::make_reverse_iterator(second_end),
+                                                                  std::make_reverse_iterator(second_begin),
+                                                                  free_gap_end, ignore_cell);
+
+        // Find the row in which the optimal alignment crosses the middle column.
+        size_t split_row = 0;
+        bool split_in_gap = false;
+        score_t best_score = std::numeric_limits<score_t>::lowest();
+        for (size_t row = 0; row <= rows; ++row)
+        {
+            score_t const score = forward_main[row] + backward_main[rows - row];
+            if (score > best_score)
+            {
+                best_score = score;
+                split_row = row;
+                split_in_gap = false;
+            }
+
+            // Both halves charged the gap open score for the same horizontal gap.
+            score_t const gap_score = forward_horizontal[row] + backward_horizontal[rows - row] -
+                                      gap_open + gap_extend;
+            if (gap_score > best_score)
+            {
+                best_score = gap_score;
+                split_row = row;
+                split_in_gap = true;
+            }
+        }
+
+        if (split_in_gap)
+        {
+            // The horizontal gap spans from the column before to the column after the middle column.
+            compute_alignment(first_begin, first_middle - 1,
+                              second_begin, second_begin + split_row,
+                              free_gap_begin, true);
+            record(trace_move::horizontal);
+            record(trace_move::horizontal);
+            compute_alignment(first_middle + 1, first_end,
+                              second_begin + split_row, second_end,
+                              true, free_gap_end);
+        }
+        else
+        {
+            compute_alignment(first_begin, first_middle,
+                              second_begin, second_begin + split_row,
+                              free_gap_begin, false);
+            compute_alignment(first_middle, first_end,
+                              second_begin + split_row, second_end,
+                              false, free_gap_end);
+        }
+    }
+
+    /*!\brief Computes the global alignment of two short infixes with the full dynamic programming matrix.
+     * \copydetails compute_alignment
+     */
+    template <typename first_it_t, typename second_it_t>
+    void compute_base_case(first_it_t first_begin,
+                           first_it_t first_end,
+                           second_it_t second_begin,
+                           second_it_t second_end,
+                           bool const free_gap_begin,
+                           bool const free_gap_end)
+    {
+        size_t const columns = std::distance(first_begin, first_end);
+        size_t const rows = std::distance(second_begin, second_end);
+        size_t const height = rows + 1;
+
+        // The full matrices stored in column major order.
+        std::vector<score_t> main_matrix((columns + 1) * height);
+        std::vector<score_t> horizontal_matrix((columns + 1) * height, minus_infinity);
+        std::vector<score_t> vertical_matrix((columns + 1) * height, minus_infinity);
+
+        auto at = [height] (size_t const column, size_t const row) { return column * height + row; };
+
+        main_matrix[0] = 0;
+        for (size_t row = 1; row <= rows; ++row)
+        {
+            vertical_matrix[at(0, row)] = (row == 1) ? gap_open : vertical_matrix[at(0, row - 1)] + gap_extend;
+            main_matrix[at(0, row)] = vertical_matrix[at(0, row)];
+        }
+
+        score_t const first_horizontal = free_gap_begin ? gap_extend : gap_open;
+        auto first_it = first_begin;
+        for (size_t column = 1; column <= columns; ++column, ++first_it)
+        {
+            horizontal_matrix[at(column, 0)] = (column == 1) ? first_horizontal
+                                                             : horizontal_matrix[at(column - 1, 0)] + gap_extend;
+            main_matrix[at(column, 0)] = horizontal_matrix[at(column, 0)];
+
+            auto second_it = second_begin;
+            for (size_t row = 1; row <= rows; ++row, ++second_it)
+            {
+                horizontal_matrix[at(column, row)] =
+                    std::max<score_t>(horizontal_matrix[at(column - 1, row)] + gap_extend,
+                                      main_matrix[at(column - 1, row)] + gap_open);
+                vertical_matrix[at(column, row)] =
+                    std::max<score_t>(vertical_matrix[at(column, row - 1)] + gap_extend,
+                                      main_matrix[at(column, row - 1)] + gap_open);
+                main_matrix[at(column, row)] =
+                    std::max<score_t>({main_matrix[at(column - 1, row - 1)] +
+                                           scoring_scheme->score(*first_it, *second_it),
+                                       vertical_matrix[at(column, row)],
+                                       horizontal_matrix[at(column, row)]});
+            }
+        }
+
+        // Collect the moves from the back to the front.
+        std::vector<trace_move> moves{};
+        size_t column = columns;
+        size_t row = rows;
+
+        // A horizontal gap ending in the last cell might continue in the next sub-problem.
+        if (free_gap_end && columns > 0)
+        {
+            // Horizontal gap scores within the last row if the gap open score is waived at the end.
+            std::vector<score_t> end_gap(columns + 1, minus_infinity);
+            for (size_t c = 1; c <= columns; ++c)
+                end_gap[c] = std::max<score_t>(end_gap[c - 1], main_matrix[at(c - 1, rows)]) + gap_extend;
+
+            if (end_gap[columns] > main_matrix[at(columns, rows)])
+            {
+                // Follow the gap until it was started from the main matrix.
+                while (end_gap[column] != main_matrix[at(column - 1, rows)] + gap_extend)
+                {
+                    moves.push_back(trace_move::horizontal);
+                    --column;
+                }
+                moves.push_back(trace_move::horizontal);
+                --column;
+            }
+        }
+
+        enum struct matrix_state : uint8_t { main, horizontal, vertical };
+        matrix_state state = matrix_state::main;
+
+        while (column > 0 && row > 0)
+        {
+            size_t const cell = at(column, row);
+            if (state == matrix_state::main)
+            {
+                first_it_t letter_first = first_begin + (column - 1);
+                second_it_t letter_second = second_begin + (row - 1);
+                if (main_matrix[cell] == main_matrix[at(column - 1, row - 1)] +
+                                         scoring_scheme->score(*letter_first, *letter_second))
+                {
+                    moves.push_back(trace_move::diagonal);
+                    --column;
+                    --row;
+                }
+                else if (main_matrix[cell] == vertical_matrix[cell])
+                {
+                    state = matrix_state::vertical;
+                }
+                else
+                {
+                    assert(main_matrix[cell] == horizontal_matrix[cell]);
+                    state = matrix_state::horizontal;
+                }
+            }
+            else if (state == matrix_state::vertical)
+            {
+                if (vertical_matrix[cell] == main_matrix[at(column, row - 1)] + gap_open)
+                    state = matrix_state::main;
+                moves.push_back(trace_move::vertical);
+                --row;
+            }
+            else
+            {
+                if (horizontal_matrix[cell] == main_matrix[at(column - 1, row)] + gap_open)
+                    state = matrix_state::main;
+                moves.push_back(trace_move::horizontal);
+                --column;
+            }
+        }
+
+        // The remaining moves are gaps along the first row or the first column.
+        moves.insert(moves.end(), column, trace_move::horizontal);
+        moves.insert(moves.end(), row, trace_move::vertical);
+
+        for (auto it = moves.rbegin(); it != moves.rend(); ++it)
+            record(*it);
+    }
+
+    /*!\brief Records the next move of the alignment and updates the gap segments.
+     * \param[in] next The next move.
+     */
+    void record(trace_move const next)
+    {
+        switch (next)
+        {
+            case trace_move::vertical:
+            {
+                if (last_move == trace_move::vertical && !first_segments.empty())
+                    ++first_segments.back().size;
+                else
+                    first_segments.push_back(gap_segment{current_column, 1u});
+                ++current_row;
+                break;
+            }
+            case trace_move::horizontal:
+            {
+                if (last_move == trace_move::horizontal && !second_segments.empty())
+                    ++second_segments.back().size;
+                else
+                    second_segments.push_back(gap_segment{current_row, 1u});
+                ++current_column;
+                break;
+            }
+            default:
+            {
+                ++current_column;
+                ++current_row;
+            }
+        }
+
+        last_move = next;
+    }
+
+    //!\brief The scoring scheme.
+    scoring_scheme_t const * scoring_scheme{nullptr};
+    //!\brief The score for opening a gap including the score for the first gap character.
+    score_t gap_open{};
+    //!\brief The score for extending a gap.
+    score_t gap_extend{};
+    //!\brief The maximal number of cells of a sub-problem that is solved with the full dynamic programming matrix.
+    size_t base_case_cells{default_base_case_cells};
+
+    //!\brief The gap segments of the first sequence.
+    std::deque<gap_segment> first_segments{};
+    //!\brief The gap segments of the second sequence.
+    std::deque<gap_segment> second_segments{};
+    //!\brief The column of the last recorded move.
+    size_t current_column{};
+    //!\brief The row of the last recorded move.
+    size_t current_row{};
+    //!\brief The last recorded move.
+    trace_move last_move{trace_move::diagonal};
+};
+
+} // namespace seqan3::detail
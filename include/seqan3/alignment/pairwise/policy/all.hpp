@@ -21,6 +21,7 @@
 #include <seqan3/alignment/pairwise/policy/banded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/banded_score_trace_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/find_optimum_policy.hpp>
+#include <seqan3/alignment/pairwise/policy/simd_affine_gap_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_trace_dp_matrix_policy.hpp>
 
@@ -120,6 +121,7 @@
  * ### Existing gap policies:
  *
  *  - seqan3::detail::affine_gap_policy
+ *  - seqan3::detail::simd_affine_gap_policy (used by seqan3::detail::alignment_algorithm_vectorised)
  *
  * The following table displays requirements for the corresponding gap intialisation policy:
  *
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_affine_gap_policy.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+// ----------------------------------------------------------------------------
+// simd_affine_gap_policy
+// ----------------------------------------------------------------------------
+
+/*!\brief The hot kernel implementation using affine gaps for the inter-sequence vectorised alignment.
+ * \ingroup alignment_policy
+ * \tparam derived_t     The derived alignment algorithm.
+ * \tparam align_local_t A std::bool_constant indicating whether a local alignment is computed.
+ *
+ * \details
+ *
+ * This policy implements the same recursion as seqan3::detail::affine_gap_policy, but every score is a
+ * seqan3::simd::simd_type, where each lane belongs to a different sequence pair. Since only the score is computed,
+ * the kernel is branch-free and uses only element-wise additions, comparisons and bit-wise blends.
+ */
+template <typename derived_t, typename align_local_t = std::false_type>
+class simd_affine_gap_policy
+{
+private:
+
+    //!\brief Befriends the derived class to grant it access to the private members.
+    friend derived_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief Defaulted all standard constructor.
+     * \{
+     */
+    constexpr simd_affine_gap_policy() noexcept = default;                                           //!< Defaulted
+    constexpr simd_affine_gap_policy(simd_affine_gap_policy const &) noexcept = default;             //!< Defaulted
+    constexpr simd_affine_gap_policy(simd_affine_gap_policy &&) noexcept = default;                  //!< Defaulted
+    constexpr simd_affine_gap_policy & operator=(simd_affine_gap_policy const &) noexcept = default; //!< Defaulted
+    constexpr simd_affine_gap_policy & operator=(simd_affine_gap_policy &&) noexcept = default;      //!< Defaulted
+    ~simd_affine_gap_policy() noexcept = default;                                                    //!< Defaulted
+    //!\}
+
+    /*!\brief Computes the scores of the current cell for all lanes.
+     * \tparam  simd_t  The simd vector type; must model seqan3::simd::simd_concept.
+     * \tparam  cache_t The type of the cache.
+     * \param[in,out] main_score The score of the cell left of the current cell; replaced by the current score.
+     * \param[in,out] hz_score   The horizontal gap score for the current cell; replaced by the one for the next column.
+     * \param[in,out] vt_score   The vertical gap score for the current cell; replaced by the one for the next row.
+     * \param[in,out] diagonal   The score of the diagonal predecessor; replaced by the one for the next row.
+     * \param[in]     cache      The cache storing the gap costs.
+     * \param[in]     score      The scores of comparing the respective letters of the packed sequence pairs.
+     */
+    template <simd_concept simd_t, typename cache_t>
+    constexpr void compute_cell(simd_t & main_score,
+                                simd_t & hz_score,
+                                simd_t & vt_score,
+                                simd_t & diagonal,
+                                cache_t const & cache,
+                                simd_t const & score) const noexcept
+    {
+        auto const & [gap_open, gap_extend, zero] = cache;
+
+        // Precompute the diagonal score.
+        simd_t tmp = diagonal + score;
+
+        // Compute where the max comes from.
+        tmp = max(tmp, vt_score);
+        tmp = max(tmp, hz_score);
+        if constexpr (align_local_t::value)
+            tmp = max(tmp, zero);
+
+        // Cache the current main score for the next diagonal computation and update the current score.
+        diagonal = main_score;
+        main_score = tmp;
+
+        // Prepare horizontal and vertical score for next column.
+        tmp += gap_open;
+        vt_score = max(vt_score + gap_extend, tmp);
+        hz_score = max(hz_score + gap_extend, tmp);
+    }
+
+    /*!\brief Creates the cache used for the vectorised affine gap computation.
+     * \tparam    simd_t       The simd vector type; must model seqan3::simd::simd_concept.
+     * \tparam    gap_scheme_t The type of the gap scheme.
+     * \param[in] scheme       The configured gap scheme.
+     * \returns A tuple storing the broadcasted costs for gap opening + gap, the costs for a gap and a zero vector.
+     */
+    template <simd_concept simd_t, typename gap_scheme_t>
+    constexpr auto make_cache(gap_scheme_t && scheme) const noexcept
+    {
+        using scalar_t = typename simd_traits<simd_t>::scalar_type;
+
+        return std::tuple{fill<simd_t>(static_cast<scalar_t>(scheme.get_gap_open_score() + scheme.get_gap_score())),
+                          fill<simd_t>(static_cast<scalar_t>(scheme.get_gap_score())),
+                          fill<simd_t>(static_cast<scalar_t>(0))};
+    }
+
+    /*!\brief Computes the element-wise maximum of two simd vectors.
+     * \tparam simd_t The simd vector type; must model seqan3::simd::simd_concept.
+     * \param[in] lhs The left operand.
+     * \param[in] rhs The right operand.
+     * \returns A simd vector containing the larger value of each lane.
+     */
+    template <simd_concept simd_t>
+    static constexpr simd_t max(simd_t const & lhs, simd_t const & rhs) noexcept
+    {
+        return blend(lhs > rhs, lhs, rhs);
+    }
+
+    /*!\brief Selects the lanes of two simd vectors based on a mask.
+     * \tparam simd_t The simd vector type; must model seqan3::simd::simd_concept.
+     * \tparam mask_t The mask type as returned by comparing two vectors of type simd_t.
+     * \param[in] mask      A mask, where each lane has either all bits set or no bit set.
+     * \param[in] if_true   The lanes selected if the mask is set.
+     * \param[in] if_false  The lanes selected if the mask is not set.
+     * \returns A simd vector containing the selected lanes.
+     */
+    template <typename mask_t, simd_concept simd_t>
+    static constexpr simd_t blend(mask_t const & mask, simd_t const & if_true, simd_t const & if_false) noexcept
+    {
+        simd_t const m = reinterpret_cast<simd_t const &>(mask);
+        return (if_true & m) | (if_false & ~m);
+    }
+};
+
+} // namespace seqan3::detail
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <deque>
+#include <limits>
 
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -48,6 +49,11 @@ struct gap_segment
  *
  * Internally manages two vectors for the scoring matrix and the traceback matrix for the
  * banded dynamic programming matrix.
+ *
+ * If the matrix has more cells than the threshold passed to
+ * seqan3::detail::unbanded_score_trace_dp_matrix_policy::allocate_matrix, only a single column of trace directions
+ * is kept and the traceback must be computed with seqan3::detail::affine_linear_memory_traceback instead of
+ * seqan3::detail::unbanded_score_trace_dp_matrix_policy::parse_traceback.
  */
 template <typename derived_t, typename score_allocator_t, typename trace_allocator_t>
 class unbanded_score_trace_dp_matrix_policy :
@@ -108,14 +114,22 @@ private:
      * \tparam second_range_t  The type of the second sequence (or packed sequences).
      * \param[in] first_range  The first sequence (or packed sequences).
      * \param[in] second_range The second sequence (or packed sequences).
+     * \param[in] linear_traceback_threshold The number of cells above which the trace matrix is not stored.
      */
     template <typename first_range_t, typename second_range_t>
-    constexpr void allocate_matrix(first_range_t & first_range, second_range_t & second_range)
+    constexpr void allocate_matrix(first_range_t & first_range,
+                                   second_range_t & second_range,
+                                   uint64_t const linear_traceback_threshold = std::numeric_limits<uint64_t>::max())
     {
         base_t::allocate_matrix(first_range, second_range);
 
-        // We use the full matrix to store the trace direction.
-        trace_matrix.resize(dimension_first_range * dimension_second_range);
+        // We use the full matrix to store the trace direction unless the traceback is computed in linear memory.
+        // In the latter case the trace directions of the current column are written to a single column.
+        uint64_t const cells = static_cast<uint64_t>(dimension_first_range) * dimension_second_range;
+        use_linear_traceback = cells > linear_traceback_threshold;
+
+        trace_matrix.clear();
+        trace_matrix.resize(use_linear_traceback ? dimension_second_range : cells);
         trace_matrix_iter = trace_matrix.begin();
     }
 
@@ -136,7 +150,9 @@ private:
     constexpr void go_next_column() noexcept
     {
         base_t::go_next_column();
-        trace_matrix_iter += dimension_second_range;
+
+        if (!use_linear_traceback)
+            trace_matrix_iter += dimension_second_range;
     }
 
     /*!\brief Parses the traceback starting from the given coordinate.
@@ -255,5 +271,7 @@ private:
     trace_matrix_type trace_matrix{};
     //!\brief The current iterator in the trace matrix.
     std::ranges::iterator_t<trace_matrix_type> trace_matrix_iter{};
+    //!\brief Whether only a single column of the trace matrix is stored.
+    bool use_linear_traceback{false};
 };
 } // namespace seqan3::detail
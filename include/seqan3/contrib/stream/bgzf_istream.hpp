@@ -0,0 +1,586 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_bgzf_istream.
+ */
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A stream buffer that decompresses BGZF blocks on a pool of threads.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The traits type.
+ *
+ * \details
+ *
+ * The compressed blocks are read from the source stream by the thread that reads from this buffer. Up to a fixed
+ * number of blocks are read ahead and handed to the worker threads through a contrib::buffer_queue, which decompress
+ * them independently of each other. The get area is always one complete decompressed block, hence it can be scanned
+ * chunk by chunk, e.g. by seqan3::detail::stream_buffer_scanner.
+ *
+ * ### Seeking
+ *
+ * The positions of this buffer are BGZF virtual offsets, i.e. the offset of a block in the source stream shifted by
+ * 16 bits plus the offset in the decompressed block. They are returned by `tellg()` and can be passed to `seekg()`,
+ * which requires a seekable source stream. Offsets relative to the current position or to the end are not supported.
+ *
+ * ### Plain gzip
+ *
+ * If the first member of the input does not carry the "BC" subfield of BGZF, the input is inflated serially like
+ * with seqan3::contrib::basic_gz_istream. Seeking is not supported in this case. With a thread count of `0` or `1`,
+ * BGZF blocks are decompressed on the reading thread. The thread count can be changed with set_thread_count() at any
+ * time.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "BGZF streams can only be used with a character type of one byte.");
+
+public:
+    //!\brief The type of the source stream.
+    using istream_type = std::basic_istream<char_t, traits_t>;
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+    //!\brief The position type of the stream.
+    using pos_type = typename traits_t::pos_type;
+    //!\brief The offset type of the stream.
+    using off_type = typename traits_t::off_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_bgzf_istreambuf(basic_bgzf_istreambuf const &) = delete;             //!< Deleted.
+    basic_bgzf_istreambuf(basic_bgzf_istreambuf &&) = delete;                  //!< Deleted.
+    basic_bgzf_istreambuf & operator=(basic_bgzf_istreambuf const &) = delete; //!< Deleted.
+    basic_bgzf_istreambuf & operator=(basic_bgzf_istreambuf &&) = delete;      //!< Deleted.
+
+    /*!\brief Detects whether the input is BGZF and spawns the worker threads.
+     * \param[in] istream_      The stream the compressed data is read from.
+     * \param[in] thread_count_ The number of worker threads.
+     * \throws std::ios_base::failure If zlib cannot be initialised.
+     */
+    basic_bgzf_istreambuf(istream_type & istream_, size_t const thread_count_) :
+        istream{istream_}
+    {
+        std::streamoff const start = istream.tellg();
+        source_position = (start < 0) ? 0 : static_cast<size_t>(start);
+        first_address = source_position;
+
+        detect_bgzf();
+
+        if (serial)
+        {
+            init_serial();
+            return;
+        }
+
+        start_workers(thread_count_);
+    }
+
+    //!\brief Joins the worker threads.
+    ~basic_bgzf_istreambuf()
+    {
+        stop_workers();
+
+        if (serial)
+            inflateEnd(&serial_stream);
+    }
+    //!\}
+
+    /*!\brief Changes the number of worker threads.
+     * \param[in] thread_count_ The number of worker threads; `0` or `1` decompresses the blocks on the reading thread.
+     *
+     * \details
+     *
+     * The blocks that have been read ahead are finished by the old worker threads and returned before any block is
+     * decompressed with the new setting. Has no effect if the input is not BGZF.
+     */
+    void set_thread_count(size_t const thread_count_)
+    {
+        if (serial || std::max<size_t>(thread_count_, 1) == std::max<size_t>(thread_count(), 1))
+            return;
+
+        for (auto & pending : pending_blocks)
+            pending.second.wait();
+
+        stop_workers();
+        start_workers(thread_count_);
+    }
+
+    //!\brief Returns the number of worker threads; `0` if the blocks are decompressed on the reading thread.
+    size_t thread_count() const noexcept
+    {
+        return workers.size();
+    }
+
+    //!\brief Returns whether the input is inflated serially because it is not BGZF.
+    bool is_serial() const noexcept
+    {
+        return serial;
+    }
+
+protected:
+    //!\brief Makes the next non-empty block the get area.
+    int_type underflow() override
+    {
+        while (this->gptr() == this->egptr())
+        {
+            if (!next_block())
+                return traits_t::eof();
+        }
+
+        return traits_t::to_int_type(*this->gptr());
+    }
+
+    //!\brief Supports `tellg()` and `seekg()` to a virtual offset, see the class documentation.
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        if (dir == std::ios_base::cur && off == 0)
+            return tell();
+        if (dir == std::ios_base::beg)
+            return seekpos(pos_type(off), which);
+
+        return pos_type(off_type(-1));
+    }
+
+    //!\brief Seeks to a virtual offset, see the class documentation.
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        off_type const virtual_offset = pos;
+        if (serial || !(which & std::ios_base::in) || virtual_offset < 0)
+            return pos_type(off_type(-1));
+
+        size_t const address = static_cast<size_t>(virtual_offset) >> 16;
+        size_t const offset = static_cast<size_t>(virtual_offset) & 0xffff;
+
+        // drop the blocks that have been read ahead once the workers are done, such that the queue is empty again
+        for (auto & [job, result] : pending_blocks)
+        {
+            result.wait();
+            free_jobs.push_back(std::move(job));
+        }
+        pending_blocks.clear();
+        source_at_end = false;
+        prefix.clear();
+        prefix_position = 0;
+        this->setg(nullptr, nullptr, nullptr);
+        if (current != nullptr)
+            free_jobs.push_back(std::move(current));
+
+        istream.clear();
+        istream.seekg(static_cast<std::streamoff>(address));
+        if (!istream)
+            return pos_type(off_type(-1));
+        source_position = address;
+        first_address = address;
+
+        if (!next_block())
+            return (offset == 0) ? pos : pos_type(off_type(-1)); // the end of the input
+
+        if (offset > static_cast<size_t>(this->egptr() - this->eback()))
+            return pos_type(off_type(-1));
+
+        this->setg(this->eback(), this->eback() + offset, this->egptr());
+        return pos;
+    }
+
+private:
+    //!\brief A block that is decompressed by the worker threads.
+    struct job_type
+    {
+        //!\brief The compressed block.
+        std::vector<char> block{};
+        //!\brief The decompressed data.
+        std::vector<char> data{};
+        //!\brief The offset of the block in the source stream.
+        size_t address{};
+        //!\brief Is set by the worker thread once #data is complete.
+        std::promise<void> done{};
+    };
+
+    //!\brief Shared between the queue and #pending_blocks.
+    using job_pointer = std::shared_ptr<job_type>;
+
+    //!\brief Spawns the worker threads, or creates the decompressor of the reading thread for a count of `0` or `1`.
+    void start_workers(size_t const thread_count_)
+    {
+        if (thread_count_ <= 1)
+        {
+            decompressor = std::make_unique<bgzf_decompressor>();
+            return;
+        }
+
+        decompressor.reset();
+        max_pending_blocks = thread_count_ * queue_factor;
+        job_queue = std::make_unique<fixed_buffer_queue<job_pointer>>(max_pending_blocks);
+
+        workers.reserve(thread_count_);
+        for (size_t i = 0; i < thread_count_; ++i)
+            workers.emplace_back([this] () { decompress_jobs(); });
+    }
+
+    //!\brief Closes the queue and joins the worker threads; the pending blocks must have been decompressed.
+    void stop_workers()
+    {
+        if (job_queue != nullptr)
+            job_queue->close();
+
+        for (auto & worker : workers)
+            worker.join();
+
+        workers.clear();
+        job_queue.reset();
+    }
+
+    //!\brief Reads the header of the first member and decides whether the input is BGZF.
+    void detect_bgzf()
+    {
+        prefix.resize(12);
+        istream.read(reinterpret_cast<char_t *>(prefix.data()), prefix.size());
+        prefix.resize(istream.gcount());
+
+        if (prefix.empty()) // an empty input has no blocks
+            return;
+
+        serial = prefix.size() < 12 || prefix[0] != '\x1f' || prefix[1] != '\x8b' || prefix[2] != '\x08' ||
+                 !(prefix[3] & '\x04'); // FEXTRA
+        if (serial)
+            return;
+
+        size_t const extra_length = bgzf_read_little_endian(prefix.data() + 10, 2);
+        prefix.resize(12 + extra_length);
+        istream.read(reinterpret_cast<char_t *>(prefix.data() + 12), extra_length);
+        prefix.resize(12 + istream.gcount());
+
+        serial = (prefix.size() < 12 + extra_length) ||
+                 (bgzf_block_size_from_extra(prefix.data() + 12, extra_length) == 0);
+    }
+
+    /*!\brief Reads up to `count` bytes of the input into `out`, beginning with the bytes read by detect_bgzf().
+     * \returns The number of bytes read.
+     */
+    size_t read_input(char * out, size_t const count)
+    {
+        size_t const from_prefix = std::min(count, prefix.size() - prefix_position);
+        std::memcpy(out, prefix.data() + prefix_position, from_prefix);
+        prefix_position += from_prefix;
+
+        size_t from_stream = 0;
+        if (from_prefix < count && istream)
+        {
+            istream.read(reinterpret_cast<char_t *>(out + from_prefix), count - from_prefix);
+            from_stream = istream.gcount();
+        }
+
+        source_position += from_prefix + from_stream;
+        return from_prefix + from_stream;
+    }
+
+    /*!\brief Reads the next BGZF block of the input.
+     * \returns `false` at the end of the input.
+     * \throws std::ios_base::failure If the input is not a valid BGZF block.
+     */
+    bool read_block(job_type & job)
+    {
+        job.address = source_position;
+        job.block.resize(12);
+
+        size_t const header_read = read_input(job.block.data(), 12);
+        if (header_read == 0)
+            return false;
+
+        if (header_read < 12 || job.block[0] != '\x1f' || job.block[1] != '\x8b' || !(job.block[3] & '\x04'))
+            throw std::ios_base::failure{"The input is not a valid BGZF block."};
+
+        size_t const extra_length = bgzf_read_little_endian(job.block.data() + 10, 2);
+        job.block.resize(12 + extra_length);
+        if (read_input(job.block.data() + 12, extra_length) < extra_length)
+            throw std::ios_base::failure{"The BGZF block is truncated."};
+
+        size_t const block_size = bgzf_block_size_from_extra(job.block.data() + 12, extra_length);
+        if (block_size < 12 + extra_length + bgzf_block_footer_size)
+            throw std::ios_base::failure{"The input is not a valid BGZF block."};
+
+        job.block.resize(block_size);
+        size_t const rest = block_size - 12 - extra_length;
+        if (read_input(job.block.data() + 12 + extra_length, rest) < rest)
+            throw std::ios_base::failure{"The BGZF block is truncated."};
+
+        return true;
+    }
+
+    //!\brief Returns a job whose buffers can be reused, or a new one.
+    job_pointer make_job()
+    {
+        if (free_jobs.empty())
+            return std::make_shared<job_type>();
+
+        job_pointer job = std::move(free_jobs.back());
+        free_jobs.pop_back();
+        return job;
+    }
+
+    /*!\brief Makes the next block the get area; the block may be empty.
+     * \returns `false` at the end of the input.
+     */
+    bool next_block()
+    {
+        if (serial)
+            return inflate_serial();
+
+        job_pointer job{};
+        if (decompressor != nullptr && pending_blocks.empty()) // no worker threads
+        {
+            job = make_job();
+            if (!read_block(*job))
+                return false;
+
+            decompressor->decompress(job->block, job->data);
+        }
+        else
+        {
+            // read ahead; the jobs in the queue are a subset of the pending ones, hence pushing never blocks
+            // blocks that were read ahead before the worker threads were stopped are returned first
+            while (job_queue != nullptr && !source_at_end && pending_blocks.size() < max_pending_blocks)
+            {
+                job_pointer next = make_job();
+                if (!read_block(*next))
+                {
+                    source_at_end = true;
+                    break;
+                }
+
+                next->done = std::promise<void>{};
+                pending_blocks.emplace_back(next, next->done.get_future());
+                job_queue->push(std::move(next));
+            }
+
+            if (pending_blocks.empty())
+                return false;
+
+            std::future<void> result{};
+            std::tie(job, result) = std::move(pending_blocks.front());
+            pending_blocks.pop_front();
+            result.get(); // rethrows the exception of the worker thread
+        }
+
+        // the get area points into the current job, hence the previous one can be reused now
+        if (current != nullptr)
+            free_jobs.push_back(std::move(current));
+        current = std::move(job);
+
+        char_t * const data = reinterpret_cast<char_t *>(current->data.data());
+        this->setg(data, data, data + current->data.size());
+        return true;
+    }
+
+    //!\brief Returns the virtual offset of the current position.
+    pos_type tell() const
+    {
+        if (serial)
+            return pos_type(off_type(-1));
+        if (current == nullptr) // nothing has been read yet
+            return pos_type(off_type(first_address << 16));
+
+        return pos_type(off_type((current->address << 16) | (this->gptr() - this->eback())));
+    }
+
+    //!\brief Decompresses the jobs of the queue; runs on every worker thread.
+    void decompress_jobs()
+    {
+        bgzf_decompressor thread_decompressor{};
+
+        job_pointer job{};
+        while (job_queue->wait_pop(job) != queue_op_status::closed)
+        {
+            // the job may be reused as soon as the promise is set
+            std::promise<void> done{std::move(job->done)};
+            try
+            {
+                thread_decompressor.decompress(job->block, job->data);
+                done.set_value();
+            }
+            catch (...)
+            {
+                done.set_exception(std::current_exception());
+            }
+
+            job.reset();
+        }
+    }
+
+    //!\brief Initialises the inflate state for input that is not BGZF.
+    void init_serial()
+    {
+        serial_stream.zalloc = Z_NULL;
+        serial_stream.zfree = Z_NULL;
+        serial_stream.opaque = Z_NULL;
+        serial_stream.next_in = Z_NULL;
+        serial_stream.avail_in = 0;
+
+        // 15 + 16 reads the gzip header
+        if (inflateInit2(&serial_stream, 31) != Z_OK)
+            throw std::ios_base::failure{"Could not initialise the gzip decompression."};
+
+        serial_input.resize(bgzf_max_block_size);
+        serial_output.resize(bgzf_max_block_size);
+    }
+
+    /*!\brief Inflates the next chunk of input that is not BGZF into the get area.
+     * \returns `false` at the end of the input.
+     */
+    bool inflate_serial()
+    {
+        serial_stream.next_out = reinterpret_cast<Bytef *>(serial_output.data());
+        serial_stream.avail_out = static_cast<uInt>(serial_output.size());
+
+        while (serial_stream.avail_out == serial_output.size())
+        {
+            if (serial_stream.avail_in == 0)
+            {
+                size_t const count = read_input(serial_input.data(), serial_input.size());
+                if (count == 0) // the end of the input
+                    return false;
+
+                serial_stream.next_in = reinterpret_cast<Bytef *>(serial_input.data());
+                serial_stream.avail_in = static_cast<uInt>(count);
+            }
+
+            int const status = inflate(&serial_stream, Z_NO_FLUSH);
+            if (status == Z_STREAM_END) // the input may consist of multiple members
+                inflateReset(&serial_stream);
+            else if (status != Z_OK)
+                throw std::ios_base::failure{"Could not decompress the gzip input."};
+        }
+
+        char_t * const data = reinterpret_cast<char_t *>(serial_output.data());
+        this->setg(data, data, data + (serial_output.size() - serial_stream.avail_out));
+        return true;
+    }
+
+    //!\brief The number of blocks read ahead per worker thread.
+    static constexpr size_t queue_factor{4};
+
+    //!\brief The stream the compressed data is read from.
+    istream_type & istream;
+    //!\brief The bytes read by detect_bgzf() that have not been consumed yet.
+    std::vector<char> prefix{};
+    //!\brief The number of bytes of #prefix that have been consumed.
+    size_t prefix_position{};
+    //!\brief The offset of the next byte of the input in the source stream.
+    size_t source_position{};
+    //!\brief The offset of the first block in the source stream; the position if no block has been read yet.
+    size_t first_address{};
+    //!\brief Whether all blocks have been read from the source stream.
+    bool source_at_end{false};
+
+    //!\brief The block that is the get area.
+    job_pointer current{};
+    //!\brief Decompresses the blocks if there are no worker threads.
+    std::unique_ptr<bgzf_decompressor> decompressor{};
+
+    //!\brief The maximum number of blocks read ahead.
+    size_t max_pending_blocks{};
+    //!\brief The blocks that have been read ahead in the order of the input.
+    std::deque<std::pair<job_pointer, std::future<void>>> pending_blocks{};
+    //!\brief Consumed jobs whose buffers are reused.
+    std::vector<job_pointer> free_jobs{};
+    //!\brief The jobs that wait to be decompressed.
+    std::unique_ptr<fixed_buffer_queue<job_pointer>> job_queue{};
+    //!\brief The threads that decompress the jobs.
+    std::vector<std::thread> workers{};
+
+    //!\brief Whether the input is inflated serially because it is not BGZF.
+    bool serial{false};
+    //!\brief The inflate state if the input is not BGZF.
+    z_stream serial_stream{};
+    //!\brief The compressed input if the input is not BGZF.
+    std::vector<char> serial_input{};
+    //!\brief The get area if the input is not BGZF.
+    std::vector<char> serial_output{};
+};
+
+/*!\brief Holds the stream buffer of a seqan3::contrib::basic_bgzf_istream, such that it is constructed before the
+ *        std::basic_istream.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_istreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the stream buffer.
+    using bgzf_streambuf_type = basic_bgzf_istreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer, see seqan3::contrib::basic_bgzf_istreambuf.
+    basic_bgzf_istreambase(std::basic_istream<char_t, traits_t> & istream_, size_t const thread_count_) :
+        m_buf{istream_, thread_count_}
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    bgzf_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    //!\brief The stream buffer.
+    bgzf_streambuf_type m_buf;
+};
+
+/*!\brief An istream decorator that reads BGZF, i.e. the blocked gzip format used by BAM, on a pool of threads.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The traits type.
+ *
+ * \details
+ *
+ * The blocks are decompressed independently of each other on worker threads with read-ahead, and `tellg()` and
+ * `seekg()` operate on BGZF virtual offsets, see seqan3::contrib::basic_bgzf_istreambuf. Input that is gzip but not
+ * BGZF is decompressed serially.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_istream :
+    public basic_bgzf_istreambase<char_t, traits_t>,
+    public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The type of the source stream.
+    using istream_type = std::basic_istream<char_t, traits_t>;
+
+    /*!\brief Constructs the stream.
+     * \param[in] istream_      The stream the compressed data is read from.
+     * \param[in] thread_count_ The number of worker threads; by default, the blocks are decompressed on the reading
+     *                          thread.
+     */
+    explicit basic_bgzf_istream(istream_type & istream_, size_t const thread_count_ = 1) :
+        basic_bgzf_istreambase<char_t, traits_t>{istream_, thread_count_},
+        istream_type{this->rdbuf()}
+    {}
+};
+
+//!\brief A typedef for basic_bgzf_istream<char>.
+using bgzf_istream = basic_bgzf_istream<char>;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,372 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_bgzf_ostream.
+ */
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A stream buffer that compresses the data into BGZF blocks on a pool of threads.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The traits type.
+ *
+ * \details
+ *
+ * The data is collected in blocks of seqan3::contrib::bgzf_max_block_data_size bytes. Every full block is handed to
+ * the worker threads through a contrib::buffer_queue and compressed independently of the others. The compressed
+ * blocks are written to the target stream by the thread that writes into this buffer, in the order of the data, as
+ * soon as the number of blocks in flight reaches a fixed bound. sync() compresses the block that is not yet full and
+ * waits until all blocks are written, the destructor additionally appends the BGZF end-of-file marker.
+ *
+ * With a thread count of `0` or `1`, the blocks are compressed on the writing thread. The thread count can be changed
+ * with set_thread_count() at any time.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_ostreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "BGZF streams can only be used with a character type of one byte.");
+
+public:
+    //!\brief The type of the target stream.
+    using ostream_type = std::basic_ostream<char_t, traits_t>;
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_bgzf_ostreambuf(basic_bgzf_ostreambuf const &) = delete;             //!< Deleted.
+    basic_bgzf_ostreambuf(basic_bgzf_ostreambuf &&) = delete;                  //!< Deleted.
+    basic_bgzf_ostreambuf & operator=(basic_bgzf_ostreambuf const &) = delete; //!< Deleted.
+    basic_bgzf_ostreambuf & operator=(basic_bgzf_ostreambuf &&) = delete;      //!< Deleted.
+
+    /*!\brief Spawns the worker threads.
+     * \param[in] ostream_      The stream the compressed data is written to.
+     * \param[in] thread_count_ The number of worker threads.
+     * \param[in] level_        The compression level, see zlib.
+     */
+    basic_bgzf_ostreambuf(ostream_type & ostream_, size_t const thread_count_, int const level_) :
+        ostream{ostream_},
+        level{level_},
+        buffer(bgzf_max_block_data_size)
+    {
+        this->setp(buffer.data(), buffer.data() + buffer.size());
+        start_workers(thread_count_);
+    }
+
+    //!\brief Writes the remaining data and the end-of-file marker and joins the worker threads.
+    ~basic_bgzf_ostreambuf()
+    {
+        try
+        {
+            if (sync() == 0)
+            {
+                ostream.write(reinterpret_cast<char_t const *>(bgzf_eof_marker.data()), bgzf_eof_marker.size());
+                ostream.flush();
+            }
+        }
+        catch (...) // a destructor must not throw
+        {}
+
+        stop_workers();
+    }
+    //!\}
+
+    /*!\brief Changes the number of worker threads.
+     * \param[in] thread_count_ The number of worker threads; `0` or `1` compresses the blocks on the writing thread.
+     *
+     * \details
+     *
+     * The blocks in flight are written before the old worker threads are joined. The data in the put area is not
+     * flushed, hence the block boundaries do not depend on when the thread count is changed.
+     */
+    void set_thread_count(size_t const thread_count_)
+    {
+        if (std::max<size_t>(thread_count_, 1) == std::max<size_t>(thread_count(), 1))
+            return;
+
+        while (!pending_blocks.empty())
+            write_front_block();
+
+        stop_workers();
+        start_workers(thread_count_);
+    }
+
+    //!\brief Returns the number of worker threads; `0` if the blocks are compressed on the writing thread.
+    size_t thread_count() const noexcept
+    {
+        return workers.size();
+    }
+
+protected:
+    //!\brief Compresses the full block and starts a new one with `c`.
+    int_type overflow(int_type c) override
+    {
+        compress_block();
+
+        if (!traits_t::eq_int_type(c, traits_t::eof()))
+        {
+            *this->pptr() = traits_t::to_char_type(c);
+            this->pbump(1);
+        }
+
+        return traits_t::not_eof(c);
+    }
+
+    //!\brief Compresses the pending data and writes all blocks to the target stream.
+    int sync() override
+    {
+        compress_block();
+
+        while (!pending_blocks.empty())
+            write_front_block();
+
+        ostream.flush();
+        return ostream ? 0 : -1;
+    }
+
+private:
+    //!\brief A block that is compressed by the worker threads.
+    struct job_type
+    {
+        //!\brief The uncompressed data; only the first #size bytes are valid.
+        std::vector<char_t> data{};
+        //!\brief The number of uncompressed bytes.
+        size_t size{};
+        //!\brief The compressed block.
+        std::vector<char> block{};
+        //!\brief Is set by the worker thread once #block is complete.
+        std::promise<void> done{};
+    };
+
+    //!\brief Shared between the queue and #pending_blocks.
+    using job_pointer = std::shared_ptr<job_type>;
+
+    //!\brief Spawns the worker threads, or creates the compressor of the writing thread for a count of `0` or `1`.
+    void start_workers(size_t const thread_count_)
+    {
+        if (thread_count_ <= 1)
+        {
+            compressor = std::make_unique<bgzf_compressor>(level);
+            return;
+        }
+
+        compressor.reset();
+        max_pending_blocks = thread_count_ * queue_factor;
+        job_queue = std::make_unique<fixed_buffer_queue<job_pointer>>(max_pending_blocks);
+
+        workers.reserve(thread_count_);
+        for (size_t i = 0; i < thread_count_; ++i)
+            workers.emplace_back([this] () { compress_jobs(); });
+    }
+
+    //!\brief Closes the queue and joins the worker threads; all blocks must have been written.
+    void stop_workers()
+    {
+        if (job_queue != nullptr)
+            job_queue->close();
+
+        for (auto & worker : workers)
+            worker.join();
+
+        workers.clear();
+        job_queue.reset();
+    }
+
+    //!\brief Compresses the data in the put area, if any, and resets the put area.
+    void compress_block()
+    {
+        size_t const size = this->pptr() - this->pbase();
+        if (size == 0)
+            return;
+
+        if (compressor != nullptr) // no worker threads
+        {
+            compressor->compress(reinterpret_cast<char const *>(buffer.data()), size, block_buffer);
+            ostream.write(reinterpret_cast<char_t const *>(block_buffer.data()), block_buffer.size());
+            this->setp(buffer.data(), buffer.data() + buffer.size());
+            return;
+        }
+
+        // the jobs in the queue are a subset of the pending ones, hence pushing never blocks
+        while (pending_blocks.size() >= max_pending_blocks)
+            write_front_block();
+
+        job_pointer job{};
+        if (free_jobs.empty())
+        {
+            job = std::make_shared<job_type>();
+        }
+        else
+        {
+            job = std::move(free_jobs.back());
+            free_jobs.pop_back();
+        }
+
+        // hand the buffer over to the job and continue with the buffer of a finished job
+        job->data.resize(buffer.size());
+        std::swap(job->data, buffer);
+        job->size = size;
+        job->done = std::promise<void>{};
+        this->setp(buffer.data(), buffer.data() + buffer.size());
+
+        pending_blocks.emplace_back(job, job->done.get_future());
+        job_queue->push(std::move(job));
+    }
+
+    //!\brief Waits for the oldest pending block and writes it to the target stream.
+    void write_front_block()
+    {
+        auto [job, result] = std::move(pending_blocks.front());
+        pending_blocks.pop_front();
+
+        result.get(); // rethrows the exception of the worker thread
+        ostream.write(reinterpret_cast<char_t const *>(job->block.data()), job->block.size());
+        free_jobs.push_back(std::move(job));
+    }
+
+    //!\brief Compresses the jobs of the queue; runs on every worker thread.
+    void compress_jobs()
+    {
+        bgzf_compressor thread_compressor{level};
+
+        job_pointer job{};
+        while (job_queue->wait_pop(job) != queue_op_status::closed)
+        {
+            // the job may be reused as soon as the promise is set
+            std::promise<void> done{std::move(job->done)};
+            try
+            {
+                thread_compressor.compress(reinterpret_cast<char const *>(job->data.data()), job->size, job->block);
+                done.set_value();
+            }
+            catch (...)
+            {
+                done.set_exception(std::current_exception());
+            }
+
+            job.reset();
+        }
+    }
+
+    //!\brief The number of blocks in flight per worker thread.
+    static constexpr size_t queue_factor{4};
+
+    //!\brief The stream the compressed data is written to.
+    ostream_type & ostream;
+    //!\brief The compression level.
+    int level;
+    //!\brief The put area.
+    std::vector<char_t> buffer;
+
+    //!\brief Compresses the blocks if there are no worker threads.
+    std::unique_ptr<bgzf_compressor> compressor{};
+    //!\brief The compressed block if there are no worker threads.
+    std::vector<char> block_buffer{};
+
+    //!\brief The maximum number of blocks in flight.
+    size_t max_pending_blocks{};
+    //!\brief The blocks that have not been written yet in the order of the data.
+    std::deque<std::pair<job_pointer, std::future<void>>> pending_blocks{};
+    //!\brief Written jobs whose buffers are reused.
+    std::vector<job_pointer> free_jobs{};
+    //!\brief The jobs that wait to be compressed.
+    std::unique_ptr<fixed_buffer_queue<job_pointer>> job_queue{};
+    //!\brief The threads that compress the jobs.
+    std::vector<std::thread> workers{};
+};
+
+/*!\brief Holds the stream buffer of a seqan3::contrib::basic_bgzf_ostream, such that it is constructed before the
+ *        std::basic_ostream.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_ostreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the stream buffer.
+    using bgzf_streambuf_type = basic_bgzf_ostreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer, see seqan3::contrib::basic_bgzf_ostreambuf.
+    basic_bgzf_ostreambase(std::basic_ostream<char_t, traits_t> & ostream_,
+                           size_t const thread_count_,
+                           int const level_) :
+        m_buf{ostream_, thread_count_, level_}
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    bgzf_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    //!\brief The stream buffer.
+    bgzf_streambuf_type m_buf;
+};
+
+/*!\brief An ostream decorator that writes BGZF, i.e. the blocked gzip format used by BAM, on a pool of threads.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The traits type.
+ *
+ * \details
+ *
+ * BGZF is a series of gzip members, hence it can be read by every gzip decompressor. The data is compressed in
+ * independent blocks of 64 KiB on worker threads, see seqan3::contrib::basic_bgzf_ostreambuf. The output is
+ * completed, i.e. the last block and the end-of-file marker are written, when the stream is destroyed.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_bgzf_ostream :
+    public basic_bgzf_ostreambase<char_t, traits_t>,
+    public std::basic_ostream<char_t, traits_t>
+{
+public:
+    //!\brief The type of the target stream.
+    using ostream_type = std::basic_ostream<char_t, traits_t>;
+
+    /*!\brief Constructs the stream.
+     * \param[in] ostream_      The stream the compressed data is written to.
+     * \param[in] thread_count_ The number of worker threads; by default, the blocks are compressed on the writing
+     *                          thread.
+     * \param[in] level_        The compression level, see zlib.
+     */
+    explicit basic_bgzf_ostream(ostream_type & ostream_,
+                                size_t const thread_count_ = 1,
+                                int const level_ = Z_DEFAULT_COMPRESSION) :
+        basic_bgzf_ostreambase<char_t, traits_t>{ostream_, thread_count_, level_},
+        ostream_type{this->rdbuf()}
+    {}
+
+    //!\brief Flushes the stream; the stream buffer completes the output.
+    ~basic_bgzf_ostream()
+    {
+        this->flush();
+    }
+};
+
+//!\brief A typedef for basic_bgzf_ostream<char>.
+using bgzf_ostream = basic_bgzf_ostream<char>;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,258 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the constants and the block (de-)compression shared by the BGZF streams.
+ */
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ios>
+#include <vector>
+
+#include <zlib.h>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+//!\brief The size of the header of a BGZF block, i.e. of a gzip member header with the "BC" extra field.
+inline constexpr size_t bgzf_block_header_size = 18;
+//!\brief The size of the footer of a BGZF block, i.e. the CRC32 and the size of the uncompressed data.
+inline constexpr size_t bgzf_block_footer_size = 8;
+//!\brief The maximum size of a BGZF block including header and footer.
+inline constexpr size_t bgzf_max_block_size = 1u << 16;
+/*!\brief The maximum number of uncompressed bytes written into one BGZF block.
+ *
+ * \details
+ *
+ * Less than #bgzf_max_block_size, such that even incompressible data fits into a block.
+ */
+inline constexpr size_t bgzf_max_block_data_size = 0xff00;
+
+//!\brief The header of a BGZF block; bytes 16 and 17 hold the size of the block minus one.
+inline constexpr std::array<char, bgzf_block_header_size> bgzf_block_header
+{
+    '\x1f', '\x8b', '\x08', '\x04', // magic number, deflate, FEXTRA
+    '\x00', '\x00', '\x00', '\x00', // MTIME
+    '\x00', '\xff',                 // XFL, OS unknown
+    '\x06', '\x00',                 // XLEN
+    'B',    'C',    '\x02', '\x00', // the "BC" subfield of length 2
+    '\x00', '\x00'                  // BSIZE
+};
+
+//!\brief The empty block that terminates a BGZF file.
+inline constexpr std::array<char, 28> bgzf_eof_marker
+{
+    '\x1f', '\x8b', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x06', '\x00', 'B',    'C',
+    '\x02', '\x00', '\x1b', '\x00', '\x03', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+};
+
+/*!\brief Compresses data into BGZF blocks.
+ *
+ * \details
+ *
+ * Every block is compressed independently; the deflate state is reset, not reallocated, between the blocks. An
+ * object must not be used by multiple threads at the same time.
+ */
+class bgzf_compressor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bgzf_compressor(bgzf_compressor const &) = delete;             //!< Deleted.
+    bgzf_compressor(bgzf_compressor &&) = delete;                  //!< Deleted.
+    bgzf_compressor & operator=(bgzf_compressor const &) = delete; //!< Deleted.
+    bgzf_compressor & operator=(bgzf_compressor &&) = delete;      //!< Deleted.
+
+    /*!\brief Initialises the deflate state.
+     * \param[in] level The compression level, see zlib.
+     * \throws std::ios_base::failure If zlib cannot be initialised.
+     */
+    explicit bgzf_compressor(int const level = Z_DEFAULT_COMPRESSION)
+    {
+        zip_stream.zalloc = Z_NULL;
+        zip_stream.zfree = Z_NULL;
+        zip_stream.opaque = Z_NULL;
+
+        // a negative window size writes raw deflate data, the gzip header is written by compress()
+        if (deflateInit2(&zip_stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::ios_base::failure{"Could not initialise the BGZF compression."};
+    }
+
+    //!\brief Releases the deflate state.
+    ~bgzf_compressor()
+    {
+        deflateEnd(&zip_stream);
+    }
+    //!\}
+
+    /*!\brief Compresses `size` bytes into one BGZF block.
+     * \param[in]  data  The data to compress.
+     * \param[in]  size  The number of bytes; must not exceed seqan3::contrib::bgzf_max_block_data_size.
+     * \param[out] block Is overwritten with the complete block.
+     * \throws std::ios_base::failure If the data could not be compressed.
+     */
+    void compress(char const * const data, size_t const size, std::vector<char> & block)
+    {
+        block.resize(bgzf_max_block_size);
+
+        if (deflateReset(&zip_stream) != Z_OK)
+            throw std::ios_base::failure{"Could not reset the BGZF compression."};
+
+        zip_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+        zip_stream.avail_in = static_cast<uInt>(size);
+        zip_stream.next_out = reinterpret_cast<Bytef *>(block.data() + bgzf_block_header_size);
+        zip_stream.avail_out = static_cast<uInt>(bgzf_max_block_size - bgzf_block_header_size - bgzf_block_footer_size);
+
+        if (deflate(&zip_stream, Z_FINISH) != Z_STREAM_END)
+            throw std::ios_base::failure{"Could not compress a BGZF block."};
+
+        size_t const block_size = bgzf_block_header_size + zip_stream.total_out + bgzf_block_footer_size;
+        block.resize(block_size);
+
+        std::copy(bgzf_block_header.begin(), bgzf_block_header.end(), block.begin());
+        write_little_endian<uint16_t>(block.data() + 16, block_size - 1);
+
+        char * const footer = block.data() + block_size - bgzf_block_footer_size;
+        uLong const checksum = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<Bytef const *>(data), size);
+        write_little_endian<uint32_t>(footer, checksum);
+        write_little_endian<uint32_t>(footer + 4, size);
+    }
+
+private:
+    //!\brief Writes `value` to `out` in little endian byte order.
+    template <typename uint_t>
+    static void write_little_endian(char * out, size_t value) noexcept
+    {
+        for (size_t i = 0; i < sizeof(uint_t); ++i, value >>= 8)
+            out[i] = static_cast<char>(value & 0xff);
+    }
+
+    //!\brief The deflate state.
+    z_stream zip_stream;
+};
+
+//!\brief Reads an unsigned integer of `size` bytes in little endian byte order.
+inline size_t bgzf_read_little_endian(char const * in, size_t const size) noexcept
+{
+    size_t value = 0;
+    for (size_t i = size; i > 0; --i)
+        value = (value << 8) | static_cast<unsigned char>(in[i - 1]);
+    return value;
+}
+
+/*!\brief Returns the size of a BGZF block from the extra field of its header, or 0 if there is no "BC" subfield.
+ * \param[in] extra        The extra field, i.e. the bytes behind the first 12 bytes of the header.
+ * \param[in] extra_length The length of the extra field (XLEN).
+ */
+inline size_t bgzf_block_size_from_extra(char const * const extra, size_t const extra_length) noexcept
+{
+    // the extra field is a list of subfields with two identifier bytes and a two byte length
+    for (size_t pos = 0; pos + 4 <= extra_length;)
+    {
+        size_t const subfield_length = bgzf_read_little_endian(extra + pos + 2, 2);
+        if (extra[pos] == 'B' && extra[pos + 1] == 'C' && subfield_length == 2 && pos + 6 <= extra_length)
+            return bgzf_read_little_endian(extra + pos + 4, 2) + 1;
+
+        pos += 4 + subfield_length;
+    }
+
+    return 0;
+}
+
+/*!\brief Decompresses BGZF blocks.
+ *
+ * \details
+ *
+ * Every block is decompressed independently; the inflate state is reset, not reallocated, between the blocks. An
+ * object must not be used by multiple threads at the same time.
+ */
+class bgzf_decompressor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bgzf_decompressor(bgzf_decompressor const &) = delete;             //!< Deleted.
+    bgzf_decompressor(bgzf_decompressor &&) = delete;                  //!< Deleted.
+    bgzf_decompressor & operator=(bgzf_decompressor const &) = delete; //!< Deleted.
+    bgzf_decompressor & operator=(bgzf_decompressor &&) = delete;      //!< Deleted.
+
+    /*!\brief Initialises the inflate state.
+     * \throws std::ios_base::failure If zlib cannot be initialised.
+     */
+    bgzf_decompressor()
+    {
+        zip_stream.zalloc = Z_NULL;
+        zip_stream.zfree = Z_NULL;
+        zip_stream.opaque = Z_NULL;
+        zip_stream.next_in = Z_NULL;
+        zip_stream.avail_in = 0;
+
+        // a negative window size reads raw deflate data, the gzip header is skipped by decompress()
+        if (inflateInit2(&zip_stream, -15) != Z_OK)
+            throw std::ios_base::failure{"Could not initialise the BGZF decompression."};
+    }
+
+    //!\brief Releases the inflate state.
+    ~bgzf_decompressor()
+    {
+        inflateEnd(&zip_stream);
+    }
+    //!\}
+
+    /*!\brief Decompresses one BGZF block.
+     * \param[in]  block The complete block including header and footer.
+     * \param[out] data  Is overwritten with the uncompressed data.
+     * \throws std::ios_base::failure If the block is corrupt.
+     */
+    void decompress(std::vector<char> const & block, std::vector<char> & data)
+    {
+        size_t const header_size = 12 + bgzf_read_little_endian(block.data() + 10, 2);
+        if (block.size() < header_size + bgzf_block_footer_size)
+            throw std::ios_base::failure{"The BGZF block is truncated."};
+
+        char const * const footer = block.data() + block.size() - bgzf_block_footer_size;
+        size_t const size = bgzf_read_little_endian(footer + 4, 4);
+        if (size > bgzf_max_block_size)
+            throw std::ios_base::failure{"The BGZF block is too large."};
+
+        data.resize(size);
+
+        if (inflateReset(&zip_stream) != Z_OK)
+            throw std::ios_base::failure{"Could not reset the BGZF decompression."};
+
+        zip_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(block.data() + header_size));
+        zip_stream.avail_in = static_cast<uInt>(block.size() - header_size - bgzf_block_footer_size);
+        char empty_output{}; // zlib rejects a null pointer even if no output is expected
+        zip_stream.next_out = reinterpret_cast<Bytef *>(size == 0 ? &empty_output : data.data());
+        zip_stream.avail_out = static_cast<uInt>(size);
+
+        if (inflate(&zip_stream, Z_FINISH) != Z_STREAM_END || zip_stream.avail_out != 0)
+            throw std::ios_base::failure{"Could not decompress a BGZF block."};
+
+        uLong const checksum = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<Bytef const *>(data.data()), size);
+        if (checksum != bgzf_read_little_endian(footer, 4))
+            throw std::ios_base::failure{"The checksum of a BGZF block does not match."};
+    }
+
+private:
+    //!\brief The inflate state.
+    z_stream zip_stream;
+};
+
+} // namespace seqan3::contrib
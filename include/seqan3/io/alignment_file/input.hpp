@@ -884,6 +884,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The number of decompression threads that the secondary stream was set to.
+    size_t applied_decompression_threads{1};
+
+    //!\brief Hands seqan3::alignment_file_input_options::decompression_threads to the secondary stream if it changed.
+    void update_decompression_threads()
+    {
+        if (options.decompression_threads != applied_decompression_threads)
+        {
+            detail::set_decompression_threads(*secondary_stream, options.decompression_threads);
+            applied_decompression_threads = options.decompression_threads;
+        }
+    }
+
     /*!\name Reference information
      * \{
      */
@@ -924,6 +937,8 @@ protected:
         record_buffer.clear();
         detail::get_or_ignore<field::HEADER_PTR>(record_buffer) = header_ptr.get();
 
+        update_decompression_threads();
+
         // at end if we could not read further
         if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
             std::istreambuf_iterator<stream_char_type>{})
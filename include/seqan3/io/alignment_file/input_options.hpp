@@ -22,7 +22,14 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct alignment_file_input_options
 {
-    // options to define
+    /*!\brief The number of threads that decompress the input if it is BGZF, e.g. a `.bam` or most `.gz` files.
+     *
+     * \details
+     *
+     * A value of `1` decompresses on the reading thread; a value of `0` is replaced by the number of hardware threads.
+     * Takes effect at the next record that is read.
+     */
+    size_t decompression_threads = 1;
 };
 
 } // namespace seqan3
@@ -14,6 +14,8 @@
 
 #include <cassert>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -27,6 +29,7 @@
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/alignment_file/output_format_concept.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
@@ -280,17 +283,39 @@ public:
      * Writing with custom selected fields:
      *
      * \snippet test/snippet/io/alignment_file/alignment_file_output.cpp format_construction
+     *
+     * ### Compression
+     *
+     * This constructor transparently applies a compression stream on top of the file stream in case
+     * the given file extension suggests the user wants this.
+     * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     alignment_file_output(std::filesystem::path const & _file_name,
                           selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{})
     {
         // open stream
-        stream.open(_file_name, std::ios_base::out | std::ios::binary);
-        if (!stream.is_open())
+        auto primary_stream = std::make_shared<stream_type>();
+        primary_stream->open(_file_name, std::ios_base::out | std::ios::binary);
+        if (!primary_stream->is_open())
             throw file_open_error{"Could not open file " + _file_name.string() + " for reading."};
 
+        // possibly add intermediate compression stream
+        std::filesystem::path file_path{_file_name};
+        auto compression_stream = detail::make_secondary_ostream(*primary_stream, file_path);
+
+        if (compression_stream.get() == primary_stream.get())
+        {
+            stream = std::move(*primary_stream);
+        }
+        else // the compression stream owns the file stream, such that both stay valid when this file is moved
+        {
+            auto deleter = compression_stream.get_deleter();
+            secondary_stream = {compression_stream.release(),
+                                [primary_stream, deleter] (secondary_stream_type * ptr) { deleter(ptr); }};
+        }
+
         // initialise format handler or throw if format is not found
-        detail::set_format(format, _file_name);
+        detail::set_format(format, file_path);
     }
 
     /*!\brief Construct from an existing stream and with specified format.
@@ -651,8 +676,11 @@ public:
     /*!\cond DEV
      * \brief Expose a reference to the underlying stream object. [public, but not documented as part of the API]
      */
-    stream_type & get_stream()
+    std::basic_ostream<typename stream_type::char_type> & get_stream()
     {
+        if (secondary_stream != nullptr)
+            return *secondary_stream;
+
         return stream;
     }
     //!\endcond
@@ -685,6 +713,24 @@ protected:
     //!\brief The stream we are writing to.
     stream_type stream;
 
+    //!\brief The type of the compression stream.
+    using secondary_stream_type = std::basic_ostream<typename stream_type::char_type>;
+    //!\brief The compression stream we are writing to instead of #stream, if the file name requests compression.
+    std::unique_ptr<secondary_stream_type, std::function<void(secondary_stream_type *)>> secondary_stream{};
+
+    //!\brief The number of compression threads that the secondary stream was set to.
+    size_t applied_compression_threads{1};
+
+    //!\brief Hands seqan3::alignment_file_output_options::compression_threads to the secondary stream if it changed.
+    void update_compression_threads()
+    {
+        if (secondary_stream != nullptr && options.compression_threads != applied_compression_threads)
+        {
+            detail::set_compression_threads(*secondary_stream, options.compression_threads);
+            applied_compression_threads = options.compression_threads;
+        }
+    }
+
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
 
@@ -705,17 +751,27 @@ protected:
     {
         static_assert((sizeof...(pack_type) == 14), "Wrong parameter list passed to write_record.");
 
+        update_compression_threads();
+
         assert(!format.valueless_by_exception());
 
-        std::visit([&] (auto & f)
+        auto write = [&] (auto & f, auto & out)
         {
             // use header from record if explicitly given, e.g. file_out = file_in
             if constexpr (!std::Same<record_header_ptr_t, std::nullptr_t>)
-                f.write(stream, options, *record_header_ptr, std::forward<pack_type>(remainder)...);
+                f.write(out, options, *record_header_ptr, std::forward<pack_type>(remainder)...);
             else if constexpr (std::Same<ref_ids_type, ref_info_not_given>)
-                f.write(stream, options, std::ignore, std::forward<pack_type>(remainder)...);
+                f.write(out, options, std::ignore, std::forward<pack_type>(remainder)...);
+            else
+                f.write(out, options, *header_ptr, std::forward<pack_type>(remainder)...);
+        };
+
+        std::visit([&] (auto & f)
+        {
+            if (secondary_stream != nullptr)
+                write(f, *secondary_stream);
             else
-                f.write(stream, options, *header_ptr, std::forward<pack_type>(remainder)...);
+                write(f, stream);
         }, format);
     }
 
@@ -48,6 +48,14 @@
  * Formatted files employ compression/decompression streams transparently, i.e. if the given file-extension or
  * "magic-header" of a file suggest this, the respective stream is automatically (de-)compressed.
  *
+ * When writing to a file with the extension `.gz` or `.bgzf`, SeqAn always writes BGZF, because every GZip
+ * decompressor can read it and its independent blocks can be compressed on multiple threads. The number of threads is
+ * set by the `compression_threads` member of the output options of a file, e.g.
+ * seqan3::sequence_file_output_options::compression_threads, and BGZF input is decompressed on the number of threads
+ * given by the `decompression_threads` member of the input options. Both default to `1`, i.e. to the thread that
+ * reads or writes the file. The positions of a seqan3::contrib::basic_bgzf_istream are BGZF virtual offsets, i.e.
+ * `seekg()` gives random access to the blocks.
+ *
  * # Serialisation {#serialisation}
  *
  * \todo write me!
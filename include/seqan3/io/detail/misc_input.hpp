@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
 #include <tuple>
 
 #include <seqan3/core/concept/core_language.hpp>
@@ -21,6 +22,7 @@
     #include <seqan3/contrib/stream/bz2_istream.hpp>
 #endif
 #ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
     #include <seqan3/contrib/stream/gz_istream.hpp>
 #endif
 #include <seqan3/std/concepts>
@@ -67,6 +69,13 @@ inline bool starts_with(ref_t && reference, query_t && query)
  * \param[in,out] filename  The associated filename; compression extensions will be stripped. [optional]
  * \returns A pointer to the secondary stream with defaulted or NOP'ed deleter.
  * \throws seqan3::file_open_error If the magic bytes suggest compression, but is not supported/available.
+ *
+ * \details
+ *
+ * GZip input whose header has an extra field, as BGZF has, is decompressed by seqan3::contrib::basic_bgzf_istream,
+ * which falls back to serial decompression if the extra field is not the one of BGZF; see
+ * seqan3::detail::set_decompression_threads for decompressing BGZF on multiple threads. Other GZip input and streams
+ * whose characters are larger than one byte are decompressed serially.
  */
 template <char_concept char_t>
 inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream, std::filesystem::path & filename)
@@ -103,6 +112,12 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if ((extension == ".gz") || (extension == ".bgzf"))
             filename.replace_extension();
 
+        if constexpr (sizeof(char_t) == 1)
+        {
+            if (magic_number[3] & '\x04') // FEXTRA
+                return {new contrib::basic_bgzf_istream<char_t>{primary_stream}, stream_deleter_default};
+        }
+
         return {new contrib::basic_gz_istream<char_t>{primary_stream}, stream_deleter_default};
     #else
         throw file_open_error{"Trying to read from a gzipped file, but no ZLIB available."};
@@ -135,4 +150,25 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream)
     return make_secondary_istream(primary_stream, p);
 }
 
+/*!\brief Sets the number of threads of a decompression stream created by seqan3::detail::make_secondary_istream.
+ * \param[in] secondary_stream The stream returned by seqan3::detail::make_secondary_istream.
+ * \param[in] thread_count     The number of decompression threads; `0` is replaced by the number of hardware threads.
+ *
+ * \details
+ *
+ * Only BGZF is decompressed on multiple threads; other streams are not changed.
+ */
+template <char_concept char_t>
+inline void set_decompression_threads([[maybe_unused]] std::basic_istream<char_t> & secondary_stream,
+                                      [[maybe_unused]] size_t const thread_count)
+{
+#ifdef SEQAN3_HAS_ZLIB
+    if constexpr (sizeof(char_t) == 1)
+    {
+        if (auto * bgzf_buf = dynamic_cast<contrib::basic_bgzf_istreambuf<char_t> *>(secondary_stream.rdbuf()))
+            bgzf_buf->set_thread_count((thread_count == 0) ? std::thread::hardware_concurrency() : thread_count);
+    }
+#endif
+}
+
 } // namespace seqan3::detail
@@ -12,15 +12,21 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 
 #include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/filesystem>
 #ifdef SEQAN3_HAS_BZIP2
     #include <seqan3/contrib/stream/bz2_ostream.hpp>
 #endif
 #ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
 
@@ -32,6 +38,12 @@ namespace seqan3::detail
  * \param[in,out] filename  The associated filename; compression extensions will be stripped.
  * \returns A pointer to the secondary stream with defaulted or NOP'ed deleter.
  * \throws seqan3::file_open_error If a compression-extension is used, but is not supported/available.
+ *
+ * \details
+ *
+ * For `.gz`, `.bgzf` and `.bam`, BGZF is written; see seqan3::detail::set_compression_threads for compressing it on
+ * multiple threads. BGZF is a valid GZip file, hence this is also done if plain GZip was requested. Streams whose
+ * characters are larger than one byte are compressed with GZip instead.
  */
 template<char_concept char_t>
 inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream, std::filesystem::path & filename)
@@ -46,12 +58,14 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
 
     if ((extension == ".gz") || (extension == ".bgzf") || (extension == ".bam"))
     {
-        //TODO: always write bgzf even when gz was requested? It's compatible and faster
     #ifdef SEQAN3_HAS_ZLIB
         if (extension != ".bam") // remove extension except for bam
             filename.replace_extension("");
 
-        return {new contrib::basic_gz_ostream<char_t>{primary_stream}, stream_deleter_default};
+        if constexpr (sizeof(char_t) == 1)
+            return {new contrib::basic_bgzf_ostream<char_t>{primary_stream}, stream_deleter_default};
+        else
+            return {new contrib::basic_gz_ostream<char_t>{primary_stream}, stream_deleter_default};
     #else
         throw file_open_error{"Trying to write a gzipped file, but no ZLIB available."};
     #endif
@@ -73,4 +87,25 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     return {&primary_stream, stream_deleter_noop};
 }
 
+/*!\brief Sets the number of threads of a compression stream created by seqan3::detail::make_secondary_ostream.
+ * \param[in] secondary_stream The stream returned by seqan3::detail::make_secondary_ostream.
+ * \param[in] thread_count     The number of compression threads; `0` is replaced by the number of hardware threads.
+ *
+ * \details
+ *
+ * Only BGZF is compressed on multiple threads; other streams are not changed.
+ */
+template <char_concept char_t>
+inline void set_compression_threads([[maybe_unused]] std::basic_ostream<char_t> & secondary_stream,
+                                    [[maybe_unused]] size_t const thread_count)
+{
+#ifdef SEQAN3_HAS_ZLIB
+    if constexpr (sizeof(char_t) == 1)
+    {
+        if (auto * bgzf_buf = dynamic_cast<contrib::basic_bgzf_ostreambuf<char_t> *>(secondary_stream.rdbuf()))
+            bgzf_buf->set_thread_count((thread_count == 0) ? std::thread::hardware_concurrency() : thread_count);
+    }
+#endif
+}
+
 } // namespace seqan3::detail
@@ -0,0 +1,371 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_record_reader.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that reads from a range of characters in memory.
+ * \tparam char_t The character type.
+ * \ingroup io
+ */
+template <typename char_t>
+class chunk_stream_buffer : public std::basic_streambuf<char_t>
+{
+public:
+    //!\brief Constructs the stream buffer over `[begin, end)`; the characters are not copied.
+    chunk_stream_buffer(char_t * const begin, char_t * const end)
+    {
+        this->setg(begin, begin, end);
+    }
+
+    //!\brief Returns the number of characters that have been consumed.
+    size_t position() const noexcept
+    {
+        return this->gptr() - this->eback();
+    }
+};
+
+/*!\brief Parses the records of a stream on worker threads and hands them out in the order of the stream.
+ * \tparam record_t The type of the records.
+ * \tparam char_t   The character type of the stream.
+ * \ingroup io
+ *
+ * \details
+ *
+ * A reader thread reads the stream in chunks of at least #chunk_size characters and cuts them behind the last record
+ * that is complete. The rest is carried over to the next chunk. To find the records, the reader thread only skips
+ * over them, i.e. it finds the ends of the lines and counts the characters, but does not convert or store the fields.
+ * The worker threads parse all records of a chunk into a batch.
+ *
+ * The chunks are handed to the worker threads through a contrib::buffer_queue. For every chunk, the reader thread
+ * also enqueues a slot into a second queue in the order of the stream. #next_batch takes the next slot from that
+ * queue and waits until its batch is parsed, hence the batches are returned in the order of the stream regardless of
+ * which worker finishes first. If parsing a record throws, the records in front of it are returned as usual and the
+ * exception is rethrown by the following call to #next_batch. No records are returned behind it.
+ *
+ * A record is cut only if the reader thread stops skipping it before the end of the buffered characters, i.e. if it
+ * has seen the character that terminates the record. Since the formats never look ahead beyond the current character,
+ * the record is then parsed in the same way as if the whole stream were available. This requires a format that
+ * reports a record that is cut off by the end of the buffer as seqan3::unexpected_end_of_input. If skipping a record
+ * fails otherwise, the record is malformed: it starts the next chunk, whose worker reports the error, and the reader
+ * thread stops reading.
+ *
+ * Every worker thread creates its own record reader by invoking the factory passed on construction once, i.e. the
+ * state of a format is never shared between threads.
+ */
+template <typename record_t, typename char_t = char>
+class parallel_record_reader
+{
+public:
+    //!\brief The type of a batch of records.
+    using batch_type = std::vector<record_t>;
+    //!\brief The type of the stream.
+    using stream_type = std::basic_istream<char_t>;
+    //!\brief Skips one record in the stream.
+    using skip_function_type = std::function<void(stream_type &)>;
+    //!\brief Reads one record from the stream.
+    using read_function_type = std::function<void(stream_type &, record_t &)>;
+    //!\brief Creates the record reader of a worker thread.
+    using read_function_factory_type = std::function<read_function_type()>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parallel_record_reader() = delete;                                           //!< Deleted.
+    parallel_record_reader(parallel_record_reader const &) = delete;             //!< Deleted.
+    parallel_record_reader(parallel_record_reader &&) = delete;                  //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader const &) = delete; //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader &&) = delete;      //!< Deleted.
+
+    /*!\brief Spawns the reader thread and the worker threads.
+     * \param[in] source       The stream the records are read from; must not be accessed otherwise until this object
+     *                         is destroyed.
+     * \param[in] skip_record  Skips one record in a stream; invoked on the reader thread.
+     * \param[in] make_read_record Creates the function that reads one record from a stream; invoked once on every
+     *                         worker thread.
+     * \param[in] thread_count The number of worker threads; a value of `0` is replaced by
+     *                         `std::thread::hardware_concurrency()` (or 1 if this cannot be determined).
+     */
+    parallel_record_reader(stream_type & source,
+                           skip_function_type skip_record,
+                           read_function_factory_type make_read_record,
+                           size_t const thread_count) :
+        source{source},
+        skip_record{std::move(skip_record)},
+        make_read_record{std::move(make_read_record)}
+    {
+        size_t const num_threads = (thread_count == 0) ? std::max<size_t>(std::thread::hardware_concurrency(), 1u)
+                                                       : thread_count;
+
+        slot_queue = std::make_unique<contrib::fixed_buffer_queue<slot_pointer>>(num_threads * queue_factor);
+        chunk_queue = std::make_unique<contrib::fixed_buffer_queue<chunk_task>>(num_threads * queue_factor);
+
+        workers.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i)
+            workers.emplace_back([this] () { parse_chunks(); });
+
+        reader = std::thread{[this] () { read_chunks(); }};
+    }
+
+    //!\brief Stops reading, joins all threads and discards the batches that have not been returned.
+    ~parallel_record_reader()
+    {
+        stopped = true;
+        slot_queue->close();
+        chunk_queue->close();
+
+        if (reader.joinable())
+            reader.join();
+
+        for (auto & worker : workers)
+            if (worker.joinable())
+                worker.join();
+
+        // the queues must be empty on destruction
+        slot_pointer slot{};
+        while (slot_queue->try_pop(slot) == contrib::queue_op_status::success)
+        {}
+    }
+    //!\}
+
+    /*!\brief Returns the next batch of records.
+     * \param[out] batch Is overwritten with the next batch.
+     * \returns `false` if all records have been returned or an exception has been rethrown, `true` otherwise.
+     * \throws Rethrows the exception that occurred while reading or parsing the next chunk.
+     */
+    bool next_batch(batch_type & batch)
+    {
+        if (pending_exception)
+        {
+            stopped = true; // nothing behind the record that could not be parsed is returned
+            std::exception_ptr exception{};
+            std::swap(exception, pending_exception);
+            std::rethrow_exception(exception);
+        }
+
+        if (stopped)
+            return false;
+
+        slot_pointer slot{};
+        if (slot_queue->wait_pop(slot) == contrib::queue_op_status::closed)
+            return false;
+
+        batch = slot->result.get();
+        std::swap(pending_exception, slot->exception);
+        if (batch.empty() && pending_exception)
+            return next_batch(batch);
+
+        return true;
+    }
+
+    //!\brief The number of characters read from the stream at once.
+    static constexpr size_t chunk_size{1u << 20};
+
+private:
+    //!\brief The result of parsing one chunk.
+    struct slot_type
+    {
+        //!\brief Is set by the worker thread.
+        std::promise<batch_type> promise{};
+        //!\brief Is waited on by #next_batch.
+        std::future<batch_type> result{promise.get_future()};
+        //!\brief The exception thrown behind the last record of the batch; written before #promise is set.
+        std::exception_ptr exception{};
+    };
+
+    //!\brief Shared between the two queues.
+    using slot_pointer = std::shared_ptr<slot_type>;
+
+    //!\brief A chunk of complete records and the slot its batch is stored in.
+    struct chunk_task
+    {
+        //!\brief The characters of the records.
+        std::basic_string<char_t> chunk{};
+        //!\brief The slot the parsed batch is stored in.
+        slot_pointer slot{};
+    };
+
+    //!\brief Reads the stream, cuts it into chunks and enqueues them; runs on the reader thread.
+    void read_chunks()
+    {
+        try
+        {
+            std::basic_string<char_t> buffer{};
+            bool at_end = false;
+
+            while (!at_end && !stopped)
+            {
+                // at least double the buffer, such that records longer than a chunk are skipped a few times only
+                size_t const old_size = buffer.size();
+                size_t const read_size = std::max(chunk_size, old_size);
+                buffer.resize(old_size + read_size);
+                source.read(buffer.data() + old_size, read_size);
+                buffer.resize(old_size + source.gcount());
+                at_end = !source.good();
+
+                size_t const end = complete_prefix(buffer, at_end);
+                if (end == 0) // no record is complete yet
+                    continue;
+
+                chunk_task task{std::move(buffer), std::make_shared<slot_type>()};
+                buffer.assign(task.chunk, end);
+                task.chunk.resize(end);
+
+                slot_queue->push(task.slot);
+                chunk_queue->push(std::move(task));
+            }
+        }
+        catch (contrib::queue_op_status const &) // the queues have been closed by the destructor
+        {}
+        catch (...)
+        {
+            slot_pointer slot = std::make_shared<slot_type>();
+            slot->exception = std::current_exception();
+            slot->promise.set_value(batch_type{});
+            slot_queue->wait_push(slot);
+        }
+
+        chunk_queue->close();
+        slot_queue->close();
+    }
+
+    /*!\brief Returns the number of characters in front of the first record that is not complete.
+     * \param[in]     buffer The characters read from the stream.
+     * \param[in,out] at_end Whether `buffer` ends with the end of the stream; set if the buffer starts with a malformed
+     *                       record, which is handed to a worker as a whole to report the error.
+     */
+    size_t complete_prefix(std::basic_string<char_t> & buffer, bool & at_end)
+    {
+        if (at_end) // the workers report incomplete records at the end of the stream
+            return buffer.size();
+
+        chunk_stream_buffer<char_t> chunk_buffer{buffer.data(), buffer.data() + buffer.size()};
+        stream_type stream{&chunk_buffer};
+
+        size_t end = 0;
+        while (end < buffer.size())
+        {
+            try
+            {
+                skip_record(stream);
+            }
+            catch (unexpected_end_of_input const &) // the record continues behind the buffer
+            {
+                return end;
+            }
+            catch (...) // the record is malformed; it starts the next chunk, whose worker reports the error
+            {
+                return malformed_record(buffer, end, at_end);
+            }
+
+            size_t const position = chunk_buffer.position();
+            if (position == buffer.size()) // the record might continue behind the buffer
+                return end;
+            if (position == end) // no progress
+                return malformed_record(buffer, end, at_end);
+
+            end = position;
+        }
+
+        return end;
+    }
+
+    /*!\brief Handles a malformed record at position `end` of the buffer, see complete_prefix().
+     * \returns `end` if there are complete records in front of the malformed one; otherwise the size of the buffer and
+     *          `at_end` is set, such that nothing behind the malformed record is read.
+     */
+    static size_t malformed_record(std::basic_string<char_t> const & buffer, size_t const end, bool & at_end) noexcept
+    {
+        if (end > 0)
+            return end;
+
+        at_end = true;
+        return buffer.size();
+    }
+
+    //!\brief Parses the chunks into batches; runs on every worker thread.
+    void parse_chunks()
+    {
+        read_function_type const read_record = make_read_record();
+
+        chunk_task task{};
+        while (chunk_queue->wait_pop(task) != contrib::queue_op_status::closed)
+        {
+            if (!stopped)
+            {
+                chunk_stream_buffer<char_t> chunk_buffer{task.chunk.data(), task.chunk.data() + task.chunk.size()};
+                stream_type stream{&chunk_buffer};
+
+                batch_type batch{};
+                try
+                {
+                    while (chunk_buffer.position() < task.chunk.size())
+                    {
+                        batch.emplace_back();
+                        read_record(stream, batch.back());
+                    }
+                }
+                catch (...)
+                {
+                    batch.pop_back(); // the record that could not be parsed
+                    task.slot->exception = std::current_exception();
+                }
+
+                task.slot->promise.set_value(std::move(batch));
+            }
+
+            task = chunk_task{};
+        }
+    }
+
+    //!\brief The number of queued chunks per worker thread.
+    static constexpr size_t queue_factor{2};
+
+    //!\brief The stream the records are read from.
+    stream_type & source;
+    //!\brief Skips one record.
+    skip_function_type skip_record;
+    //!\brief Creates the record reader of a worker thread.
+    read_function_factory_type make_read_record;
+
+    //!\brief The slots of the enqueued chunks in the order of the stream.
+    std::unique_ptr<contrib::fixed_buffer_queue<slot_pointer>> slot_queue{};
+    //!\brief The chunks that wait to be parsed.
+    std::unique_ptr<contrib::fixed_buffer_queue<chunk_task>> chunk_queue{};
+    //!\brief The exception to rethrow on the next call to #next_batch.
+    std::exception_ptr pending_exception{};
+    //!\brief Set on destruction or once an exception has been rethrown to stop all threads early.
+    std::atomic<bool> stopped{false};
+
+    //!\brief The thread that reads and cuts the stream.
+    std::thread reader{};
+    //!\brief The threads that parse the chunks.
+    std::vector<std::thread> workers{};
+};
+
+} // namespace seqan3::detail
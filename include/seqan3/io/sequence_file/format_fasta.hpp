@@ -15,15 +15,15 @@
 #include <iterator>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/chunk.hpp>
-#include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/remove_if.hpp>
-#include <range/v3/view/take_while.hpp>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/metafunction/range.hpp>
@@ -32,14 +32,11 @@
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/io/stream/detail/stream_buffer_scanner.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/detail/misc.hpp>
-#include <seqan3/range/view/char_to.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/range/view/take.hpp>
-#include <seqan3/range/view/take_exactly.hpp>
-#include <seqan3/range/view/take_line.hpp>
-#include <seqan3/range/view/take_until.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
 
@@ -116,16 +113,13 @@ public:
               id_type                                                                & id,
               qual_type                                                              & SEQAN3_DOXYGEN_ONLY(qualities))
     {
-        using stream_char_t = typename stream_type::char_type;
-        auto stream_view = std::ranges::subrange<decltype(std::istreambuf_iterator<stream_char_t>{stream}),
-                                          decltype(std::istreambuf_iterator<stream_char_t>{})>
-                            {std::istreambuf_iterator<stream_char_t>{stream},
-                             std::istreambuf_iterator<stream_char_t>{}};
+        detail::stream_buffer_scanner scanner{*stream.rdbuf()};
+
         // ID
-        read_id(stream_view, options, id);
+        read_id(scanner, options, id);
 
         // Sequence
-        read_seq(stream_view, options, sequence);
+        read_seq(scanner, options, sequence);
     }
 
     //!\copydoc SequenceFileOutputFormat::write
@@ -172,51 +166,69 @@ public:
 protected:
     //!\privatesection
     //!\brief Implementation of reading the ID.
-    template <typename stream_view_t,
+    template <typename stream_char_t, typename stream_traits_t,
               typename seq_legal_alph_type, bool seq_qual_combined,
               typename id_type>
-    void read_id(stream_view_t                                                          & stream_view,
+    void read_id(detail::stream_buffer_scanner<stream_char_t, stream_traits_t>        & scanner,
                  sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const & options,
                  id_type                                                                & id)
     {
         auto const is_id = is_char<'>'> || is_char<';'>;
 
-        if (!is_id(*begin(stream_view)))
+        stream_char_t const first = stream_traits_t::to_char_type(scanner.peek());
+        if (!is_id(first))
             throw parse_error{std::string{"Expected to be on beginning of ID, but "} + is_id.msg.str() +
-                              " evaluated to false on " + detail::make_printable(*begin(stream_view))};
+                              " evaluated to false on " + detail::make_printable(first)};
 
         // read id
         if constexpr (!detail::decays_to_ignore_v<id_type>)
         {
-            if (options.truncate_ids)
+            auto append_id = [&id] (stream_char_t const * begin, stream_char_t const * const end)
             {
-                std::ranges::copy(stream_view | std::view::drop_while(is_id || is_blank)     // skip leading >
-                                              | view::take_until_or_throw(is_cntrl || is_blank) // read ID until delimiter…
-                                              | view::char_to<value_type_t<id_type>>,
-                                  std::back_inserter(id));                                      // … ^A is old delimiter
+                if constexpr (std::is_same_v<value_type_t<id_type>, stream_char_t>)
+                {
+                    id.insert(id.end(), begin, end);
+                }
+                else
+                {
+                    for (; begin != end; ++begin)
+                        id.push_back(assign_char_to(*begin, value_type_t<id_type>{}));
+                }
+            };
 
+            if (options.truncate_ids)
+            {
+                scanner.skip(is_id || is_blank);                        // skip leading >
+                scanner.read_until(is_cntrl || is_blank, append_id);    // read ID until delimiter…
+                                                                        // … ^A is old delimiter
                 // consume rest of line
-                detail::consume(stream_view | view::take_line_or_throw);
+                scanner.skip_line();
             }
             else
             {
-                std::ranges::copy(stream_view | view::take_line_or_throw                                        // read line
-                                              | std::view::drop_while(is_id || is_blank)                     // skip leading >
-                                              | view::char_to<value_type_t<id_type>>,
-                                  std::back_inserter(id));
+                bool leading = true;
+                scanner.read_line([&] (stream_char_t const * begin, stream_char_t const * const end) // read line
+                {
+                    if (leading)                                                            // skip leading >
+                    {
+                        begin = std::find_if_not(begin, end, is_id || is_blank);
+                        leading = (begin == end);
+                    }
+                    append_id(begin, end);
+                });
             }
         }
         else
         {
-            detail::consume(stream_view | view::take_line_or_throw);
+            scanner.skip_line();
         }
     }
 
     //!\brief Implementation of reading the sequence.
-    template <typename stream_view_t,
+    template <typename stream_char_t, typename stream_traits_t,
               typename seq_legal_alph_type, bool seq_qual_combined,
               typename seq_type>
-    void read_seq(stream_view_t                                                          & stream_view,
+    void read_seq(detail::stream_buffer_scanner<stream_char_t, stream_traits_t>        & scanner,
                   sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const &,
                   seq_type                                                               & seq)
     {
@@ -225,25 +237,35 @@ protected:
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-            std::ranges::copy(stream_view | view::take_until(is_id)                      // until next header (or end)
-                                          | std::view::filter(!(is_space || is_digit))// ignore whitespace and numbers
-                                          | std::view::transform([is_legal_alph] (char const c)
-                                            {
-                                                if (!is_legal_alph(c))
-                                                {
-                                                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                        is_legal_alph.msg.str() +
-                                                                        " evaluated to false on " +
-                                                                        detail::make_printable(c)};
-                                                }
-                                                return c;
-                                            })                                           // enforce legal alphabet
-                                          | view::char_to<value_type_t<seq_type>>,       // convert to actual target alphabet
-                              std::back_inserter(seq));
+            scanner.scan([&seq, is_id, is_legal_alph] (stream_char_t const * const begin,
+                                                       stream_char_t const * const end)
+            {
+                stream_char_t const * const stop = std::find_if(begin, end, is_id);   // until next header (or end)
+                for (stream_char_t const * it = begin; it != stop; ++it)
+                {
+                    char const c = *it;
+                    if (is_space(c) || is_digit(c))                                     // ignore whitespace and numbers
+                        continue;
+
+                    if (!is_legal_alph(c))                                              // enforce legal alphabet
+                    {
+                        throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                            is_legal_alph.msg.str() +
+                                            " evaluated to false on " +
+                                            detail::make_printable(c)};
+                    }
+
+                    seq.push_back(assign_char_to(c, value_type_t<seq_type>{}));        // convert to target alphabet
+                }
+                return stop;
+            });
         }
         else
         {
-            detail::consume(stream_view | view::take_until(is_id));
+            scanner.scan([is_id] (stream_char_t const * const begin, stream_char_t const * const end)
+            {
+                return std::find_if(begin, end, is_id);
+            });
         }
     }
 
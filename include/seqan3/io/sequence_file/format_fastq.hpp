@@ -15,6 +15,7 @@
 #include <iterator>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <range/v3/algorithm/copy.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/remove_if.hpp>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/metafunction/range.hpp>
@@ -30,14 +32,11 @@
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/io/stream/detail/stream_buffer_scanner.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/detail/misc.hpp>
-#include <seqan3/range/view/char_to.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/range/view/take.hpp>
-#include <seqan3/range/view/take_exactly.hpp>
-#include <seqan3/range/view/take_line.hpp>
-#include <seqan3/range/view/take_until.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
 
@@ -110,12 +109,8 @@ public:
               qual_type                                                              & qualities)
     {
         using stream_char_t = typename stream_type::char_type;
-        auto stream_view = std::ranges::subrange<decltype(std::istreambuf_iterator<stream_char_t>{stream}),
-                                                 decltype(std::istreambuf_iterator<stream_char_t>{})>
-                            {std::istreambuf_iterator<stream_char_t>{stream},
-                             std::istreambuf_iterator<stream_char_t>{}};
-
-        auto stream_it = begin(stream_view);
+        using stream_traits_t = typename stream_type::traits_type;
+        detail::stream_buffer_scanner scanner{*stream.rdbuf()};
 
         // cache the begin position so we write quals to the same position as seq in seq_qual case
         size_t sequence_size_before = 0;
@@ -124,92 +119,127 @@ public:
             sequence_size_before = size(sequence);
 
         /* ID */
-        if (*stream_it != '@') // [[unlikely]]
+        stream_char_t const first = stream_traits_t::to_char_type(scanner.peek());
+        if (first != '@') // [[unlikely]]
         {
             throw parse_error{std::string{"Expected '@' on beginning of ID line, got: "} +
-                              detail::make_printable(*stream_it)};
+                              detail::make_printable(first)};
         }
-        ++stream_it; // skip '@'
+        scanner.bump(); // skip '@'
 
         if constexpr (!detail::decays_to_ignore_v<id_type>)
         {
+            auto append_id = [&id] (stream_char_t const * begin, stream_char_t const * const end)
+            {
+                if constexpr (std::is_same_v<value_type_t<id_type>, stream_char_t>)
+                {
+                    id.insert(id.end(), begin, end);
+                }
+                else
+                {
+                    for (; begin != end; ++begin)
+                        id.push_back(assign_char_to(*begin, value_type_t<id_type>{}));
+                }
+            };
+
             if (options.truncate_ids)
             {
-                std::ranges::copy(stream_view | view::take_until_or_throw(is_cntrl || is_blank)
-                                              | view::char_to<value_type_t<id_type>>,
-                                  std::back_inserter(id));
-                detail::consume(stream_view | view::take_line_or_throw);
+                scanner.read_until(is_cntrl || is_blank, append_id);
+                scanner.skip_line();
             }
             else
             {
-                std::ranges::copy(stream_view | view::take_line_or_throw
-                                              | view::char_to<value_type_t<id_type>>,
-                                  std::back_inserter(id));
+                scanner.read_line(append_id);
             }
         }
         else
         {
-            detail::consume(stream_view | view::take_line_or_throw);
+            scanner.skip_line();
         }
 
         /* Sequence */
-        auto seq_view = stream_view | view::take_until_or_throw(is_char<'+'>)    // until 2nd ID line
-                                    | std::view::filter(!is_space);           // ignore whitespace
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-            std::ranges::copy(seq_view | std::view::transform([is_legal_alph] (char const c) // enforce legal alphabet
-                                    {
-                                        if (!is_legal_alph(c))
-                                        {
-                                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                is_legal_alph.msg.str() +
-                                                                " evaluated to false on " +
-                                                                detail::make_printable(c)};
-                                        }
-                                        return c;
-                                    })
-                                        | view::char_to<value_type_t<seq_type>>,         // convert to actual target alphabet
-                              std::back_inserter(sequence));
+            scanner.read_until_char('+', [&sequence, is_legal_alph] (stream_char_t const * begin,   // until 2nd ID line
+                                                                     stream_char_t const * const end)
+            {
+                for (; begin != end; ++begin)
+                {
+                    char const c = *begin;
+                    if (is_space(c))                                                    // ignore whitespace
+                        continue;
+
+                    if (!is_legal_alph(c))                                              // enforce legal alphabet
+                    {
+                        throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                            is_legal_alph.msg.str() +
+                                            " evaluated to false on " +
+                                            detail::make_printable(c)};
+                    }
+
+                    sequence.push_back(assign_char_to(c, value_type_t<seq_type>{}));   // convert to target alphabet
+                }
+            });
             sequence_size_after = size(sequence);
         }
         else // consume, but count
         {
-            auto it = begin(seq_view);
-            auto it_end = end(seq_view);
-            while (it != it_end)
+            scanner.read_until_char('+', [&sequence_size_after] (stream_char_t const * const begin,
+                                                                 stream_char_t const * const end)
             {
-                ++it;
-                ++sequence_size_after;
-            }
+                sequence_size_after += std::count_if(begin, end, !is_space);
+            });
         }
 
         /* 2nd ID line */
-        if (*stream_it != '+') // [[unlikely]]
-        {
-            throw parse_error{std::string{"Expected '+' on beginning of 2nd ID line, got: "} +
-                              detail::make_printable(*stream_it)};
-        }
-        detail::consume(stream_view | view::take_line_or_throw);
+        scanner.skip_line(); // the sequence is read up to the '+'
 
         /* Qualities */
-        auto qview = stream_view | std::view::filter(!is_space)                  // this consumes trailing newline
-                                 | view::take_exactly_or_throw(sequence_size_after - sequence_size_before);
+        size_t qualities_left = sequence_size_after - sequence_size_before;
+        auto read_qualities = [&scanner, &qualities_left] (auto && on_quality)
+        {
+            scanner.scan([&] (stream_char_t const * begin, stream_char_t const * const end)
+            {
+                for (; begin != end && qualities_left > 0; ++begin)
+                {
+                    if (!is_space(*begin))
+                    {
+                        on_quality(*begin);
+                        --qualities_left;
+                    }
+                }
+                return begin;
+            });
+
+            if (qualities_left > 0)
+                throw unexpected_end_of_input{"Reached end of input before designated size."};
+
+            scanner.skip(is_space); // consume trailing newline
+        };
+
         if constexpr (seq_qual_combined)
         {
             // seq_qual field implies that they are the same variable
             assert(std::addressof(sequence) == std::addressof(qualities));
-            std::ranges::copy(qview | view::char_to<typename value_type_t<qual_type>::quality_alphabet_type>,
-                              begin(qualities) + sequence_size_before);
+            using quality_alphabet_t = typename value_type_t<qual_type>::quality_alphabet_type;
+            auto qualities_it = begin(qualities) + sequence_size_before;
+            read_qualities([&qualities_it] (char const c)
+            {
+                *qualities_it = assign_char_to(c, quality_alphabet_t{});
+                ++qualities_it;
+            });
         }
         else if constexpr (!detail::decays_to_ignore_v<qual_type>)
         {
-            std::ranges::copy(qview | view::char_to<value_type_t<qual_type>>,
-                              std::back_inserter(qualities));
+            read_qualities([&qualities] (char const c)
+            {
+                qualities.push_back(assign_char_to(c, value_type_t<qual_type>{}));
+            });
         }
         else
         {
-            detail::consume(qview);
+            read_qualities([] (char const) {});
         }
     }
 
@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -32,6 +33,7 @@
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/parallel_record_reader.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
@@ -327,6 +329,30 @@ struct sequence_file_input_default_traits_aa : sequence_file_input_default_trait
  * of the file. If you require different column types you can specify you own traits, see
  * seqan3::SequenceFileInputTraits.
  *
+ * ### Batch-wise reading
+ *
+ * Instead of record by record, the file can be read in batches of a fixed number of records with read_batch(). A batch
+ * has the same type as the columns, i.e. it holds one seqan3::concatenated_sequences per field by default, and is
+ * reused by every call. In serial mode, reading does not allocate memory once the batch has grown large enough; in
+ * parallel mode (see below), the worker threads still parse every record into newly allocated fields:
+ *
+ * \snippet test/snippet/io/sequence_file/sequence_file_input.cpp read_batch
+ *
+ * ### Parallel parsing
+ *
+ * If seqan3::sequence_file_input_options::parsing_threads is set to a value other than `1`, the records behind the
+ * current one are parsed on multiple threads: a reader thread cuts the (decompressed) stream into chunks of complete
+ * records and worker threads parse the chunks into batches of records. The records are still returned in the order
+ * of the file and errors are reported at the record they occur in; no records are returned behind an error. The
+ * options are copied when the parallel mode starts, i.e. on the first read behind the record that was read last in
+ * serial mode; later changes of the options have no effect. The stream must not be accessed otherwise while the file
+ * is read in parallel.
+ *
+ * The parallel mode is available for seqan3::sequence_file_format_fasta and seqan3::sequence_file_format_fastq; files
+ * in other formats are read serially regardless of the option.
+ *
+ * \snippet test/snippet/io/sequence_file/sequence_file_input.cpp parallel
+ *
  * ### Formats
  *
  * TODO give overview of formats, once they are all implemented
@@ -468,8 +494,31 @@ public:
     sequence_file_input & operator=(sequence_file_input const &) = delete;
     //!\brief Move construction is defaulted.
     sequence_file_input(sequence_file_input &&) = default;
-    //!\brief Move assignment is defaulted.
-    sequence_file_input & operator=(sequence_file_input &&) = default;
+    /*!\brief Move assignment.
+     *
+     * \details
+     *
+     * In parallel mode, the threads of this file read from its stream, hence they are stopped and joined before the
+     * stream is replaced.
+     */
+    sequence_file_input & operator=(sequence_file_input && rhs)
+    {
+        parallel_reader = std::move(rhs.parallel_reader);
+        record_batch = std::move(rhs.record_batch);
+        record_batch_position = rhs.record_batch_position;
+        serial_format = rhs.serial_format;
+
+        options = std::move(rhs.options);
+        record_buffer = std::move(rhs.record_buffer);
+        columns_buffer = std::move(rhs.columns_buffer);
+        batch_buffer = std::move(rhs.batch_buffer);
+        primary_stream = std::move(rhs.primary_stream);
+        secondary_stream = std::move(rhs.secondary_stream);
+        at_end = rhs.at_end;
+        format = std::move(rhs.format);
+        applied_decompression_threads = rhs.applied_decompression_threads;
+        return *this;
+    }
     //!\brief Destructor is defaulted.
     ~sequence_file_input() = default;
 
@@ -691,6 +740,46 @@ public:
     }
     //!\}
 
+    /*!\name Batch interface
+     * \{
+     */
+    /*!\brief Read the next records into the columns of a batch.
+     * \param[in] n The maximum number of records to read.
+     * \returns The batch; it holds fewer than `n` records only at the end of the file and no records behind it.
+     *
+     * \details
+     *
+     * The batch starts with the record the file is currently at, i.e. the one returned by front(), and the file is
+     * at the record behind the batch afterwards. The batch is stored in a buffer of the file that is reused by the
+     * next call, hence the returned reference becomes invalid once read_batch() is called again. Since neither the
+     * columns (seqan3::concatenated_sequences by default) nor the buffer of the current record release their memory,
+     * reading batches of similar size in serial mode does not allocate once the buffers have grown large enough. In
+     * parallel mode, i.e. if seqan3::sequence_file_input_options::parsing_threads is not `1`, every record is parsed
+     * into new fields by a worker thread, hence the batch only saves the allocations of the columns.
+     *
+     * \snippet test/snippet/io/sequence_file/sequence_file_input.cpp read_batch
+     */
+    file_as_tuple_type & read_batch(size_t const n)
+    {
+        if constexpr (selected_field_ids::contains(field::SEQ))
+            seqan3::get<field::SEQ>(batch_buffer).clear();
+        if constexpr (selected_field_ids::contains(field::ID))
+            seqan3::get<field::ID>(batch_buffer).clear();
+        if constexpr (selected_field_ids::contains(field::QUAL))
+            seqan3::get<field::QUAL>(batch_buffer).clear();
+        if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
+            seqan3::get<field::SEQ_QUAL>(batch_buffer).clear();
+
+        for (size_t i = 0; i < n && !at_end; ++i)
+        {
+            append_record(batch_buffer);
+            read_next_record();
+        }
+
+        return batch_buffer;
+    }
+    //!\}
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::SEQ_QUAL)> options;
@@ -704,6 +793,8 @@ protected:
     record_type record_buffer;
     //!\brief Buffer of the entire file in columns.
     file_as_tuple_type columns_buffer;
+    //!\brief Buffer of the batch returned by read_batch().
+    file_as_tuple_type batch_buffer;
     //!\}
 
     /*!\name Stream / file access
@@ -725,18 +816,66 @@ protected:
     //!\brief File is at position 1 behind the last record.
     bool at_end{false};
 
+    //!\brief Parses the records on worker threads in parallel mode; `nullptr` in serial mode.
+    std::unique_ptr<detail::parallel_record_reader<record_type, stream_char_type>> parallel_reader{};
+    //!\brief The batch of records returned by the parallel reader.
+    std::vector<record_type> record_batch{};
+    //!\brief The position of the next record in #record_batch.
+    size_t record_batch_position{0};
+    //!\brief Whether the format of the file cannot be parsed in parallel, see start_parallel_reader().
+    bool serial_format{false};
+
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
     //!\}
 
+    //!\brief The number of decompression threads that the secondary stream was set to.
+    size_t applied_decompression_threads{1};
+
+    //!\brief Hands seqan3::sequence_file_input_options::decompression_threads to the secondary stream if it changed.
+    void update_decompression_threads()
+    {
+        if (options.decompression_threads != applied_decompression_threads)
+        {
+            detail::set_decompression_threads(*secondary_stream, options.decompression_threads);
+            applied_decompression_threads = options.decompression_threads;
+        }
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
         // clear the record
         record_buffer.clear();
 
+        if (parallel_reader == nullptr) // the stream belongs to the reader thread in parallel mode
+            update_decompression_threads();
+
+        if (options.parsing_threads != 1 && parallel_reader == nullptr && !at_end && !serial_format)
+        {
+            start_parallel_reader();
+            serial_format = (parallel_reader == nullptr);
+        }
+
+        if (parallel_reader != nullptr)
+        {
+            while (record_batch_position == record_batch.size())
+            {
+                record_batch.clear();
+                record_batch_position = 0;
+                if (!parallel_reader->next_batch(record_batch))
+                {
+                    at_end = true;
+                    return;
+                }
+            }
+
+            record_buffer = std::move(record_batch[record_batch_position++]);
+            return;
+        }
+
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
              std::istreambuf_iterator<stream_char_type>{}))
@@ -749,21 +888,73 @@ protected:
         std::visit([&] (SequenceFileInputFormat & f)
         {
             // read new record
-            if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
-            {
-                f.read(*secondary_stream,
-                       options,
-                       detail::get_or_ignore<field::SEQ_QUAL>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::SEQ_QUAL>(record_buffer));
-            }
-            else
+            read_record(f, *secondary_stream, options, record_buffer);
+        }, format);
+    }
+
+    //!\brief Read a single record with the given format.
+    template <typename format_t, typename options_t>
+    static void read_record(format_t & f,
+                            std::basic_istream<stream_char_type> & stream,
+                            options_t const & options,
+                            record_type & record)
+    {
+        if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
+        {
+            f.read(stream,
+                   options,
+                   detail::get_or_ignore<field::SEQ_QUAL>(record),
+                   detail::get_or_ignore<field::ID>(record),
+                   detail::get_or_ignore<field::SEQ_QUAL>(record));
+        }
+        else
+        {
+            f.read(stream,
+                   options,
+                   detail::get_or_ignore<field::SEQ>(record),
+                   detail::get_or_ignore<field::ID>(record),
+                   detail::get_or_ignore<field::QUAL>(record));
+        }
+    }
+
+    /*!\brief Hand the rest of the stream to a seqan3::detail::parallel_record_reader.
+     *
+     * \details
+     *
+     * The reader thread and every worker thread hold their own instance of the format; the options are copied.
+     * Only the formats that report a record that is cut off as seqan3::unexpected_end_of_input are read in parallel,
+     * i.e. FASTA and FASTQ; the file stays in serial mode otherwise.
+     */
+    void start_parallel_reader()
+    {
+        assert(!format.valueless_by_exception());
+        std::visit([&] (SequenceFileInputFormat & f)
+        {
+            using format_t = remove_cvref_t<decltype(f)>;
+            using stream_t = std::basic_istream<stream_char_type>;
+            using reader_t = detail::parallel_record_reader<record_type, stream_char_type>;
+
+            if constexpr (std::Same<format_t, sequence_file_format_fasta> ||
+                          std::Same<format_t, sequence_file_format_fastq>)
             {
-                f.read(*secondary_stream,
-                       options,
-                       detail::get_or_ignore<field::SEQ>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::QUAL>(record_buffer));
+                // the formats are not copyable, but std::function requires copyable functions
+                auto skip_record = [skip_format = std::make_shared<format_t>()] (stream_t & stream)
+                {
+                    sequence_file_input_options<typename traits_type::sequence_legal_alphabet, false> skip_options{};
+                    skip_format->read(stream, skip_options, std::ignore, std::ignore, std::ignore);
+                };
+
+                auto make_parse_record = [options = options] ()
+                {
+                    return typename reader_t::read_function_type{[options, parse_format = std::make_shared<format_t>()]
+                                                                 (stream_t & stream, record_type & record)
+                    {
+                        read_record(*parse_format, stream, options, record);
+                    }};
+                };
+
+                parallel_reader = std::make_unique<reader_t>(*secondary_stream, skip_record, make_parse_record,
+                                                             options.parsing_threads);
             }
         }, format);
     }
@@ -772,26 +963,33 @@ protected:
     void read_columns()
     {
         //TODO don't do multiple visits
-        //TODO create specialised version for concatenated_sequences where we append on the concat
-        auto & sequence_column_buffer = detail::get_or_ignore<field::SEQ>(columns_buffer);
-        auto &       id_column_buffer = detail::get_or_ignore<field::ID>(columns_buffer);
-        auto &     qual_column_buffer = detail::get_or_ignore<field::QUAL>(columns_buffer);
-        auto & seq_qual_column_buffer = detail::get_or_ignore<field::SEQ_QUAL>(columns_buffer);
-
         // read the remaining records and split into column buffers
-        for (auto & rec : *this)
+        while (!at_end)
         {
-            if constexpr (selected_field_ids::contains(field::SEQ))
-                sequence_column_buffer.push_back(std::move(seqan3::get<field::SEQ>(rec)));
-            if constexpr (selected_field_ids::contains(field::ID))
-                id_column_buffer.push_back(std::move(seqan3::get<field::ID>(rec)));
-            if constexpr (selected_field_ids::contains(field::QUAL))
-                qual_column_buffer.push_back(std::move(seqan3::get<field::QUAL>(rec)));
-            if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
-                seq_qual_column_buffer.push_back(std::move(seqan3::get<field::SEQ_QUAL>(rec)));
+            append_record(columns_buffer);
+            read_next_record();
         }
     }
 
+    /*!\brief Append the fields of the current record to the columns.
+     *
+     * \details
+     *
+     * seqan3::concatenated_sequences copies the fields onto its concatenation, hence the buffer of the current record
+     * keeps its memory; other column types take over the memory of the fields.
+     */
+    void append_record(file_as_tuple_type & columns)
+    {
+        if constexpr (selected_field_ids::contains(field::SEQ))
+            seqan3::get<field::SEQ>(columns).push_back(std::move(seqan3::get<field::SEQ>(record_buffer)));
+        if constexpr (selected_field_ids::contains(field::ID))
+            seqan3::get<field::ID>(columns).push_back(std::move(seqan3::get<field::ID>(record_buffer)));
+        if constexpr (selected_field_ids::contains(field::QUAL))
+            seqan3::get<field::QUAL>(columns).push_back(std::move(seqan3::get<field::QUAL>(record_buffer)));
+        if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
+            seqan3::get<field::SEQ_QUAL>(columns).push_back(std::move(seqan3::get<field::SEQ_QUAL>(record_buffer)));
+    }
+
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
 };
@@ -28,6 +28,22 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete header to id.
     bool embl_genbank_complete_header = false;
+    /*!\brief The number of threads that parse the records of seqan3::sequence_file_input.
+     *
+     * \details
+     *
+     * Any value other than `1` enables the parallel mode, see seqan3::sequence_file_input; a value of `0` is replaced
+     * by the number of hardware threads.
+     */
+    size_t parsing_threads = 1;
+    /*!\brief The number of threads that decompress the input if it is BGZF, e.g. a `.bam` or most `.gz` files.
+     *
+     * \details
+     *
+     * A value of `1` decompresses on the reading thread; a value of `0` is replaced by the number of hardware threads.
+     * Takes effect at the next record that is read, unless the file is already read in parallel mode.
+     */
+    size_t decompression_threads = 1;
 };
 
 } // namespace seqan3
@@ -622,6 +622,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The number of compression threads that the secondary stream was set to.
+    size_t applied_compression_threads{1};
+
+    //!\brief Hands seqan3::sequence_file_output_options::compression_threads to the secondary stream if it changed.
+    void update_compression_threads()
+    {
+        if (options.compression_threads != applied_compression_threads)
+        {
+            detail::set_compression_threads(*secondary_stream, options.compression_threads);
+            applied_compression_threads = options.compression_threads;
+        }
+    }
+
     //!\brief Write record to format.
     template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
     void write_record(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
@@ -634,6 +647,8 @@ protected:
             static_assert(detail::is_type_specialisation_of_v<value_type_t<seq_qual_t>, qualified>,
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
+        update_compression_threads();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
@@ -681,6 +696,8 @@ protected:
             static_assert(detail::is_type_specialisation_of_v<value_type_t<reference_t<seq_quals_t>>, qualified>,
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
+        update_compression_threads();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
@@ -40,6 +40,15 @@ struct sequence_file_output_options
 
     //!\brief Complete header given for embl or genbank
     bool        embl_genbank_complete_header  = false;
+
+    /*!\brief The number of threads that compress the output if it is written as BGZF, e.g. to a `.gz` file.
+     *
+     * \details
+     *
+     * A value of `1` compresses on the writing thread; a value of `0` is replaced by the number of hardware threads.
+     * Takes effect at the next record that is written.
+     */
+    size_t      compression_threads     = 1;
 };
 
 } // namespace seqan3
@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::stream_buffer_scanner.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iosfwd>
+#include <streambuf>
+#include <string>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Functionally the same as std::basic_streambuf<char_t, traits_t>, but exposes the protected members of the
+ *        get area.
+ * \tparam char_t   The stream's character type.
+ * \tparam traits_t The stream's traits type.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+struct stream_buffer_exposer : public std::basic_streambuf<char_t, traits_t>
+{
+    //!\brief The actual stream type.
+    using base_t = std::basic_streambuf<char_t, traits_t>;
+
+    //!\cond
+    // Expose protected members:
+    using base_t::gptr;
+    using base_t::egptr;
+    using base_t::gbump;
+    //!\endcond
+};
+
+/*!\brief Reads from the get area of a stream buffer chunk by chunk.
+ * \tparam char_t   The stream's character type.
+ * \tparam traits_t The stream's traits type.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * Reading through std::istreambuf_iterator costs a call into the stream buffer for every character. This class
+ * instead hands the characters that are buffered, i.e. the range `[gptr(), egptr())` of the stream buffer, as a whole
+ * to a callable that processes them and returns where it stopped. Only once the chunk is exhausted, the stream buffer
+ * is refilled, hence records that span the boundaries of the buffer are read without special treatment.
+ * Stream buffers that do not expose a get area are read one character at a time.
+ *
+ * The scanner holds no state besides the stream buffer, hence it can be mixed freely with other means of reading
+ * from the same stream buffer.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class stream_buffer_scanner
+{
+public:
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    stream_buffer_scanner() = delete;                                                              //!< Deleted.
+    constexpr stream_buffer_scanner(stream_buffer_scanner const &) noexcept = default;             //!< Defaulted.
+    constexpr stream_buffer_scanner(stream_buffer_scanner &&) noexcept = default;                  //!< Defaulted.
+    constexpr stream_buffer_scanner & operator=(stream_buffer_scanner const &) noexcept = default; //!< Defaulted.
+    constexpr stream_buffer_scanner & operator=(stream_buffer_scanner &&) noexcept = default;      //!< Defaulted.
+    ~stream_buffer_scanner() = default;                                                            //!< Defaulted.
+
+    //!\brief Construct from a stream buffer.
+    explicit stream_buffer_scanner(std::basic_streambuf<char_t, traits_t> & buffer) noexcept :
+        stream_buf{reinterpret_cast<stream_buffer_exposer<char_t, traits_t> *>(&buffer)}
+    {}
+    //!\}
+
+    //!\brief Returns the next character without consuming it, or `traits_t::eof()` at the end of the input.
+    int_type peek()
+    {
+        return stream_buf->sgetc();
+    }
+
+    //!\brief Returns whether the end of the input has been reached.
+    bool at_end()
+    {
+        return traits_t::eq_int_type(peek(), traits_t::eof());
+    }
+
+    //!\brief Consumes the next character.
+    void bump()
+    {
+        stream_buf->sbumpc();
+    }
+
+    /*!\brief Passes the input chunk by chunk to a callable until it stops.
+     * \param[in] step Invoked with the pointers `(begin, end)` of a chunk; returns the pointer to the first character
+     *                 that it did not consume. Any other pointer than `end` stops the scan.
+     * \returns `true` if `step` stopped, `false` if the end of the input was reached.
+     *
+     * \details
+     *
+     * The characters consumed by `step` are removed from the input. `step` is never invoked on an empty range.
+     */
+    template <typename step_t>
+    bool scan(step_t && step)
+    {
+        while (!at_end())
+        {
+            char_t const * const chunk_begin = stream_buf->gptr();
+            char_t const * const chunk_end = stream_buf->egptr();
+
+            if (chunk_begin == chunk_end) // the stream buffer does not expose a get area
+            {
+                char_t const c = traits_t::to_char_type(peek());
+                if (step(&c, &c + 1) == &c)
+                    return true;
+                bump();
+                continue;
+            }
+
+            char_t const * const stop = step(chunk_begin, chunk_end);
+            stream_buf->gbump(static_cast<int>(stop - chunk_begin));
+            if (stop != chunk_end)
+                return true;
+        }
+
+        return false;
+    }
+
+    /*!\brief Consumes all characters that satisfy a condition.
+     * \param[in] condition A seqan3::detail::ParseCondition or a unary predicate over `char_t`.
+     */
+    template <typename condition_t>
+    void skip(condition_t const & condition)
+    {
+        scan([&condition] (char_t const * const begin, char_t const * const end)
+        {
+            return std::find_if_not(begin, end, condition);
+        });
+    }
+
+    /*!\brief Reads up to the first character that satisfies a condition, which is not consumed.
+     * \param[in] condition A seqan3::detail::ParseCondition or a unary predicate over `char_t`.
+     * \param[in] on_chunk  Invoked with the pointers `(begin, end)` of every chunk that is read.
+     * \throws seqan3::unexpected_end_of_input If the end of the input is reached before.
+     */
+    template <typename condition_t, typename on_chunk_t>
+    void read_until(condition_t const & condition, on_chunk_t && on_chunk)
+    {
+        bool const found = scan([&] (char_t const * const begin, char_t const * const end)
+        {
+            char_t const * const stop = std::find_if(begin, end, condition);
+            on_chunk(begin, stop);
+            return stop;
+        });
+
+        if (!found)
+            throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+    }
+
+    /*!\brief Reads up to the first occurrence of a character, which is not consumed.
+     * \param[in] delimiter The character to search for.
+     * \param[in] on_chunk  Invoked with the pointers `(begin, end)` of every chunk that is read.
+     * \throws seqan3::unexpected_end_of_input If the end of the input is reached before.
+     *
+     * \details
+     *
+     * Uses `traits_t::find`, i.e. `std::memchr` for `char`.
+     */
+    template <typename on_chunk_t>
+    void read_until_char(char_t const delimiter, on_chunk_t && on_chunk)
+    {
+        bool const found = scan([&] (char_t const * const begin, char_t const * const end)
+        {
+            char_t const * const stop = find(begin, end, delimiter);
+            on_chunk(begin, stop);
+            return stop;
+        });
+
+        if (!found)
+            throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+    }
+
+    /*!\brief Reads the rest of the line and consumes the line ending.
+     * \param[in] on_chunk Invoked with the pointers `(begin, end)` of every chunk of the line without its ending.
+     * \throws seqan3::unexpected_end_of_input If the end of the input is reached before the end of the line.
+     *
+     * \details
+     *
+     * Behaves like seqan3::view::take_line_or_throw: the line ends at the first `'\r'` or `'\n'` and all directly
+     * following `'\r'` and `'\n'` are consumed.
+     */
+    template <typename on_chunk_t>
+    void read_line(on_chunk_t && on_chunk)
+    {
+        bool const found = scan([&] (char_t const * const begin, char_t const * const end)
+        {
+            char_t const * const line_feed = find(begin, end, '\n');
+            char_t const * const stop = find(begin, line_feed, '\r');
+            on_chunk(begin, stop);
+            return stop;
+        });
+
+        if (!found)
+            throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+
+        skip([] (char_t const c) { return c == '\r' || c == '\n'; });
+    }
+
+    /*!\brief Consumes the rest of the line including the line ending.
+     * \throws seqan3::unexpected_end_of_input If the end of the input is reached before the end of the line.
+     */
+    void skip_line()
+    {
+        read_line([] (char_t const *, char_t const *) {});
+    }
+
+    //!\brief Returns the pointer to the first occurrence of `c` in `[begin, end)`, or `end`.
+    static char_t const * find(char_t const * const begin, char_t const * const end, char_t const c)
+    {
+        char_t const * const pos = traits_t::find(begin, end - begin, c);
+        return pos == nullptr ? end : pos;
+    }
+
+private:
+    //!\brief The stream buffer.
+    stream_buffer_exposer<char_t, traits_t> * stream_buf{};
+};
+
+} // namespace seqan3::detail
@@ -965,12 +965,27 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The number of decompression threads that the secondary stream was set to.
+    size_t applied_decompression_threads{1};
+
+    //!\brief Hands seqan3::structure_file_input_options::decompression_threads to the secondary stream if it changed.
+    void update_decompression_threads()
+    {
+        if (options.decompression_threads != applied_decompression_threads)
+        {
+            detail::set_decompression_threads(*secondary_stream, options.decompression_threads);
+            applied_decompression_threads = options.decompression_threads;
+        }
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
         // clear the record
         record_buffer.clear();
 
+        update_decompression_threads();
+
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
              std::istreambuf_iterator<stream_char_type>{}))
@@ -28,6 +28,15 @@ struct structure_file_input_options
 {
     //!\brief Read the ID string only up until the first whitespace character.
     bool truncate_ids = false;
+
+    /*!\brief The number of threads that decompress the input if it is BGZF, e.g. a `.bam` or most `.gz` files.
+     *
+     * \details
+     *
+     * A value of `1` decompresses on the reading thread; a value of `0` is replaced by the number of hardware threads.
+     * Takes effect at the next record that is read.
+     */
+    size_t decompression_threads = 1;
 };
 
 } // namespace seqan3
@@ -662,6 +662,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The number of compression threads that the secondary stream was set to.
+    size_t applied_compression_threads{1};
+
+    //!\brief Hands seqan3::structure_file_output_options::compression_threads to the secondary stream if it changed.
+    void update_compression_threads()
+    {
+        if (options.compression_threads != applied_compression_threads)
+        {
+            detail::set_compression_threads(*secondary_stream, options.compression_threads);
+            applied_compression_threads = options.compression_threads;
+        }
+    }
+
     //!\brief Write record to format.
     template <typename seq_type,
               typename id_type,
@@ -688,6 +701,8 @@ protected:
                       "You may not select field::STRUCTURED_SEQ and either of field::SEQ and field::STRUCTURE "
                       "at the same time.");
 
+        update_compression_threads();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
@@ -760,6 +775,8 @@ protected:
                       "You may not select field::STRUCTURED_SEQ and either of field::SEQ and field::STRUCTURE "
                       "at the same time.");
 
+        update_compression_threads();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
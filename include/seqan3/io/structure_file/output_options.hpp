@@ -29,6 +29,15 @@ struct structure_file_output_options
 
     //!\brief The precision for writing floating point types.
     int precision = 6;
+
+    /*!\brief The number of threads that compress the output if it is written as BGZF, e.g. to a `.gz` file.
+     *
+     * \details
+     *
+     * A value of `1` compresses on the writing thread; a value of `0` is replaced by the number of hardware threads.
+     * Takes effect at the next record that is written.
+     */
+    size_t compression_threads = 1;
 };
 
 } // namespace seqan3
@@ -44,6 +44,9 @@ enum struct search_config_id : uint8_t
     max_error_rate,
     output,
     mode,
+    parallel,
+    on_hit,
+    in_text_verification,
     //!\cond
     // ATTENTION: Must always be the last item; will be used to determine the number of ids.
     SIZE
@@ -69,11 +72,14 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(search_config_
                             static_cast<uint8_t>(search_config_id::SIZE)> compatibility_table<search_config_id> =
 {
     {
-        // max_error, max_error_rate, output, mode
-        { 0, 0, 1, 1 },
-        { 0, 0, 1, 1 },
-        { 1, 1, 0, 1 },
-        { 1, 1, 1, 0 }
+        // max_error, max_error_rate, output, mode, parallel, on_hit, in_text_verification
+        { 0, 0, 1, 1, 1, 1, 1 },
+        { 0, 0, 1, 1, 1, 1, 1 },
+        { 1, 1, 0, 1, 1, 1, 1 },
+        { 1, 1, 1, 0, 1, 1, 1 },
+        { 1, 1, 1, 1, 0, 1, 1 },
+        { 1, 1, 1, 1, 1, 0, 1 },
+        { 1, 1, 1, 1, 1, 1, 0 }
     }
 };
 
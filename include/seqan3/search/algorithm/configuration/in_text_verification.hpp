@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration to verify the rest of a query in the text once few occurrences are left.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+/*!\addtogroup search
+ * \{
+ */
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to switch from the index to the text when the occurrences of a partial hit are few.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * The value is the number of occurrences up to which the search stops traversing the index: once the part of a query
+ * that has been searched so far occurs at most this often in the text, the occurrences are located and the remaining
+ * characters of the query are aligned to the text around them. This is much cheaper than enumerating all branches of
+ * the index with the errors that are left. A value of `0` never verifies in the text.
+ *
+ * The hits are the same as without this configuration. The verification requires the index to refer to its text,
+ * i.e. it has no effect on an index that has been loaded from a file. It is only used by seqan3::search_cfg::all
+ * and if the number of substitutions, insertions and deletions that are left is not restricted below the total number
+ * of errors that are left. It cannot be combined with seqan3::search_cfg::index_cursor, since the hits found in the
+ * text are not represented by a cursor.
+ */
+struct in_text_verification : public pipeable_config_element<in_text_verification, uint64_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::in_text_verification};
+};
+
+} // namespace seqan3::search_cfg
+
+//!\}
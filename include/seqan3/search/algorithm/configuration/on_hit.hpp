@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration to pass every hit of a search to a callback.
+ */
+
+#pragma once
+
+#include <utility>
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+#include <seqan3/std/ranges>
+
+/*!\addtogroup search
+ * \{
+ */
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to pass every hit of a search to a callback instead of returning them.
+ * \ingroup search_configuration
+ * \tparam callback_t The type of the callback.
+ *
+ * \details
+ *
+ * The callback is invoked as a const object with the position of the query in the range of queries (`0` if a single
+ * query is searched) and a single hit, i.e. a text position or a cursor depending on seqan3::search_cfg::output.
+ * The hits are handed over as soon as a query has been searched, such that no result container needs to be allocated
+ * for every query. seqan3::search returns `void` if this configuration is given.
+ *
+ * If combined with seqan3::search_cfg::parallel, the callback is invoked concurrently from several threads and must
+ * therefore synchronise the access to any shared state. The hits of a single query are always reported by the same
+ * thread and without interleaving with the hits of other queries.
+ *
+ * The callback is stored in a ranges::semiregular_t, such that lambdas with captures can be used as well.
+ */
+template <typename callback_t>
+class on_hit : public pipeable_config_element<on_hit<callback_t>, ranges::semiregular_t<callback_t>>
+{
+    //!\brief An alias type for the base class.
+    using base_t = pipeable_config_element<on_hit<callback_t>, ranges::semiregular_t<callback_t>>;
+
+public:
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::on_hit};
+
+    //!\publicsection
+    /*!\name Constructor, destructor and assignment
+     * \brief Defaulted all standard constructor.
+     * \{
+     */
+    constexpr on_hit()                           = default; //!< Default constructor.
+    constexpr on_hit(on_hit const &)             = default; //!< Copy constructor.
+    constexpr on_hit(on_hit &&)                  = default; //!< Move constructor.
+    constexpr on_hit & operator=(on_hit const &) = default; //!< Copy assignment.
+    constexpr on_hit & operator=(on_hit &&)      = default; //!< Move assignment.
+    ~on_hit()                                    = default; //!< Destructor.
+
+    /*!\brief Constructs the object from a callback.
+     * \param[in] callback The callback invoked for every hit.
+     */
+    constexpr on_hit(callback_t callback) : base_t{ranges::semiregular_t<callback_t>{std::move(callback)}}
+    {}
+    //!\}
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::search_cfg::on_hit
+ * \{
+ */
+
+//!\brief Deduces the type of the callback from the constructor argument.
+template <typename callback_t>
+on_hit(callback_t) -> on_hit<callback_t>;
+//!\}
+} // namespace seqan3::search_cfg
+
+//!\}
@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration to search a range of queries in parallel.
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+/*!\addtogroup search
+ * \{
+ */
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to search a range of queries on several threads.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * The value is the number of threads; a value of `0` uses as many threads as the hardware supports.
+ * The queries are distributed dynamically, i.e. a thread fetches the next query as soon as it finished the previous
+ * one, since the cost of a query varies strongly with the number of errors. The hits of every query are written into
+ * their own slot of the result, hence the result is ordered like the queries. The configuration has no effect if a
+ * single query is searched.
+ */
+struct parallel : public pipeable_config_element<parallel, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::parallel};
+};
+
+} // namespace seqan3::search_cfg
+
+//!\}
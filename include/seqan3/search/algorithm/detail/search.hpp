@@ -12,11 +12,23 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 #include <seqan3/core/metafunction/pre.hpp>
 #include <seqan3/search/algorithm/configuration/all.hpp>
+#include <seqan3/search/algorithm/detail/search_in_text_verification.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_algorithm.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
+#include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/r_index_cursor.hpp>
 
 namespace seqan3::detail
 {
@@ -25,13 +37,108 @@ namespace seqan3::detail
  * \{
  */
 
-/*!\brief Search a single query in an index.
+/*!\brief The buffers holding the hits of a single query.
+ * \tparam index_t The type of the index.
+ *
+ * \details
+ *
+ * The buffers are cleared but not deallocated between two queries. Hence, searching a range of queries does not
+ * allocate memory for every query once the buffers have grown large enough.
+ */
+template <typename index_t>
+struct search_hit_buffer
+{
+    //!\brief The type of a position in the text.
+    using text_position_type = std::conditional_t<index_t::is_collection,
+                                                  std::pair<typename index_t::size_type, typename index_t::size_type>,
+                                                  typename index_t::size_type>;
+
+    //!\brief The cursors found by the search algorithm.
+    std::vector<typename index_t::cursor_type> cursors{};
+    //!\brief The positions in the text located from the cursors.
+    std::vector<text_position_type> text_positions{};
+    //!\brief The positions in the text of the hits verified in the text, see seqan3::search_cfg::in_text_verification.
+    std::vector<text_position_type> verified_positions{};
+};
+
+/*!\brief Returns the hits stored in the buffer in the output format specified by the configuration.
+ * \tparam configuration_t The type of the search configuration.
+ * \tparam index_t         The type of the index.
+ * \param[in] buffer       The buffer filled by seqan3::detail::search_single.
+ * \returns A reference to the cursors or to the text positions stored in `buffer`.
+ */
+template <typename configuration_t, typename index_t>
+inline auto & search_hits(search_hit_buffer<index_t> & buffer) noexcept
+{
+    if constexpr (configuration_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
+        return buffer.cursors;
+    else
+        return buffer.text_positions;
+}
+
+/*!\brief Locates the text positions of a set of cursors and removes duplicate text positions.
+ * \tparam cursor_t        The type of the cursor; must model seqan3::FmIndexCursor.
+ * \tparam text_position_t The type of a text position.
+ * \param[in,out] cursors       The cursors found by the search algorithm; reordered and made unique.
+ * \param[out]    text_positions The sorted and unique text positions of all cursors.
+ *
+ * \details
+ *
+ * The search algorithms report the same suffix tree node several times if it can be reached with different error
+ * configurations, e.g. a substitution or an insertion followed by a deletion at the same position.
+ * The cursors are therefore filtered in suffix array interval space before locating them: two cursors of the same
+ * depth represent strings of the same length, hence their suffix array intervals are either identical or disjoint
+ * and merging overlapping intervals amounts to removing duplicate intervals. Every suffix array position of the
+ * remaining cursors is located exactly once.
+ * Cursors of different depths can still report the same text position, which is why the located positions are
+ * sorted and made unique once at the end.
+ *
+ * ### Complexity
+ *
+ * \f$O(c \log c + h \cdot T_{LOCATE} + h \log h)\f$ where \f$c\f$ is the number of cursors and \f$h\f$ the
+ * number of located text positions.
+ */
+template <typename cursor_t, typename text_position_t>
+inline void locate_unique(std::vector<cursor_t> & cursors, std::vector<text_position_t> & text_positions)
+{
+    auto interval = [] (cursor_t const & cur)
+    {
+        auto [lb, rb] = get_suffix_array_range(cur);
+        return std::tuple{cur.query_length(), lb, rb};
+    };
+
+    std::sort(cursors.begin(), cursors.end(), [&] (cursor_t const & lhs, cursor_t const & rhs)
+    {
+        return interval(lhs) < interval(rhs);
+    });
+    cursors.erase(std::unique(cursors.begin(), cursors.end(), [&] (cursor_t const & lhs, cursor_t const & rhs)
+    {
+        return interval(lhs) == interval(rhs);
+    }), cursors.end());
+
+    size_t hit_count = 0;
+    for (auto const & cur : cursors)
+        hit_count += cur.count();
+
+    text_positions.clear();
+    text_positions.reserve(hit_count);
+    for (auto const & cur : cursors)
+    {
+        auto const occ = cur.locate(); // locates the occurrences in batches
+        text_positions.insert(text_positions.end(), occ.begin(), occ.end());
+    }
+
+    std::sort(text_positions.begin(), text_positions.end());
+    text_positions.erase(std::unique(text_positions.begin(), text_positions.end()), text_positions.end());
+}
+
+/*!\brief Search a single query in an index and store the hits in the given buffer.
  * \tparam index_t   Must model seqan3::FmIndex.
  * \tparam queries_t Must be a std::ranges::RandomAccessRange over the index's alphabet.
  * \param[in] index  String index to be searched.
  * \param[in] query  A single query.
  * \param[in] cfg    A configuration object specifying the search parameters.
- * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
+ * \param[in,out] buffer The buffer to store the hits in; previous contents are discarded.
  *
  * ### Complexity
  *
@@ -43,7 +150,10 @@ namespace seqan3::detail
  * specified in `cfg` also has a strong exception guarantee; basic exception guarantee otherwise.
  */
 template <typename index_t, typename query_t, typename configuration_t>
-inline auto search_single(index_t const & index, query_t & query, configuration_t const & cfg)
+inline void search_single(index_t const & index,
+                          query_t & query,
+                          configuration_t const & cfg,
+                          search_hit_buffer<index_t> & buffer)
 {
     using cfg_t = remove_cvref_t<configuration_t>;
 
@@ -72,68 +182,84 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     //                             " of errors for a specific error type.");
 
     // construct internal delegate for collecting hits for later filtering (if necessary)
-    std::vector<typename index_t::cursor_type> internal_hits;
+    auto & internal_hits = buffer.cursors;
+    internal_hits.clear();
     auto internal_delegate = [&internal_hits, &max_error] (auto const & it)
     {
         internal_hits.push_back(it);
     };
 
+    constexpr bool verifies_in_text = cfg_t::template exists<search_cfg::in_text_verification>() &&
+                                      !cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>();
+    buffer.verified_positions.clear();
+
     // choose mode
+    // Error levels are searched one after another with equal lower and upper error bounds s.t. each level is only
+    // searched once instead of restarting from zero errors for every level.
     if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
         while (internal_hits.empty() && max_error2.total <= max_error.total)
         {
-            detail::search_algo<true>(index, query, max_error2, internal_delegate);
-            max_error2.total++;
-        }
-    }
-    else if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_all_best>>())
-    {
-        detail::search_param max_error2{max_error};
-        max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
-        {
-            detail::search_algo<false>(index, query, max_error2, internal_delegate);
+            detail::search_algo<true>(index, query, max_error2.total, max_error2, internal_delegate);
             max_error2.total++;
         }
     }
-    else if constexpr (cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
+    else if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_all_best>>() ||
+                       cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
         while (internal_hits.empty() && max_error2.total <= max_error.total)
         {
-            detail::search_algo<true>(index, query, max_error2, internal_delegate);
+            detail::search_algo<false>(index, query, max_error2.total, max_error2, internal_delegate);
             max_error2.total++;
         }
-        if (!internal_hits.empty())
+
+        if constexpr (cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
         {
-            internal_hits.clear(); // TODO: don't clear when using Optimum Search Schemes with lower error bounds
+            // All hits with the best number of errors have already been found, only the strata are left.
             uint8_t const s = get<search_cfg::mode>(cfg).value;
-            max_error2.total += s - 1;
-            detail::search_algo<false>(index, query, max_error2, internal_delegate);
+            if (!internal_hits.empty() && s > 0)
+            {
+                uint8_t const min_error = max_error2.total;
+                max_error2.total += s - 1;
+                detail::search_algo<false>(index, query, min_error, max_error2, internal_delegate);
+            }
         }
     }
     else // detail::search_mode_all
     {
-        detail::search_algo<false>(index, query, max_error, internal_delegate);
+        // The verification in the text does not distinguish between error types.
+        if constexpr (verifies_in_text)
+        {
+            if (max_error.substitution >= max_error.total && max_error.insertion >= max_error.total &&
+                max_error.deletion >= max_error.total)
+            {
+                search_in_text_verifier verifier{index,
+                                                 query,
+                                                 get<search_cfg::in_text_verification>(cfg).value,
+                                                 internal_delegate,
+                                                 buffer.verified_positions};
+                detail::search_algo<false>(index, query, 0, max_error, verifier);
+            }
+            else
+            {
+                detail::search_algo<false>(index, query, 0, max_error, internal_delegate);
+            }
+        }
+        else
+        {
+            detail::search_algo<false>(index, query, 0, max_error, internal_delegate);
+        }
     }
 
-    // TODO: filter hits and only do it when necessary (depending on error types)
-
-    // output cursors or text_positions
-    if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
+    // locate text_positions
+    if constexpr (!cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
     {
-        return internal_hits;
-    }
-    else
-    {
-        using hit_t = std::conditional_t<index_t::is_collection,
-                                         std::pair<typename index_t::size_type, typename index_t::size_type>,
-                                         typename index_t::size_type>;
-        std::vector<hit_t> hits;
+        auto & hits = buffer.text_positions;
+        hits.clear();
 
         if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
         {
@@ -146,18 +272,136 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
         }
         else
         {
-            for (auto const & cur : internal_hits)
+            locate_unique(internal_hits, hits);
+
+            if constexpr (verifies_in_text)
             {
-                for (auto const & text_pos : cur.locate())
-                    hits.push_back(text_pos);
-                std::sort(hits.begin(), hits.end());
-                hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+                if (!buffer.verified_positions.empty())
+                {
+                    hits.insert(hits.end(), buffer.verified_positions.begin(), buffer.verified_positions.end());
+                    std::sort(hits.begin(), hits.end());
+                    hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+                }
             }
         }
-        return hits;
     }
 }
 
+/*!\brief Search a single query in an index.
+ * \tparam index_t   Must model seqan3::FmIndex.
+ * \tparam queries_t Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \param[in] index  String index to be searched.
+ * \param[in] query  A single query.
+ * \param[in] cfg    A configuration object specifying the search parameters.
+ * \returns A std::vector with the cursors or the text positions of the hits.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the maximum number of errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking a possible delegate
+ * specified in `cfg` also has a strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <typename index_t, typename query_t, typename configuration_t>
+inline auto search_single(index_t const & index, query_t & query, configuration_t const & cfg)
+{
+    search_hit_buffer<index_t> buffer{};
+    search_single(index, query, cfg, buffer);
+    return std::move(search_hits<remove_cvref_t<configuration_t>>(buffer));
+}
+
+/*!\brief Invokes a callable for every query of a range of queries, sequentially.
+ * \tparam index_t   The type of the index.
+ * \tparam queries_t Must model std::ranges::ForwardRange over std::ranges::RandomAccessRange.
+ * \tparam process_t The type of the callable; invoked with the position of the query in the range, the query and
+ *                   a seqan3::detail::search_hit_buffer.
+ * \param[in] queries The range of queries.
+ * \param[in] process The callable processing a single query.
+ *
+ * \details
+ *
+ * All queries share the same buffer.
+ */
+template <typename index_t, typename queries_t, typename process_t>
+inline void search_all_sequential(queries_t & queries, process_t && process)
+{
+    search_hit_buffer<index_t> buffer{};
+    size_t query_id = 0;
+    for (auto const query : queries)
+        process(query_id++, query, buffer);
+}
+
+/*!\brief Invokes a callable for every query of a range of queries, using several threads.
+ * \tparam index_t   The type of the index.
+ * \tparam queries_t Must model std::ranges::ForwardRange over std::ranges::RandomAccessRange.
+ * \tparam process_t The type of the callable; invoked with the position of the query in the range, the query and
+ *                   a seqan3::detail::search_hit_buffer.
+ * \param[in] queries      The range of queries.
+ * \param[in] thread_count The number of threads; `0` uses as many threads as the hardware supports.
+ * \param[in] process      The callable processing a single query.
+ *
+ * \details
+ *
+ * The threads fetch the position of the next query from a shared counter as soon as they become idle, such that the
+ * load is balanced dynamically. The calling thread takes part in the search. Every thread uses its own buffer.
+ *
+ * ### Exceptions
+ *
+ * Basic exception guarantee. The first exception thrown while processing a query is rethrown after all threads were
+ * joined.
+ */
+template <typename index_t, typename queries_t, typename process_t>
+inline void search_all_parallel(queries_t & queries, size_t thread_count, process_t && process)
+{
+    std::vector<std::ranges::iterator_t<queries_t>> query_its;
+    for (auto it = std::ranges::begin(queries); it != std::ranges::end(queries); ++it)
+        query_its.push_back(it);
+
+    if (thread_count == 0)
+        thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+    thread_count = std::min(thread_count, std::max<size_t>(query_its.size(), 1u));
+
+    std::atomic<size_t> next_query{0};
+    std::atomic<bool> failed{false};
+    std::mutex exception_mutex{};
+    std::exception_ptr exception{};
+
+    auto worker = [&] ()
+    {
+        search_hit_buffer<index_t> buffer{};
+        for (size_t i = next_query++; i < query_its.size() && !failed.load(); i = next_query++)
+        {
+            try
+            {
+                auto const query = *query_its[i];
+                process(i, query, buffer);
+            }
+            catch (...)
+            {
+                std::lock_guard lock{exception_mutex};
+                if (!exception)
+                    exception = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers{};
+    workers.reserve(thread_count - 1);
+    for (size_t t = 1; t < thread_count; ++t)
+        workers.emplace_back(worker);
+
+    worker();
+
+    for (auto & thread : workers)
+        thread.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
 /*!\brief Search a query or a range of queries in an index.
  * \tparam index_t    Must model seqan3::FmIndex.
  * \tparam queries_t  Must be a std::ranges::RandomAccessRange over the index's alphabet.
@@ -165,7 +409,8 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
  * \param[in] index   String index to be searched.
  * \param[in] queries A single query or a range of queries.
  * \param[in] cfg     A configuration object specifying the search parameters.
- * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
+ * \returns The hits of a single query, a std::vector with the hits of every query, or `void` if
+ *          seqan3::search_cfg::on_hit is specified.
  *
  * ### Complexity
  *
@@ -181,31 +426,59 @@ inline auto search_all(index_t const & index, queries_t & queries, configuration
 {
     using cfg_t = remove_cvref_t<configuration_t>;
     // return type: for each query: a vector of text_positions (or cursors)
-    // delegate params: text_position (or cursor). we will withhold all hits of one query anyway to filter
-    //                  duplicates. more efficient to call delegate once with one vector instead of calling
-    //                  delegate for each hit separately at once.
-    using text_pos_t = std::conditional_t<index_t::is_collection,
-                                          std::pair<typename index_t::size_type, typename index_t::size_type>,
-                                          typename index_t::size_type>;
-    using hit_t = std::conditional_t<cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>(),
-                                     typename index_t::cursor_type,
-                                     text_pos_t>;
+    // delegate params: query id and text_position (or cursor). The hits of one query are withheld in a buffer to
+    //                  filter duplicates; the buffer is reused for the next query.
+    using hit_buffer_t = remove_cvref_t<decltype(search_hits<cfg_t>(std::declval<search_hit_buffer<index_t> &>()))>;
+    using hit_t = value_type_t<hit_buffer_t>;
 
     if constexpr (std::ranges::ForwardRange<queries_t> && std::ranges::RandomAccessRange<value_type_t<queries_t>>)
     {
-        // TODO: if constexpr (contains<search_cfg::id::on_hit>(cfg))
-        std::vector<std::vector<hit_t>> hits;
-        hits.reserve(std::distance(queries.begin(), queries.end()));
-        for (auto const query : queries)
+        // Dispatches the processing of the queries to the sequential or parallel driver.
+        auto for_each_query = [&] (auto && process)
+        {
+            if constexpr (cfg_t::template exists<search_cfg::parallel>())
+                search_all_parallel<index_t>(queries, get<search_cfg::parallel>(cfg).value, process);
+            else
+                search_all_sequential<index_t>(queries, process);
+        };
+
+        if constexpr (cfg_t::template exists<search_cfg::on_hit>())
         {
-            hits.push_back(search_single(index, query, cfg));
+            auto const & on_hit = get<search_cfg::on_hit>(cfg).value;
+            for_each_query([&] (size_t const query_id, auto const & query, search_hit_buffer<index_t> & buffer)
+            {
+                search_single(index, query, cfg, buffer);
+                for (auto const & hit : search_hits<cfg_t>(buffer))
+                    on_hit(query_id, hit);
+            });
+        }
+        else
+        {
+            // Every query writes its hits into its own slot.
+            std::vector<std::vector<hit_t>> hits(std::distance(queries.begin(), queries.end()));
+            for_each_query([&] (size_t const query_id, auto const & query, search_hit_buffer<index_t> & buffer)
+            {
+                search_single(index, query, cfg, buffer);
+                hits[query_id] = search_hits<cfg_t>(buffer);
+            });
+            return hits;
         }
-        return hits;
     }
     else // std::ranges::RandomAccessRange<queries_t>
     {
-        // TODO: if constexpr (contains<search_cfg::id::on_hit>(cfg))
-        return search_single(index, queries, cfg);
+        if constexpr (cfg_t::template exists<search_cfg::on_hit>())
+        {
+            search_hit_buffer<index_t> buffer{};
+            search_single(index, queries, cfg, buffer);
+
+            auto const & on_hit = get<search_cfg::on_hit>(cfg).value;
+            for (auto const & hit : search_hits<cfg_t>(buffer))
+                on_hit(size_t{0}, hit);
+        }
+        else
+        {
+            return search_single(index, queries, cfg);
+        }
     }
 }
 
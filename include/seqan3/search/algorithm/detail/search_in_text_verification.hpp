@@ -0,0 +1,256 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the verification of partial hits in the text for the search algorithms.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/pre.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_search_algorithm
+ * \{
+ */
+
+/*!\brief A delegate for the search algorithms that verifies partial hits in the text once they occur rarely.
+ * \tparam index_t    Must model seqan3::FmIndex.
+ * \tparam query_t    Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \tparam delegate_t Takes `typename index_t::cursor_type` as argument.
+ *
+ * \details
+ *
+ * The search algorithms call #verify for every node of the implicit suffix tree they visit. If the part of the query
+ * that has been searched occurs at most #threshold times, its occurrences are located and the rest of the query is
+ * aligned to the text around every occurrence with the errors that are left. The search algorithm then does not
+ * descend into the node. The text positions of the verified hits are appended to the vector passed on construction,
+ * hits that are found in the index are passed on to the wrapped delegate.
+ *
+ * A hit that is found in the text is a hit of the search algorithm: the alignment starts with a substitution, a match
+ * or an insertion, i.e. the first character of the hit is never deleted, and ends at any position in the text.
+ * The verification does not restrict the number of substitutions, insertions and deletions separately, hence it must
+ * only be used if each of them may take all errors.
+ */
+template <typename index_t, typename query_t, typename delegate_t>
+class search_in_text_verifier
+{
+public:
+    //!\brief The type of a position in the text.
+    using text_position_type = std::conditional_t<index_t::is_collection,
+                                                  std::pair<typename index_t::size_type, typename index_t::size_type>,
+                                                  typename index_t::size_type>;
+
+    /*!\brief Constructs the delegate.
+     * \param[in] index     The index that is searched.
+     * \param[in] query     The query that is searched.
+     * \param[in] threshold The number of occurrences up to which a partial hit is verified in the text.
+     * \param[in] delegate  The delegate called on every hit found in the index.
+     * \param[out] hits     The vector the text positions of the hits found in the text are appended to.
+     */
+    search_in_text_verifier(index_t const & index,
+                            query_t & query,
+                            uint64_t const threshold,
+                            delegate_t & delegate,
+                            std::vector<text_position_type> & hits) :
+        text{index.indexed_text()}, query{query}, threshold{threshold}, delegate{delegate}, hits{hits}
+    {}
+
+    //!\brief Passes a hit found in the index on to the wrapped delegate.
+    template <typename cursor_t>
+    void operator()(cursor_t const & cur)
+    {
+        delegate(cur);
+    }
+
+    /*!\brief Verifies a partial hit in the text if it occurs rarely.
+     * \param[in] cur         The cursor representing the part of the query that has been searched.
+     * \param[in] query_begin The position of the first character of the query that has been searched.
+     * \param[in] query_end   The position behind the last character of the query that has been searched.
+     * \param[in] error_left  The number of errors left for the rest of the query.
+     * \returns `true` if the partial hit has been verified and the search must not continue with `cur`, `false`
+     *          otherwise.
+     */
+    template <typename cursor_t>
+    bool verify(cursor_t const & cur, size_t const query_begin, size_t const query_end, uint8_t const error_left)
+    {
+        using text_t = typename index_t::text_type;
+
+        if constexpr (std::ranges::RandomAccessRange<text_t const> &&
+                      (!index_t::is_collection || std::ranges::RandomAccessRange<value_type_t<text_t> const>))
+        {
+            if (text == nullptr || cur.query_length() == 0 || cur.count() > threshold)
+                return false;
+
+            size_t const depth = cur.query_length();
+            for (auto const & occ : cur.locate())
+            {
+                if constexpr (index_t::is_collection)
+                {
+                    auto const & t = std::ranges::begin(*text)[occ.first];
+                    size_t const right = right_errors(t, occ.second + depth, query_end, error_left);
+                    if (right <= error_left)
+                    {
+                        left_starts(t, occ.second, query_begin, error_left - right, [&] (size_t const start)
+                        {
+                            hits.emplace_back(occ.first, start);
+                        });
+                    }
+                }
+                else
+                {
+                    size_t const right = right_errors(*text, occ + depth, query_end, error_left);
+                    if (right <= error_left)
+                    {
+                        left_starts(*text, occ, query_begin, error_left - right, [&] (size_t const start)
+                        {
+                            hits.push_back(start);
+                        });
+                    }
+                }
+            }
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+private:
+    /*!\brief Computes the fewest errors to align the suffix of the query to a prefix of the text at a position.
+     * \param[in] t           The text.
+     * \param[in] text_begin  The position in the text the alignment starts at.
+     * \param[in] query_begin The position of the first character of the suffix of the query.
+     * \param[in] error_left  The number of errors allowed.
+     * \returns The fewest number of errors, or a number greater than `error_left` if there is no such alignment.
+     *
+     * \details
+     *
+     * Computes the edit distance matrix column by column and stops as soon as every entry of a column exceeds
+     * `error_left`.
+     */
+    template <typename text_t>
+    size_t right_errors(text_t const & t, size_t const text_begin, size_t const query_begin, size_t const error_left)
+    {
+        size_t const rows = std::ranges::size(query) - query_begin;
+        if (rows == 0)
+            return 0;
+
+        auto const t_it = std::ranges::begin(t);
+        column.resize(rows + 1);
+        for (size_t row = 0; row <= rows; ++row)
+            column[row] = row;
+
+        size_t best = rows;
+        size_t const text_end = std::min<size_t>(std::ranges::size(t), text_begin + rows + error_left);
+        for (size_t pos = text_begin; pos < text_end; ++pos)
+        {
+            size_t diagonal = column[0];
+            size_t column_min = ++column[0];
+            for (size_t row = 1; row <= rows; ++row)
+            {
+                size_t const left = column[row];
+                column[row] = std::min(diagonal + (t_it[pos] != query[query_begin + row - 1]),
+                                       std::min(left, column[row - 1]) + 1);
+                diagonal = left;
+                column_min = std::min(column_min, column[row]);
+            }
+
+            best = std::min(best, column[rows]);
+            if (column_min > error_left)
+                break;
+        }
+        return best;
+    }
+
+    /*!\brief Reports every start position of an alignment of the prefix of the query that ends at a position in the
+     *        text.
+     * \param[in] t         The text.
+     * \param[in] text_end  The position in the text behind the last character of the alignment.
+     * \param[in] query_end The position behind the last character of the prefix of the query.
+     * \param[in] error_left The number of errors allowed.
+     * \param[in] report    Invoked with every start position in the text.
+     *
+     * \details
+     *
+     * Computes the edit distance matrix of the reversed prefix and the text in front of `text_end`. The additional
+     * column `start` holds the fewest errors of an alignment that aligns the current character of the text to a
+     * character of the query, i.e. of an alignment that does not start with a deletion.
+     */
+    template <typename text_t, typename report_t>
+    void left_starts(text_t const & t, size_t const text_end, size_t const query_end, size_t const error_left,
+                     report_t && report)
+    {
+        size_t const rows = query_end;
+        if (rows <= error_left) // the prefix is inserted in front of the partial hit
+            report(text_end);
+        if (rows == 0)
+            return;
+
+        auto const t_it = std::ranges::begin(t);
+        column.resize(rows + 1);
+        for (size_t row = 0; row <= rows; ++row)
+            column[row] = row;
+
+        size_t const max_length = std::min(text_end, rows + error_left);
+        for (size_t length = 1; length <= max_length; ++length)
+        {
+            size_t const pos = text_end - length;
+            size_t diagonal = column[0];
+            size_t column_min = ++column[0];
+            size_t start = std::numeric_limits<size_t>::max() / 2;
+            for (size_t row = 1; row <= rows; ++row)
+            {
+                size_t const left = column[row];
+                start = std::min(diagonal + (t_it[pos] != query[rows - row]), start + 1);
+                column[row] = std::min(start, std::min(left, column[row - 1]) + 1);
+                diagonal = left;
+                column_min = std::min(column_min, column[row]);
+            }
+
+            if (start <= error_left)
+                report(pos);
+            if (column_min > error_left)
+                break;
+        }
+    }
+
+    //!\brief The indexed text; `nullptr` if the index has been loaded from a file.
+    typename index_t::text_type const * text;
+    //!\brief The query that is searched.
+    query_t & query;
+    //!\brief The number of occurrences up to which a partial hit is verified in the text.
+    uint64_t threshold;
+    //!\brief The delegate called on every hit found in the index.
+    delegate_t & delegate;
+    //!\brief The text positions of the hits found in the text.
+    std::vector<text_position_type> & hits;
+    //!\brief A column of the edit distance matrix; reused for all verifications.
+    std::vector<size_t> column{};
+};
+
+//!\brief Whether a delegate of the search algorithms is a seqan3::detail::search_in_text_verifier.
+template <typename delegate_t>
+inline constexpr bool is_search_in_text_verifier_v =
+    is_type_specialisation_of_v<remove_cvref_t<delegate_t>, search_in_text_verifier>;
+
+//!\}
+
+} // namespace seqan3::detail
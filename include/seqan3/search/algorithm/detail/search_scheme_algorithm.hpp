@@ -12,11 +12,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 
 #include <seqan3/core/metafunction/transformation_trait_or.hpp>
 #include <seqan3/range/view/slice.hpp>
 #include <seqan3/search/algorithm/detail/search_common.hpp>
+#include <seqan3/search/algorithm/detail/search_in_text_verification.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
@@ -28,13 +30,32 @@ namespace seqan3::detail
  * \{
  */
 
-/*!\brief Computes a (non-optimal) search scheme. Currently the generated search scheme represents trivial backtracking.
+/*!\brief Computes a search scheme for an arbitrary number of errors.
  * \param[in] min_error Minimum number of errors allowed.
  * \param[in] max_error Maximum number of errors allowed.
+ * \returns A search scheme with `max_error + 1` blocks and `max_error + 1` searches.
+ *
+ * \details
+ *
+ * The query is split into \f$k + 1\f$ blocks where \f$k\f$ is `max_error`. Let \f$e_j\f$ be the number of errors
+ * in block \f$j\f$ and \f$S_j = e_1 + \ldots + e_j\f$. Since \f$S_{k+1} \le k\f$, there is a smallest block
+ * \f$i\f$ with \f$S_i < i\f$. For this block it holds that \f$e_i = 0\f$, \f$S_{i-1} = i - 1\f$ and
+ * \f$S_j \ge j\f$ for all \f$j < i - 1\f$, i.e. every suffix of the blocks \f$1, \ldots, i - 1\f$ consisting of
+ * \f$m\f$ blocks has at most \f$m\f$ errors.
+ *
+ * The \f$i\f$-th search starts with an exact match of block \f$i\f$, extends to the left with at most \f$m\f$ errors
+ * in the \f$m\f$ blocks searched so far and exactly \f$i - 1\f$ errors once the first block is reached, and finally
+ * extends to the right with up to `max_error` errors. Every error distribution is thus covered by exactly one search
+ * and every search begins with an exact block. This generalises the pigeonhole principle such that the searches do
+ * not overlap and the blocks left of the exact block have tight upper bounds.
+ *
+ * The searches are sorted by their upper error bound strings, s.t. easy to compute searches come first. This
+ * improves the running time of algorithms that abort after the first hit (e.g. search mode: best). Even though it is
+ * not guaranteed, this seems to be a good greedy approach.
  *
  * ### Complexity
  *
- * Constant.
+ * \f$O(k^2)\f$.
  *
  * ### Exceptions
  *
@@ -42,12 +63,45 @@ namespace seqan3::detail
  */
 inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
 {
-    // TODO: Replace this at least by the pigeonhole principle or even better by 01*0 schemes.
-    // NOTE: Make sure that the searches are sorted by their asymptotical running time (i.e. upper error bound string),
-    //       s.t. easy to compute searches come first. This improves the running time of algorithms that abort after the
-    //       first hit (e.g. search mode: best). Even though it is not guaranteed, this seems to be a good greedy
-    //       approach.
-    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
+    uint8_t const blocks = max_error + 1;
+    std::vector<search_dyn> scheme(blocks);
+
+    for (uint8_t i = 1; i <= blocks; ++i)
+    {
+        search_dyn & search = scheme[i - 1];
+        search.pi.reserve(blocks);
+        search.l.reserve(blocks);
+        search.u.reserve(blocks);
+
+        // block i is matched exactly
+        search.pi.push_back(i);
+        search.l.push_back(0);
+        search.u.push_back(0);
+
+        // blocks i - 1, ..., 1: at most m errors in the first m blocks, exactly i - 1 errors in all of them
+        for (uint8_t m = 1; m < i; ++m)
+        {
+            search.pi.push_back(i - m);
+            search.l.push_back((m + 1 == i) ? i - 1 : 0);
+            search.u.push_back(m);
+        }
+
+        // blocks i + 1, ..., k + 1: the remaining errors
+        for (uint8_t block = i + 1; block <= blocks; ++block)
+        {
+            search.pi.push_back(block);
+            search.l.push_back(i - 1);
+            search.u.push_back(max_error);
+        }
+
+        search.l.back() = std::max<uint8_t>(search.l.back(), min_error);
+    }
+
+    std::stable_sort(scheme.begin(), scheme.end(), [] (search_dyn const & lhs, search_dyn const & rhs)
+    {
+        return lhs.u < rhs.u;
+    });
+
     return scheme;
 }
 
@@ -375,8 +429,16 @@ inline bool search_ss(cursor_t cur, query_t & query,
         delegate(cur);
         return true;
     }
+
+    // Verify the rest of the query in the text if the infix searched so far occurs rarely.
+    if constexpr (is_search_in_text_verifier_v<delegate_t>)
+    {
+        if (!(lb == 0 && rb == std::ranges::size(query) + 1) && delegate.verify(cur, lb, rb - 1, error_left.total))
+            return false;
+    }
+
     // Exact search in current block.
-    else if (((max_error_left_in_block == 0) && (rb - lb - 1 != blocks_length[block_id])) ||
+    if (((max_error_left_in_block == 0) && (rb - lb - 1 != blocks_length[block_id])) ||
              (error_left.total == 0 && min_error_left_in_block == 0))
     {
         if (search_ss_exact<abort_on_hit>(cur, query, lb, rb, errors_spent, block_id, go_right, search, blocks_length,
@@ -484,6 +546,43 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index using the optimum search scheme for the given error
+ *        bounds.
+ * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
+ * \tparam min_error       Lower error bound of the optimum search scheme to check against `min_error_runtime`.
+ * \tparam max_error       Upper error bound of the optimum search scheme; must be equal to `error_left.total`.
+ * \tparam index_t         Must model seqan3::BiFmIndex.
+ * \tparam query_t         Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \tparam delegate_t      Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index        String index built on the text that will be searched.
+ * \param[in] query        Query sequence to be searched in the index.
+ * \param[in] min_error_runtime Minimum number of errors of a hit; must not be larger than `max_error`.
+ * \param[in] error_left   Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] delegate     Function that is called on every hit.
+ *
+ * \details
+ *
+ * Recursively increments `min_error` until it matches `min_error_runtime` to pick the precomputed
+ * seqan3::detail::optimum_search_scheme<min_error, max_error>.
+ */
+template <bool abort_on_hit, uint8_t min_error, uint8_t max_error, typename index_t, typename query_t,
+          typename delegate_t>
+inline void search_algo_bi_precomputed(index_t const & index, query_t & query, uint8_t const min_error_runtime,
+                                       search_param const error_left, delegate_t && delegate)
+{
+    if constexpr (min_error < max_error)
+    {
+        if (min_error_runtime > min_error)
+        {
+            search_algo_bi_precomputed<abort_on_hit, min_error + 1, max_error>(index, query, min_error_runtime,
+                                                                                error_left, delegate);
+            return;
+        }
+    }
+
+    search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<min_error, max_error>, delegate);
+}
+
 /*!\brief Searches a query sequence in a bidirectional index.
  * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
  * \tparam index_t         Must model seqan3::BiFmIndex.
@@ -491,9 +590,17 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
  * \tparam delegate_t      Takes `typename index_t::cursor_type` as argument.
  * \param[in] index        String index built on the text that will be searched.
  * \param[in] query        Query sequence to be searched in the index.
+ * \param[in] min_error    Minimum number of errors of a hit. Hits that can only be found with fewer errors are not
+ *                         reported.
  * \param[in] error_left   Number of errors left for matching the remaining suffix of the query sequence.
  * \param[in] delegate     Function that is called on every hit.
  *
+ * \details
+ *
+ * Lower error bounds are part of the search schemes, i.e. branches that cannot reach `min_error` errors are pruned
+ * early. Searching for `0, 1, ..., k` errors with lower and upper bound set to the same value thus explores every
+ * error distribution only once.
+ *
  * ### Complexity
  *
  * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
@@ -504,26 +611,38 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
  * strong exception guarantee; basic exception guarantee otherwise.
  */
 template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
-inline void search_algo_bi(index_t const & index, query_t & query, search_param const error_left,
-                           delegate_t && delegate)
+inline void search_algo_bi(index_t const & index, query_t & query, uint8_t const min_error,
+                           search_param const error_left, delegate_t && delegate)
 {
+    if (min_error > error_left.total)
+        return;
+
     switch (error_left.total)
     {
         case 0:
-            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 0>, delegate);
+            search_algo_bi_precomputed<abort_on_hit, 0, 0>(index, query, min_error, error_left, delegate);
             break;
         case 1:
-            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 1>, delegate);
+            search_algo_bi_precomputed<abort_on_hit, 0, 1>(index, query, min_error, error_left, delegate);
             break;
         case 2:
-            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 2>, delegate);
+            search_algo_bi_precomputed<abort_on_hit, 0, 2>(index, query, min_error, error_left, delegate);
             break;
         case 3:
-            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 3>, delegate);
+            search_algo_bi_precomputed<abort_on_hit, 0, 3>(index, query, min_error, error_left, delegate);
             break;
         default:
-            auto const & search_scheme{compute_ss(0, error_left.total)};
-            search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
+            // Every block must contain at least one character, otherwise search with a single block.
+            if (std::ranges::size(query) > error_left.total)
+            {
+                auto const & search_scheme{compute_ss(min_error, error_left.total)};
+                search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
+            }
+            else
+            {
+                search_scheme_dyn_type const search_scheme{{{1}, {min_error}, {error_left.total}}};
+                search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
+            }
             break;
     }
 }
@@ -533,10 +652,13 @@ inline void search_algo_bi(index_t const & index, query_t & query, search_param
  * \copydetails search_algo_bi
  */
 template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
-inline void search_algo_uni(index_t const & index, query_t & query, search_param const error_left,
-                            delegate_t && delegate)
+inline void search_algo_uni(index_t const & index, query_t & query, uint8_t const min_error,
+                            search_param const error_left, delegate_t && delegate)
 {
-    search_trivial<abort_on_hit>(index, query, error_left, delegate);
+    if (min_error > error_left.total)
+        return;
+
+    search_trivial<abort_on_hit>(index.begin(), query, 0, min_error, error_left, delegate);
 }
 
 /*!\brief Searches a query sequence in an index.
@@ -544,12 +666,13 @@ inline void search_algo_uni(index_t const & index, query_t & query, search_param
  * \copydetails search_algo_bi
  */
 template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
-inline void search_algo(index_t const & index, query_t & query, search_param const error_left, delegate_t && delegate)
+inline void search_algo(index_t const & index, query_t & query, uint8_t const min_error, search_param const error_left,
+                        delegate_t && delegate)
 {
     if constexpr (BiFmIndex<index_t>)
-        search_algo_bi<abort_on_hit>(index, query, error_left, delegate);
+        search_algo_bi<abort_on_hit>(index, query, min_error, error_left, delegate);
     else
-        search_algo_uni<abort_on_hit>(index, query, error_left, delegate);
+        search_algo_uni<abort_on_hit>(index, query, min_error, error_left, delegate);
 }
 
 //!\}
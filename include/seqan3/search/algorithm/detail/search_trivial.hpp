@@ -17,6 +17,7 @@
 
 #include <seqan3/range/concept.hpp>
 #include <seqan3/search/algorithm/detail/search_common.hpp>
+#include <seqan3/search/algorithm/detail/search_in_text_verification.hpp>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
@@ -34,6 +35,7 @@ namespace seqan3::detail
  * \param[in] cur        Cursor of atring index built on the text that will be searched.
  * \param[in] query      Query sequence to be searched with the cursor.
  * \param[in] query_pos  Position in the query sequence indicating the prefix that has already been searched.
+ * \param[in] min_error_left Number of errors that still have to be spent before a hit is reported.
  * \param[in] error_left Number of errors left for matching the remaining suffix of the query sequence.
  * \param[in] delegate   Function that is called on every hit.
  * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
@@ -48,13 +50,26 @@ namespace seqan3::detail
  */
 template <bool abort_on_hit, typename query_t, typename cursor_t, typename delegate_t>
 inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::size_type const query_pos,
-                           search_param const error_left, delegate_t && delegate) noexcept(noexcept(delegate))
+                           uint8_t const min_error_left, search_param const error_left,
+                           delegate_t && delegate) noexcept(noexcept(delegate))
 {
+    // Verify the rest of the query in the text if the prefix searched so far occurs rarely.
+    if constexpr (is_search_in_text_verifier_v<delegate_t>)
+    {
+        if (query_pos > 0 && query_pos < std::ranges::size(query) &&
+            delegate.verify(cur, 0, query_pos, error_left.total))
+        {
+            return false;
+        }
+    }
+
     // Exact case (end of query sequence or no errors left)
     if (query_pos == std::ranges::size(query) || error_left.total == 0)
     {
-        // If not at end of query sequence, try searching the remaining suffix without any errors.
-        if (query_pos == std::ranges::size(query) || cur.extend_right(view::drop(query, query_pos)))
+        // If not at end of query sequence, try searching the remaining suffix without any errors. Hits with fewer
+        // errors than the lower bound are not reported.
+        if (min_error_left == 0 &&
+            (query_pos == std::ranges::size(query) || cur.extend_right(view::drop(query, query_pos))))
         {
             delegate(cur);
             return true;
@@ -69,11 +84,15 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
             search_param error_left2{error_left};
             error_left2.insertion--;
             error_left2.total--;
+            uint8_t const min_error_left2 = min_error_left - (min_error_left > 0);
 
             // always perform a recursive call. Abort recursion if and only if recursive call found a hit and
             // abort_on_hit is set to true.
-            if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left2, delegate) && abort_on_hit)
+            if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, min_error_left2, error_left2, delegate) &&
+                abort_on_hit)
+            {
                 return true;
+            }
         }
 
         // Do not allow deletions at the beginning of the query sequence
@@ -88,9 +107,13 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
                     search_param error_left2{error_left};
                     error_left2.total -= delta;
                     error_left2.substitution -= delta;
+                    uint8_t const min_error_left2 = min_error_left - (delta && min_error_left > 0);
 
-                    if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left2, delegate) && abort_on_hit)
+                    if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, min_error_left2, error_left2,
+                                                     delegate) && abort_on_hit)
+                    {
                         return true;
+                    }
                 }
 
                 // Deletion (Do not allow deletions at the beginning of the query sequence.)
@@ -99,8 +122,8 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
                     // Match (when error_left.substitution == 0)
                     if (error_left.substitution == 0 && cur.last_char() == query[query_pos])
                     {
-                        if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left, delegate) &&
-                            abort_on_hit)
+                        if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, min_error_left, error_left,
+                                                         delegate) && abort_on_hit)
                         {
                             return true;
                         }
@@ -114,9 +137,13 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
                         search_param error_left2{error_left};
                         error_left2.total--;
                         error_left2.deletion--;
+                        uint8_t const min_error_left2 = min_error_left - (min_error_left > 0);
 
-                        if (search_trivial<abort_on_hit>(cur, query, query_pos, error_left2, delegate) && abort_on_hit)
+                        if (search_trivial<abort_on_hit>(cur, query, query_pos, min_error_left2, error_left2,
+                                                         delegate) && abort_on_hit)
+                        {
                             return true;
+                        }
                     }
                 }
             } while (cur.cycle_back());
@@ -126,8 +153,11 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
             // Match (when error_left.substitution == 0)
             if (cur.extend_right(query[query_pos]))
             {
-                if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left, delegate) && abort_on_hit)
+                if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, min_error_left, error_left, delegate) &&
+                    abort_on_hit)
+                {
                     return true;
+                }
             }
         }
     }
@@ -135,6 +165,33 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
     return false;
 }
 
+/*!\brief Searches a query sequence in an index using trivial backtracking without a lower error bound.
+ * \tparam abort_on_hit  If the flag is set, the search algorithm aborts on the first hit.
+ * \tparam cursor_t      Must model seqan3::FmIndexCursor.
+ * \tparam query_t       Must be a std::ranges::InputRange over the index's alphabet.
+ * \tparam delegate_t    Takes `index::cursor_type` as argument.
+ * \param[in] cur        Cursor of atring index built on the text that will be searched.
+ * \param[in] query      Query sequence to be searched with the cursor.
+ * \param[in] query_pos  Position in the query sequence indicating the prefix that has already been searched.
+ * \param[in] error_left Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] delegate   Function that is called on every hit.
+ * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the maximum number of errors.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee if invoking the delegate also guarantees no-throw.
+ */
+template <bool abort_on_hit, typename query_t, typename cursor_t, typename delegate_t>
+inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::size_type const query_pos,
+                           search_param const error_left, delegate_t && delegate) noexcept(noexcept(delegate))
+{
+    return search_trivial<abort_on_hit>(cur, query, query_pos, 0, error_left, delegate);
+}
+
 /*!\brief Searches a query sequence in an index using trivial backtracking.
  * \tparam abort_on_hit  If the flag is set, the search algorithm aborts on the first hit.
  * \tparam index_t       Must model seqan3::FmIndex.
@@ -157,7 +214,7 @@ template <bool abort_on_hit, typename index_t, typename query_t, typename delega
 inline void search_trivial(index_t const & index, query_t & query, search_param const error_left,
                            delegate_t && delegate) noexcept(noexcept(delegate))
 {
-    search_trivial<abort_on_hit>(index.begin(), query, 0, error_left, delegate);
+    search_trivial<abort_on_hit>(index.begin(), query, 0, 0, error_left, delegate);
 }
 
 //!\}
@@ -62,6 +62,10 @@ inline auto search(index_t const & index, queries_t && queries, configuration_t
 
     using cfg_t = remove_cvref_t<configuration_t>;
 
+    static_assert(!cfg_t::template exists<search_cfg::in_text_verification>() ||
+                  !cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>(),
+                  "The verification in the text cannot be combined with the output of index cursors.");
+
     if constexpr (cfg_t::template exists<search_cfg::max_error>())
     {
         auto & [total, subs, ins, del] = get<search_cfg::max_error>(cfg).value;
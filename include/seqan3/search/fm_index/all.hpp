@@ -32,6 +32,10 @@
  * FM indices are more powerful for approximate string matching at the cost of a higher space consumption
  * \todo (between a factor of X and Y depending on the configuration).
  *
+ * For highly repetitive texts, e.g. many genomes of the same species, the unidirectional seqan3::r_index stores the
+ * Burrow Wheeler transform run-length compressed together with the suffix array values at the bounds of the runs. Its
+ * size depends on the number of runs instead of the length of the text.
+ *
  * # FM Index Cursors
  *
  * Index Cursors are lightweight objects, i.e. they are cheap to copy.
@@ -45,3 +49,5 @@
 
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_config.hpp>
+#include <seqan3/search/fm_index/r_index.hpp>
@@ -12,13 +12,19 @@
 
 #pragma once
 
+#include <fstream>
+#include <future>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/range/view/persist.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_config.hpp>
 #include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/interleaved_backward_search.hpp>
 #include <seqan3/std/ranges>
 
 namespace seqan3
@@ -44,6 +50,41 @@ struct bi_fm_index_default_traits
     using rev_fm_index_traits = fm_index_default_traits; // TODO: trait object without sampling.
 };
 
+/*!\brief A Bidirectional FM Index Configuration with a custom suffix array sampling rate, see
+ *        seqan3::fm_index_sampling_traits.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th suffix array value is stored; must be at least 1.
+ */
+template <uint32_t sa_sampling_rate>
+//!\cond
+    requires sa_sampling_rate >= 1
+//!\endcond
+struct bi_fm_index_sampling_traits
+{
+    //!\brief Type of the underlying forward SDSL index.
+    using fm_index_traits = fm_index_sampling_traits<sa_sampling_rate>;
+
+    //!\brief Type of the underlying reverse SDSL index.
+    using rev_fm_index_traits = fm_index_sampling_traits<sa_sampling_rate>;
+};
+
+/*!\brief A Bidirectional FM Index Configuration for small alphabets that uses EPR dictionaries instead of wavelet
+ *        trees, see seqan3::fm_index_epr_traits.
+ * \tparam alphabet_t       The alphabet of the indexed text; must have at most 6 characters.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th suffix array value is stored; must be at least 1.
+ */
+template <Alphabet alphabet_t, uint32_t sa_sampling_rate = 16>
+//!\cond
+    requires alphabet_size_v<alphabet_t> <= 6 && sa_sampling_rate >= 1
+//!\endcond
+struct bi_fm_index_epr_traits
+{
+    //!\brief Type of the underlying forward SDSL index.
+    using fm_index_traits = fm_index_epr_traits<alphabet_t, sa_sampling_rate>;
+
+    //!\brief Type of the underlying reverse SDSL index.
+    using rev_fm_index_traits = fm_index_epr_traits<alphabet_t, sa_sampling_rate>;
+};
+
 /*!\brief The SeqAn Bidirectional FM Index
  * \implements seqan3::BiFmIndex
  * \tparam text_t The type of the text to be indexed; must model std::ranges::RandomAccessRange.
@@ -168,30 +209,32 @@ public:
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config.
      *
      * ### Complexity
      *
      * \todo At least linear.
      */
-    bi_fm_index(text_t const & text)
+    bi_fm_index(text_t const & text, fm_index_construction_config const & config = {})
     {
-        construct(text);
+        construct(text, config);
     }
 
     //!\overload
-    bi_fm_index(text_t &&) = delete;
+    bi_fm_index(text_t &&, fm_index_construction_config const & = {}) = delete;
 
     //!\overload
-    bi_fm_index(text_t const &&) = delete;
+    bi_fm_index(text_t const &&, fm_index_construction_config const & = {}) = delete;
     //!\}
 
     /*!\brief Constructs the index given a range.
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config.
      *
-     * \details \todo This has to be better implemented with regard to the memory peak due to not matching interfaces
-     *                with the SDSL.
+     * \details If `config` allows more than one thread, the forward and the reverse index are constructed
+     *          concurrently and each of them gets half of the memory budget.
      *
      * ### Complexity
      *
@@ -201,7 +244,7 @@ public:
      *
      * No guarantee. \todo Ensure strong exception guarantee.
      */
-    void construct(text_t const & text)
+    void construct(text_t const & text, fm_index_construction_config const & config = {})
     {
          // text must not be empty
         if (std::ranges::begin(text) == std::ranges::end(text))
@@ -212,8 +255,25 @@ public:
             rev_text = text | view::deep{std::view::reverse} | view::deep{view::persist} | std::view::reverse;
         else
             rev_text = std::view::reverse(text);
-        fwd_fm.construct(text);
-        rev_fm.construct(rev_text);
+
+        if (config.thread_count > 1)
+        {
+            fm_index_construction_config shared_config{config};
+            shared_config.memory_budget = (config.memory_budget + 1) / 2;
+
+            // If the forward construction throws, the destructor of the future waits for the reverse construction.
+            std::future<void> rev_construction = std::async(std::launch::async, [this, &shared_config] ()
+            {
+                rev_fm.construct(rev_text, shared_config);
+            });
+            fwd_fm.construct(text, shared_config);
+            rev_construction.get();
+        }
+        else
+        {
+            fwd_fm.construct(text, config);
+            rev_fm.construct(rev_text, config);
+        }
 
         // does not work yet. segmentation fault in bi_fm_index_cursor snippet
         // bi_fm_index tmp;
@@ -227,10 +287,10 @@ public:
     }
 
     //!\overload
-    void construct(text_t &&) = delete;
+    void construct(text_t &&, fm_index_construction_config const & = {}) = delete;
 
     //!\overload
-    void construct(text_t const &&) = delete;
+    void construct(text_t const &&, fm_index_construction_config const & = {}) = delete;
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
      * \returns Returns the length of the indexed text including sentinel characters.
@@ -264,6 +324,22 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the indexed text.
+     * \returns A pointer to the indexed text, or `nullptr` if the index has been loaded from a file.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    text_t const * indexed_text() const noexcept
+    {
+        return text;
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -315,6 +391,78 @@ public:
         return {*this};
     }
 
+    /*!\brief Searches several queries exactly and reports the cursors of the queries that occur in the text.
+     * \tparam queries_t  The type of the queries; must model std::ranges::ForwardRange over
+     *                    std::ranges::RandomAccessRange over the index's alphabet.
+     * \tparam callback_t The type of the callback; must model std::Invocable with `size_t` and `cursor_type const &`.
+     * \param[in] queries  The queries to search.
+     * \param[in] callback Invoked with the position of the query in `queries` and a cursor pointing to the
+     *                     query for every query that occurs in the text.
+     *
+     * \details
+     *
+     * Searching a query character by character is bound by the latency of the memory accesses of each step, which
+     * depend on the previous step. This function searches a group of queries at the same time and extends them in
+     * turns, s.t. the memory accesses of different queries overlap. If the rank dictionary of the index supports it
+     * (e.g. seqan3::bi_fm_index_epr_traits), the data of the next step of a query is prefetched before the other
+     * queries are extended. The queries are extended to the right, i.e. both suffix array intervals of the reported
+     * cursors are computed.
+     *
+     * The callback is invoked in the order the searches finish, which is not necessarily the order of the queries.
+     *
+     * ### Complexity
+     *
+     * \f$\sum_{i} |queries_i| * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee if invoking the callback throws; no-throw guarantee otherwise.
+     */
+    template <std::ranges::ForwardRange queries_t, typename callback_t>
+    //!\cond
+        requires std::ranges::RandomAccessRange<value_type_t<queries_t>> &&
+                 ImplicitlyConvertibleTo<innermost_value_type_t<queries_t>, char_type> &&
+                 std::Invocable<callback_t, size_t, cursor_type const &>
+    //!\endcond
+    void search_batch(queries_t && queries, callback_t && callback) const
+    {
+        detail::interleaved_backward_search<cursor_type>{begin()}(queries, callback);
+    }
+
+    /*!\brief Searches several queries exactly.
+     * \tparam queries_t The type of the queries; must model std::ranges::ForwardRange over
+     *                   std::ranges::RandomAccessRange over the index's alphabet.
+     * \param[in] queries The queries to search.
+     * \returns A std::vector with a cursor pointing to the i-th query at position i if the query occurs in the
+     *          text and `std::nullopt` otherwise.
+     *
+     * \details
+     *
+     * See search_batch(queries_t &&, callback_t &&) const.
+     *
+     * ### Complexity
+     *
+     * \f$\sum_{i} |queries_i| * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    template <std::ranges::ForwardRange queries_t>
+    //!\cond
+        requires std::ranges::RandomAccessRange<value_type_t<queries_t>> &&
+                 ImplicitlyConvertibleTo<innermost_value_type_t<queries_t>, char_type>
+    //!\endcond
+    std::vector<std::optional<cursor_type>> search_batch(queries_t && queries) const
+    {
+        std::vector<std::optional<cursor_type>> cursors(std::ranges::distance(queries));
+        search_batch(queries, [&cursors] (size_t const query_id, cursor_type const & cursor)
+        {
+            cursors[query_id] = cursor;
+        });
+        return cursors;
+    }
+
     /*!\brief Returns a unidirectional seqan3::fm_index_cursor on the original text of the bidirectional index that
      *        can be used for searching.
      * \returns Returns a unidirectional seqan3::fm_index_cursor on the index of the original text.
@@ -351,6 +499,69 @@ public:
        return {rev_fm};
     }
 
+    /*!\brief Stores the index in a file that can be loaded with seqan3::bi_fm_index::load.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be written.
+     *
+     * \details
+     *
+     * The file consists of a seqan3::detail::fm_index_file_header followed by the SDSL data structures of the forward
+     * and of the reverse index. The indexed text is not stored.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        std::ofstream out{path, std::ios::binary};
+        if (!out.good())
+            throw file_open_error{"Could not open file " + path.string() + " for writing."};
+
+        file_header().write(out);
+        fwd_fm.serialise_sdsl(out);
+        rev_fm.serialise_sdsl(out);
+
+        if (!out.good())
+            throw file_open_error{"Could not write the index to file " + path.string() + "."};
+    }
+
+    /*!\brief Loads an index from a file written by seqan3::bi_fm_index::store.
+     * \param[in] path The path to the file.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::parse_error if the file does not contain an index of this type.
+     *
+     * \details
+     *
+     * See seqan3::fm_index::load.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void load(std::filesystem::path const & path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in.good())
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        file_header().read_and_check(in);
+        text = nullptr;
+        fwd_fm.deserialise_sdsl(in);
+        rev_fm.deserialise_sdsl(in);
+
+        if (!in)
+            throw parse_error{"The index file " + path.string() + " is truncated."};
+    }
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
@@ -365,6 +576,20 @@ public:
         archive(rev_fm);
     }
     //!\endcond
+
+protected:
+    //!\privatesection
+
+    //!\brief Returns the header of an index file describing this index type; the traits cover both indices.
+    static detail::fm_index_file_header file_header()
+    {
+        static_assert(detail::fm_index_file_traits_v<rev_sdsl_index_type>.is_supported(),
+                      "Only indices whose traits are listed in seqan3::detail::fm_index_file_traits can be stored.");
+
+        detail::fm_index_file_header header = fm_index_type::file_header(true);
+        header.rev_traits = detail::fm_index_file_traits_v<rev_sdsl_index_type>;
+        return header;
+    }
 };
 
 //!\}
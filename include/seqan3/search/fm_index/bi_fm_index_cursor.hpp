@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <utility>
 
 #include <sdsl/suffix_trees.hpp>
 
@@ -22,6 +24,24 @@
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/std/ranges>
 
+namespace seqan3
+{
+// forward declaration
+template <typename index_t>
+class bi_fm_index_cursor;
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// forward declaration
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(bi_fm_index_cursor<index_t> const & cursor) noexcept;
+
+template <typename cursor_t>
+class interleaved_backward_search;
+} // namespace seqan3::detail
+
 namespace seqan3
 {
 
@@ -134,6 +154,16 @@ protected:
     bool fwd_cursor_last_used = false;
 #endif
 
+    friend std::pair<size_type, size_type>
+    detail::get_suffix_array_range<index_t>(bi_fm_index_cursor const &) noexcept;
+
+    template <typename cursor_t>
+    friend class detail::interleaved_backward_search;
+
+    //!\brief Indicates whether the rank dictionary of the underlying SDSL indices can prefetch the data of a query.
+    static bool constexpr has_prefetch =
+        detail::is_epr_dictionary_v<typename index_type::sdsl_index_type::wavelet_tree_type>;
+
     //!\brief Helper function to recompute text positions since the indexed text is reversed.
     size_type offset() const noexcept
     {
@@ -234,6 +264,72 @@ protected:
         return false;
     }
 
+    /*!\brief Looks up the intervals of a string in the k-mer lookup tables of both underlying indices.
+     * \param[in]  first       Iterator to the first character of the string in the direction of the extension.
+     * \param[in]  kmer_length The length of the string; must be supported by both tables.
+     * \param[in]  with_parent Whether the interval of the string without its last character is needed.
+     * \param[in]  table       The table of the index in the direction of the extension.
+     * \param[in]  other_table The table of the index in the opposite direction.
+     * \param[out] l           Left interval of the string in the direction of the extension.
+     * \param[out] r           Right interval of the string in the direction of the extension.
+     * \param[out] l_other     Left interval of the string in the opposite direction.
+     * \param[out] r_other     Right interval of the string in the opposite direction.
+     * \param[out] parent_l    Left interval of the string without its last character if `with_parent` is set.
+     * \param[out] parent_r    Right interval of the string without its last character if `with_parent` is set.
+     * \returns `true` if the string occurs in the text, `false` otherwise (no output is modified).
+     *
+     * \details
+     *
+     * The string is read in the opposite direction in the index of the opposite direction. Both ranks are computed in
+     * a single pass over the characters.
+     */
+    template <typename iterator_t, typename table_t, typename other_table_t>
+    bool kmer_lookup(iterator_t first, uint8_t const kmer_length, bool const with_parent,
+                     table_t const & table, other_table_t const & other_table,
+                     size_type & l, size_type & r, size_type & l_other, size_type & r_other,
+                     size_type & parent_l, size_type & parent_r) const noexcept
+    {
+        uint64_t const table_sigma = table.sigma();
+        uint64_t kmer{0}, parent_kmer{0}, reversed_kmer{0}, power{1};
+
+        for (uint8_t i = 0; i < kmer_length; ++i, ++first)
+        {
+            uint64_t const rank = to_rank(*first);
+            parent_kmer = kmer;
+            kmer = kmer * table_sigma + rank;
+            reversed_kmer += rank * power;
+            power *= table_sigma;
+        }
+
+        size_type _l, _r;
+        if (!table.lookup(kmer, kmer_length, _l, _r))
+            return false;
+
+        other_table.lookup(reversed_kmer, kmer_length, l_other, r_other);
+        if (with_parent && kmer_length > 1)
+            table.lookup(parent_kmer, kmer_length - 1, parent_l, parent_r);
+
+        l = _l;
+        r = _r;
+        return true;
+    }
+
+    //!\brief The length of the prefix of a query that extend_right() looks up at the root instead of searching it.
+    size_type lookup_length() const noexcept
+    {
+        return std::min(index->fwd_fm.kmer_table.length(), index->rev_fm.kmer_table.length());
+    }
+
+    //!\brief Prefetches the data of the rank queries of the next extend_right() if the rank dictionary supports it.
+    void prefetch_extension() const noexcept
+    {
+        if constexpr (has_prefetch)
+        {
+            index->fwd_fm.index.wavelet_tree.prefetch(fwd_lb);
+            index->fwd_fm.index.wavelet_tree.prefetch(fwd_rb + 1);
+        }
+    }
+
 public:
 
     /*!\name Constructors, destructor and assignment
@@ -488,6 +584,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the cursor points to the root and the index has k-mer lookup tables (see
+     * seqan3::fm_index_construction_config::kmer_lookup_length), the intervals of the first characters are looked up
+     * instead of searched.
+     *
      * ### Complexity
      *
      * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
@@ -514,8 +614,28 @@ public:
         size_type _fwd_lb = fwd_lb, _fwd_rb = fwd_rb, _rev_lb = rev_lb, _rev_rb = rev_rb;
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
         sdsl_char_type c = _last_char;
+        auto it = first;
+
+        // Look up the intervals of the longest prefix that is covered by the k-mer lookup tables.
+        uint8_t const table_length = std::min(index->fwd_fm.kmer_table.length(), index->rev_fm.kmer_table.length());
+        if (depth == 0 && table_length > 0 && first != last)
+        {
+            uint8_t const prefix_length = std::min<size_type>(last - first, table_length);
+
+            new_parent_lb = _fwd_lb;
+            new_parent_rb = _fwd_rb;
+            if (!kmer_lookup(first, prefix_length, prefix_length == last - first, index->fwd_fm.kmer_table,
+                             index->rev_fm.kmer_table, _fwd_lb, _fwd_rb, _rev_lb, _rev_rb, new_parent_lb,
+                             new_parent_rb))
+            {
+                return false;
+            }
+
+            it += prefix_length;
+            c = to_rank(*(it - 1)) + 1;
+        }
 
-        for (auto it = first; it != last; ++it)
+        for (; it != last; ++it)
         {
             c = to_rank(*it) + 1;
 
@@ -547,6 +667,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the cursor points to the root and the index has k-mer lookup tables (see
+     * seqan3::fm_index_construction_config::kmer_lookup_length), the intervals of the last characters are looked up
+     * instead of searched.
+     *
      * Example:
      *
      * \snippet test/snippet/search/bi_fm_index_cursor.cpp extend_left_seq
@@ -580,8 +704,28 @@ public:
                   _rev_lb = rev_lb, _rev_rb = rev_rb;
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
         sdsl_char_type c = _last_char;
+        auto it = first;
 
-        for (auto it = first; it != last; ++it)
+        // Look up the intervals of the longest suffix that is covered by the k-mer lookup tables.
+        uint8_t const table_length = std::min(index->fwd_fm.kmer_table.length(), index->rev_fm.kmer_table.length());
+        if (depth == 0 && table_length > 0 && first != last)
+        {
+            uint8_t const suffix_length = std::min<size_type>(last - first, table_length);
+
+            new_parent_lb = _rev_lb;
+            new_parent_rb = _rev_rb;
+            if (!kmer_lookup(first, suffix_length, suffix_length == last - first, index->rev_fm.kmer_table,
+                             index->fwd_fm.kmer_table, _rev_lb, _rev_rb, _fwd_lb, _fwd_rb, new_parent_lb,
+                             new_parent_rb))
+            {
+                return false;
+            }
+
+            it += suffix_length;
+            c = to_rank(*(it - 1)) + 1;
+        }
+
+        for (; it != last; ++it)
         {
             c = to_rank(*it) + 1;
 
@@ -911,6 +1055,11 @@ public:
     /*!\brief Locates the occurrences of the searched query in the text.
      * \returns Positions in the text.
      *
+     * \details
+     *
+     * The occurrences are located in batches whose LF walks advance in lockstep, see
+     * seqan3::fm_index::locate_sa_interval.
+     *
      * ### Complexity
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
@@ -926,12 +1075,7 @@ public:
     {
         assert(index != nullptr);
 
-        std::vector<size_type> occ(count());
-        for (size_type i = 0; i < occ.size(); ++i)
-        {
-            occ[i] = offset() - index->fwd_fm.index[fwd_lb + i];
-        }
-        return occ;
+        return index->fwd_fm.locate_interval(fwd_lb, count(), query_length());
     }
 
     //!\overload
@@ -942,16 +1086,7 @@ public:
     {
         assert(index != nullptr);
 
-        std::vector<std::pair<size_type, size_type>> occ;
-        occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            size_type loc = offset() - index->fwd_fm.index[fwd_lb + i];
-            size_type sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
-            size_type sequence_position = loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
-            occ.emplace_back(sequence_rank - 1, sequence_position);
-        }
-        return occ;
+        return index->fwd_fm.locate_interval(fwd_lb, count(), query_length());
     }
 
     /*!\brief Locates the occurrences of the searched query in the text on demand, i.e. a ranges::view is returned
@@ -1006,3 +1141,21 @@ public:
 //!\}
 
 } // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the suffix array interval of a seqan3::bi_fm_index_cursor in the forward index.
+ * \ingroup fm_index
+ * \tparam index_t The type of the underlying index.
+ * \param[in] cursor The cursor.
+ * \returns A std::pair with the left and the right bound of the suffix array interval (both inclusive).
+ */
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(bi_fm_index_cursor<index_t> const & cursor) noexcept
+{
+    return {cursor.fwd_lb, cursor.fwd_rb};
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,397 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides an EPR dictionary (enhanced prefixsum rank dictionary) that can replace the wavelet tree of an SDSL
+ *        index over small alphabets.
+ * \details The occurrence counts and the bit-packed symbols of 64 consecutive positions are interleaved in a single
+ *          cache line, s.t. the rank of any (or every) symbol is answered with a single cache miss.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <sdsl/bits.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/int_vector_buffer.hpp>
+#include <sdsl/sdsl_concepts.hpp>
+
+#include <seqan3/core/platform.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/array.hpp>
+#include <cereal/types/vector.hpp>
+#endif // SEQAN3_WITH_CEREAL
+
+namespace sdsl
+{
+
+    /*!\brief An EPR dictionary that can be used instead of a wavelet tree in an sdsl::csa_wt over a byte alphabet.
+     * \tparam t_sigma The number of different symbols, i.e. all symbols must be smaller than `t_sigma`;
+     *                 must be in `[2, 8]`.
+     *
+     * \details
+     *
+     * The text is divided into blocks of 64 symbols. Each block stores for every symbol the number of its occurrences
+     * before the block (relative to a superblock of \f$2^{32}\f$ symbols) and the symbols of the block in
+     * \f$\lceil \log_2 \sigma \rceil\f$ bit planes. A block occupies exactly one cache line. The rank of a symbol is
+     * the count of the block plus the population count of the symbol's positions in the block, which are obtained by
+     * combining the bit planes.
+     *
+     * Besides the interface of an SDSL wavelet tree (rank(), select(), inverse_select(), lex_count()), the dictionary
+     * provides rank_all() that returns the ranks of all symbols for a position at the cost of a single rank query and
+     * prefetch() that loads the cache line of a position ahead of a query.
+     */
+    template <uint8_t t_sigma = 8>
+    class epr_dictionary
+    {
+        static_assert(t_sigma >= 2 && t_sigma <= 8, "The EPR dictionary only supports between 2 and 8 symbols.");
+
+        //!\cond
+    public:
+        typedef int_vector<>::size_type size_type;
+        typedef int_vector<>::difference_type difference_type;
+        typedef uint8_t value_type;
+        typedef wt_tag index_category;
+        typedef byte_alphabet_tag alphabet_category;
+        enum { lex_ordered = 1 };
+
+        //! Number of symbols in a block.
+        static constexpr size_type block_size = 64;
+        //! Number of symbols in a superblock.
+        static constexpr size_type superblock_size = 1ULL << 32;
+        //! Number of bit planes needed to represent a symbol.
+        static constexpr uint8_t plane_count = (t_sigma <= 2) ? 1 : ((t_sigma <= 4) ? 2 : 3);
+
+    private:
+        //! Counts and symbols of block_size consecutive positions.
+        struct alignas(64) block_type
+        {
+            std::array<uint32_t, t_sigma> counts{}; // occurrences before the block within its superblock
+            std::array<uint64_t, plane_count> planes{}; // bit p of the i-th symbol is bit i of planes[p]
+
+            bool operator==(block_type const & other) const noexcept
+            {
+                return (counts == other.counts) && (planes == other.planes);
+            }
+
+            template <typename archive_t>
+            void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & ar)
+            {
+                ar(counts, planes);
+            }
+        };
+
+        static_assert(sizeof(block_type) == 64, "A block must fit into a single cache line.");
+
+        size_type m_size = 0;
+        std::vector<block_type> m_blocks;
+        std::vector<uint64_t> m_superblocks; // t_sigma occurrence counts before each superblock
+
+        //! Marks the positions in the block that contain the symbol `c`.
+        static uint64_t symbol_mask(block_type const & block, value_type const c) noexcept
+        {
+            uint64_t mask = ~0ULL;
+            for (uint8_t p = 0; p < plane_count; ++p)
+                mask &= ((c >> p) & 1) ? block.planes[p] : ~block.planes[p];
+            return mask;
+        }
+
+        //! Marks the positions in the block that are smaller than `i`.
+        static uint64_t prefix_mask(size_type const i) noexcept
+        {
+            size_type const offset = i % block_size;
+            return (offset == 0) ? 0ULL : (~0ULL >> (block_size - offset));
+        }
+
+        //! Number of occurrences of `c` before the block with the given id.
+        size_type block_rank(size_type const block_id, value_type const c) const noexcept
+        {
+            size_type const superblock_id = block_id * block_size / superblock_size;
+            return m_superblocks[superblock_id * t_sigma + c] + m_blocks[block_id].counts[c];
+        }
+
+        //! Starts a new block at position `i`.
+        void start_block(size_type const i, std::array<uint64_t, t_sigma> const & total)
+        {
+            if (i % superblock_size == 0)
+                m_superblocks.insert(m_superblocks.end(), total.begin(), total.end());
+
+            block_type & block = m_blocks.emplace_back();
+            uint64_t const * const superblock = &m_superblocks[(i / superblock_size) * t_sigma];
+            for (uint8_t c = 0; c < t_sigma; ++c)
+                block.counts[c] = total[c] - superblock[c];
+        }
+
+        //! Constructs the dictionary from the symbols returned by `next_symbol` for the positions [0, len).
+        template <typename t_next_symbol>
+        void construct(size_type const len, t_next_symbol && next_symbol)
+        {
+            std::array<uint64_t, t_sigma> total{};
+
+            m_size = len;
+            m_blocks.clear();
+            m_blocks.reserve(len / block_size + 1);
+            m_superblocks.clear();
+
+            for (size_type i = 0; i < len; ++i)
+            {
+                value_type const c = next_symbol();
+                if (c >= t_sigma)
+                    throw std::invalid_argument{"The text contains a symbol that is not supported by the EPR "
+                                                "dictionary."};
+
+                if (i % block_size == 0)
+                    start_block(i, total);
+
+                for (uint8_t p = 0; p < plane_count; ++p)
+                    m_blocks.back().planes[p] |= static_cast<uint64_t>((c >> p) & 1) << (i % block_size);
+
+                ++total[c];
+            }
+
+            // rank(size(), c) reads the block that contains position size()
+            if (len % block_size == 0)
+                start_block(len, total);
+        }
+
+    public:
+        //! Default constructor
+        epr_dictionary() = default;
+
+        /*! Construct from a byte-stream
+         *  \param buf Byte stream.
+         *  \param len Length of the byte stream.
+         */
+        epr_dictionary(int_vector_buffer<8> & buf, int_vector_size_type const len)
+        {
+            assert(len <= buf.size());
+            size_type i = 0;
+            construct(len, [&] () -> value_type { return buf[i++]; });
+        }
+
+        /*! Construct from a range of symbols
+         *  \param begin Iterator to the first symbol.
+         *  \param end   Iterator behind the last symbol.
+         */
+        template <typename t_it>
+        epr_dictionary(t_it begin, t_it end, std::string const & = "")
+        {
+            construct(std::distance(begin, end), [&begin] () -> value_type { return *begin++; });
+        }
+
+        epr_dictionary(epr_dictionary const &) = default;
+        epr_dictionary(epr_dictionary &&) = default;
+        epr_dictionary & operator=(epr_dictionary const &) = default;
+        epr_dictionary & operator=(epr_dictionary &&) = default;
+
+        void swap(epr_dictionary & other) noexcept
+        {
+            std::swap(m_size, other.m_size);
+            m_blocks.swap(other.m_blocks);
+            m_superblocks.swap(other.m_superblocks);
+        }
+
+        size_type size() const noexcept
+        {
+            return m_size;
+        }
+
+        bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        //! Returns the i-th symbol.
+        value_type operator[](size_type const i) const noexcept
+        {
+            assert(i < m_size);
+
+            block_type const & block = m_blocks[i / block_size];
+            value_type c = 0;
+            for (uint8_t p = 0; p < plane_count; ++p)
+                c |= ((block.planes[p] >> (i % block_size)) & 1) << p;
+            return c;
+        }
+
+        //! Returns the number of occurrences of `c` in [0, i).
+        size_type rank(size_type const i, value_type const c) const noexcept
+        {
+            assert(i <= m_size);
+
+            if (c >= t_sigma)
+                return 0;
+
+            size_type const block_id = i / block_size;
+            return block_rank(block_id, c) + bits::cnt(symbol_mask(m_blocks[block_id], c) & prefix_mask(i));
+        }
+
+        //! Returns the number of occurrences of every symbol in [0, i).
+        std::array<size_type, t_sigma> rank_all(size_type const i) const noexcept
+        {
+            assert(i <= m_size);
+
+            size_type const block_id = i / block_size;
+            block_type const & block = m_blocks[block_id];
+            uint64_t const * const superblock = &m_superblocks[(block_id * block_size / superblock_size) * t_sigma];
+            uint64_t const prefix = prefix_mask(i);
+
+            std::array<size_type, t_sigma> ranks;
+            for (uint8_t c = 0; c < t_sigma; ++c)
+                ranks[c] = superblock[c] + block.counts[c] + bits::cnt(symbol_mask(block, c) & prefix);
+            return ranks;
+        }
+
+        //! Hints the processor to load the block of position `i` into the cache ahead of a rank query.
+        void prefetch(size_type const i) const noexcept
+        {
+            assert(i <= m_size);
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(&m_blocks[i / block_size]);
+#else
+            (void) i;
+#endif
+        }
+
+        //! Returns the i-th symbol and the number of its occurrences in [0, i).
+        std::pair<size_type, value_type> inverse_select(size_type const i) const noexcept
+        {
+            value_type const c = (*this)[i];
+            return {rank(i, c), c};
+        }
+
+        //! Returns the position of the i-th occurrence of `c` (starting with 1).
+        size_type select(size_type const i, value_type const c) const noexcept
+        {
+            assert(i > 0 && c < t_sigma && i <= rank(m_size, c));
+
+            // the last block with less than i occurrences of c before it
+            size_type lo = 0, hi = m_blocks.size();
+            while (hi - lo > 1)
+            {
+                size_type const mid = lo + (hi - lo) / 2;
+                if (block_rank(mid, c) < i)
+                    lo = mid;
+                else
+                    hi = mid;
+            }
+
+            uint64_t mask = symbol_mask(m_blocks[lo], c);
+            for (size_type k = block_rank(lo, c) + 1; k < i; ++k)
+                mask &= mask - 1; // remove the lowest occurrence
+
+            return lo * block_size + bits::lo(mask);
+        }
+
+        /*! Returns the rank of `c` in [0, i) and the number of symbols smaller and larger than `c` in [i, j).
+         *  \returns A tuple of the rank, the number of smaller symbols and the number of larger symbols.
+         */
+        std::tuple<size_type, size_type, size_type> lex_count(size_type const i, size_type const j,
+                                                              value_type const c) const noexcept
+        {
+            assert(i <= j && j <= m_size);
+
+            std::array<size_type, t_sigma> const rank_i = rank_all(i);
+            std::array<size_type, t_sigma> const rank_j = rank_all(j);
+
+            size_type smaller = 0;
+            for (uint8_t s = 0; s < std::min<size_type>(c, t_sigma); ++s)
+                smaller += rank_j[s] - rank_i[s];
+
+            if (c >= t_sigma)
+                return {0, smaller, 0};
+
+            return {rank_i[c], smaller, j - i - smaller - (rank_j[c] - rank_i[c])};
+        }
+
+        size_type serialize(std::ostream & out, structure_tree_node * v = nullptr, std::string name = "") const
+        {
+            structure_tree_node * child = structure_tree::add_child(v, name, util::class_name(*this));
+            size_type written_bytes = write_member(m_size, out, child, "m_size");
+
+            // blocks are written without padding
+            for (block_type const & block : m_blocks)
+            {
+                out.write(reinterpret_cast<char const *>(block.counts.data()), sizeof(block.counts));
+                out.write(reinterpret_cast<char const *>(block.planes.data()), sizeof(block.planes));
+                written_bytes += sizeof(block.counts) + sizeof(block.planes);
+            }
+
+            out.write(reinterpret_cast<char const *>(m_superblocks.data()), m_superblocks.size() * sizeof(uint64_t));
+            written_bytes += m_superblocks.size() * sizeof(uint64_t);
+
+            structure_tree::add_size(child, written_bytes);
+            return written_bytes;
+        }
+
+        void load(std::istream & in)
+        {
+            read_member(m_size, in);
+
+            m_blocks.resize(m_size / block_size + 1);
+            for (block_type & block : m_blocks)
+            {
+                in.read(reinterpret_cast<char *>(block.counts.data()), sizeof(block.counts));
+                in.read(reinterpret_cast<char *>(block.planes.data()), sizeof(block.planes));
+            }
+
+            m_superblocks.resize((m_size / superblock_size + 1) * t_sigma);
+            in.read(reinterpret_cast<char *>(m_superblocks.data()), m_superblocks.size() * sizeof(uint64_t));
+        }
+
+        template <typename archive_t>
+        void CEREAL_SAVE_FUNCTION_NAME(archive_t & ar) const
+        {
+            ar(CEREAL_NVP(m_size));
+            ar(CEREAL_NVP(m_blocks));
+            ar(CEREAL_NVP(m_superblocks));
+        }
+
+        template <typename archive_t>
+        void CEREAL_LOAD_FUNCTION_NAME(archive_t & ar)
+        {
+            ar(CEREAL_NVP(m_size));
+            ar(CEREAL_NVP(m_blocks));
+            ar(CEREAL_NVP(m_superblocks));
+        }
+
+        bool operator==(epr_dictionary const & other) const noexcept
+        {
+            return (m_size == other.m_size) && (m_blocks == other.m_blocks) && (m_superblocks == other.m_superblocks);
+        }
+
+        bool operator!=(epr_dictionary const & other) const noexcept
+        {
+            return !(*this == other);
+        }
+        //!\endcond
+    };
+
+}
+
+namespace seqan3::detail
+{
+
+//!\brief Whether `t` is an sdsl::epr_dictionary. \ingroup submodule_fm_index
+template <typename t>
+inline constexpr bool is_epr_dictionary_v = false;
+
+//!\cond
+template <uint8_t sigma>
+inline constexpr bool is_epr_dictionary_v<sdsl::epr_dictionary<sigma>> = true;
+//!\endcond
+
+} // namespace seqan3::detail
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the in-memory and external memory construction of the SDSL index underlying seqan3::fm_index.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <sdsl/construct.hpp>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_config.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+//!\brief Where the SDSL cache of a construction resides and how the suffix array is built.
+enum struct sdsl_construction_mode : uint8_t
+{
+    ram_cache,    //!< The cache resides in the RAM file system, the suffix array is sorted in memory.
+    disk_cache,   //!< The cache resides in the temporary directory, the suffix array is sorted in memory.
+    semi_external //!< The cache resides in the temporary directory, the suffix array is built semi-externally.
+};
+
+//!\brief The number of bytes of a suffix array entry built by libdivsufsort for a text of the given size.
+inline size_t sdsl_suffix_array_width(size_t const text_size) noexcept
+{
+    return (text_size < (1ULL << 31)) ? 4 : 8;
+}
+
+/*!\brief Estimates the memory peak of a construction whose cache resides in the RAM file system.
+ * \param[in] text_size The size of the text including delimiters.
+ * \returns The estimated number of bytes.
+ *
+ * \details
+ *
+ * The peak is reached while the suffix array is sorted: the RAM file system holds the text, the suffix array
+ * construction holds a second copy of the text and the suffix array, and the sorted suffix array is copied into the
+ * RAM file system. The suffix array of libdivsufsort uses 32 bit integers for texts shorter than \f$2^{31}\f$ and
+ * 64 bit integers otherwise.
+ */
+inline size_t fm_index_in_memory_construction_bytes(size_t const text_size) noexcept
+{
+    return text_size * (2 + 2 * sdsl_suffix_array_width(text_size));
+}
+
+/*!\brief Estimates the memory peak of a construction whose cache resides on disk and whose suffix array is sorted in
+ *        memory.
+ * \param[in] text_size The size of the text including delimiters.
+ * \returns The estimated number of bytes.
+ *
+ * \details
+ *
+ * The cache files are written to disk, so only the copy of the text and the suffix array held while sorting count;
+ * this is about half of seqan3::detail::fm_index_in_memory_construction_bytes.
+ */
+inline size_t fm_index_disk_cache_construction_bytes(size_t const text_size) noexcept
+{
+    return text_size * (1 + sdsl_suffix_array_width(text_size));
+}
+
+/*!\brief Selects the construction mode whose estimated memory peak fits into the memory budget.
+ * \param[in] text_size The size of the text including delimiters.
+ * \param[in] config    The construction options.
+ * \returns seqan3::detail::sdsl_construction_mode::ram_cache if the budget is unlimited or the estimate of
+ *          seqan3::detail::fm_index_in_memory_construction_bytes fits, otherwise
+ *          seqan3::detail::sdsl_construction_mode::disk_cache if the estimate of
+ *          seqan3::detail::fm_index_disk_cache_construction_bytes fits, and
+ *          seqan3::detail::sdsl_construction_mode::semi_external else.
+ */
+inline sdsl_construction_mode select_sdsl_construction_mode(size_t const text_size,
+                                                            fm_index_construction_config const & config) noexcept
+{
+    if (config.memory_budget == 0 || fm_index_in_memory_construction_bytes(text_size) <= config.memory_budget)
+        return sdsl_construction_mode::ram_cache;
+    else if (fm_index_disk_cache_construction_bytes(text_size) <= config.memory_budget)
+        return sdsl_construction_mode::disk_cache;
+    else
+        return sdsl_construction_mode::semi_external;
+}
+
+/*!\brief Writes a text into an SDSL cache and constructs data structures from the cache files.
+ * \tparam write_text_t  The type of the callback writing the text; must model std::Invocable with
+ *                       `sdsl::int_vector_buffer<8> &`.
+ * \tparam construct_t   The type of the callback constructing from the cache; must model std::Invocable with
+ *                       `sdsl::cache_config &`.
+ * \param[in] owner      The address of the object that is constructed; used to name the cache files.
+ * \param[in] write_text Appends the ranks of the (reversed) text to the given buffer; the ranks must not be 0.
+ * \param[in] text_size  The number of ranks written by `write_text`.
+ * \param[in] config     The construction options.
+ * \param[in] construct  Constructs the data structures from the text file and the suffix array of the given cache
+ *                       (keys `sdsl::conf::KEY_TEXT` and `sdsl::conf::KEY_SA`); files it adds to the cache are
+ *                       removed afterwards.
+ * \throws seqan3::file_open_error if the directory for temporary files does not exist.
+ *
+ * \details
+ *
+ * The ranks are streamed into the text file of an SDSL cache, i.e. the text is never copied into an intermediate
+ * container. The cache resides in the RAM file system of the SDSL or in the directory for temporary files, and the
+ * suffix array is sorted in memory or built semi-externally, as selected by
+ * seqan3::detail::select_sdsl_construction_mode. If the cache resides on disk, the text file does not occupy main
+ * memory. All cache files are removed afterwards.
+ *
+ * The suffix array is added to the cache before `construct` is invoked, which skips the suffix array construction of
+ * the SDSL for a cached suffix array. The semi-external suffix array is built with `sdsl::construct_sa_se` directly,
+ * i.e. the process-wide suffix array construction setting of the SDSL (`sdsl::construct_config`) is never changed. An
+ * in-memory construction uses the algorithm selected by this setting.
+ *
+ * The name of the cache files is derived from `owner` instead of the global counter of the SDSL, s.t. several indices
+ * can be constructed concurrently.
+ */
+template <typename write_text_t, typename construct_t>
+//!\cond
+    requires std::Invocable<write_text_t, sdsl::int_vector_buffer<8> &> &&
+             std::Invocable<construct_t, sdsl::cache_config &>
+//!\endcond
+inline void construct_from_sdsl_cache(void const * const owner, write_text_t && write_text, size_t const text_size,
+                                      fm_index_construction_config const & config, construct_t && construct)
+{
+    sdsl_construction_mode const mode = select_sdsl_construction_mode(text_size, config);
+
+    std::string cache_dir{"@"}; // prefix of the RAM file system
+    if (mode != sdsl_construction_mode::ram_cache)
+    {
+        std::filesystem::path const tmp_dir = config.tmp_dir.empty() ? std::filesystem::temp_directory_path()
+                                                                      : config.tmp_dir;
+        if (!std::filesystem::is_directory(tmp_dir))
+            throw file_open_error{"The directory " + tmp_dir.string() + " for temporary files does not exist."};
+        cache_dir = tmp_dir.string();
+    }
+
+    std::string const id = "seqan3_" + std::to_string(sdsl::util::pid()) + "_" +
+                           std::to_string(reinterpret_cast<uintptr_t>(owner));
+    sdsl::cache_config cache{true, cache_dir, id};
+    std::string const text_file = sdsl::cache_file_name(sdsl::conf::KEY_TEXT, cache);
+
+    try
+    {
+        {
+            sdsl::int_vector_buffer<8> text_buffer{text_file, std::ios::out};
+            write_text(text_buffer);
+            assert(text_buffer.size() == text_size);
+            text_buffer.push_back(0); // The SDSL expects the text to be terminated by the sentinel.
+        }
+
+        sdsl::register_cache_file(sdsl::conf::KEY_TEXT, cache);
+        if (mode == sdsl_construction_mode::semi_external)
+            sdsl::construct_sa_se(cache);
+        else
+            sdsl::construct_sa<8>(cache);
+        sdsl::register_cache_file(sdsl::conf::KEY_SA, cache);
+
+        construct(cache);
+    }
+    catch (...)
+    {
+        for (char const * key : {sdsl::conf::KEY_TEXT, sdsl::conf::KEY_SA, sdsl::conf::KEY_BWT})
+            sdsl::remove(sdsl::cache_file_name(key, cache));
+        throw;
+    }
+
+    sdsl::util::delete_all_files(cache.file_map);
+}
+
+/*!\brief Constructs an SDSL index over a text that is written by a callback.
+ * \tparam sdsl_index_t  The type of the SDSL index; must use a byte alphabet.
+ * \tparam write_text_t  The type of the callback; must model std::Invocable with `sdsl::int_vector_buffer<8> &`.
+ * \param[out] index     The SDSL index to construct.
+ * \param[in] write_text Appends the ranks of the (reversed) text to the given buffer; the ranks must not be 0.
+ * \param[in] text_size  The number of ranks written by `write_text`.
+ * \param[in] config     The construction options.
+ * \throws seqan3::file_open_error if the directory for temporary files does not exist.
+ *
+ * \details
+ *
+ * The Burrows-Wheeler transform and the index are constructed from the text file and the suffix array of an SDSL
+ * cache, see seqan3::detail::construct_from_sdsl_cache.
+ */
+template <typename sdsl_index_t, typename write_text_t>
+//!\cond
+    requires std::Invocable<write_text_t, sdsl::int_vector_buffer<8> &>
+//!\endcond
+inline void construct_sdsl_index(sdsl_index_t & index, write_text_t && write_text, size_t const text_size,
+                                 fm_index_construction_config const & config)
+{
+    construct_from_sdsl_cache(&index, write_text, text_size, config, [&index] (sdsl::cache_config & cache)
+    {
+        sdsl::construct(index, sdsl::cache_file_name(sdsl::conf::KEY_TEXT, cache), cache, 0);
+    });
+}
+
+/*!\brief Constructs an SDSL index over a text that is given by the ranks of its characters.
+ * \tparam sdsl_index_t The type of the SDSL index; must use a byte alphabet.
+ * \tparam ranks_t      The type of the ranks; must model std::ranges::InputRange over `uint8_t`.
+ * \param[out] index    The SDSL index to construct.
+ * \param[in] ranks     The (reversed) text to construct the index from; must not contain 0.
+ * \param[in] text_size The size of `ranks`.
+ * \param[in] config    The construction options.
+ * \throws seqan3::file_open_error if the directory for temporary files does not exist.
+ *
+ * \details
+ *
+ * The ranks are consumed lazily, see the overload taking a callback.
+ */
+template <typename sdsl_index_t, std::ranges::InputRange ranks_t>
+inline void construct_sdsl_index(sdsl_index_t & index, ranks_t && ranks, size_t const text_size,
+                                 fm_index_construction_config const & config)
+{
+    construct_sdsl_index(index, [&ranks] (sdsl::int_vector_buffer<8> & text_buffer)
+    {
+        for (uint8_t const rank : ranks)
+            text_buffer.push_back(rank);
+    }, text_size, config);
+}
+
+//!\}
+
+} // namespace seqan3::detail
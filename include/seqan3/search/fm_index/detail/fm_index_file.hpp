@@ -0,0 +1,303 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the header of the on-disk layout of seqan3::fm_index and seqan3::bi_fm_index.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include <sdsl/suffix_arrays.hpp>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
+#include <seqan3/search/fm_index/detail/epr_dictionary.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief The identifiers of the rank structures over the Burrows-Wheeler transform that can be stored in an index file.
+ *
+ * \details
+ *
+ * The values are part of the on-disk layout: they are never reused or renumbered, new rank structures get new
+ * values and incompatible changes increase seqan3::detail::fm_index_file_header::traits_version.
+ */
+enum struct fm_index_rank_structure : uint8_t
+{
+    unknown        = 0, //!< A rank structure that cannot be stored.
+    wt_blcd        = 1, //!< The sdsl::wt_blcd of seqan3::fm_index_default_traits.
+    epr_dictionary = 2  //!< An sdsl::epr_dictionary; its number of symbols follows from the alphabet size.
+};
+
+/*!\brief The identifiers of the layouts of the text in the rank structure that can be stored in an index file.
+ *
+ * \details
+ *
+ * The layout is determined by the alphabet strategy of the SDSL index, which maps the ranks of the text to the
+ * symbols of the rank structure. The values are never reused or renumbered.
+ */
+enum struct fm_index_text_layout : uint8_t
+{
+    unknown    = 0, //!< A layout that cannot be stored.
+    plain_byte = 1, //!< sdsl::plain_byte_alphabet, i.e. each rank is a symbol.
+    byte       = 2  //!< sdsl::byte_alphabet, i.e. the ranks occurring in the text are compacted.
+};
+
+//!\brief The identifier of the rank structure `rank_structure_t`.
+template <typename rank_structure_t>
+inline constexpr fm_index_rank_structure fm_index_rank_structure_v = fm_index_rank_structure::unknown;
+
+//!\cond
+template <>
+inline constexpr fm_index_rank_structure fm_index_rank_structure_v<sdsl::wt_blcd<sdsl::bit_vector,
+                                                                                 sdsl::rank_support_v<>,
+                                                                                 sdsl::select_support_scan<>,
+                                                                                 sdsl::select_support_scan<0>>> =
+    fm_index_rank_structure::wt_blcd;
+
+template <uint8_t sigma>
+inline constexpr fm_index_rank_structure fm_index_rank_structure_v<sdsl::epr_dictionary<sigma>> =
+    fm_index_rank_structure::epr_dictionary;
+//!\endcond
+
+//!\brief The identifier of the text layout of the alphabet strategy `alphabet_strategy_t`.
+template <typename alphabet_strategy_t>
+inline constexpr fm_index_text_layout fm_index_text_layout_v = fm_index_text_layout::unknown;
+
+//!\cond
+template <>
+inline constexpr fm_index_text_layout fm_index_text_layout_v<sdsl::plain_byte_alphabet> =
+    fm_index_text_layout::plain_byte;
+
+template <>
+inline constexpr fm_index_text_layout fm_index_text_layout_v<sdsl::byte_alphabet> = fm_index_text_layout::byte;
+//!\endcond
+
+/*!\brief The traits of an SDSL index as they are stored in an index file.
+ *
+ * \details
+ *
+ * Only an sdsl::csa_wt with the default sampling strategies (sdsl::sa_order_sa_sampling and sdsl::isa_sampling), a
+ * rank structure listed in seqan3::detail::fm_index_rank_structure and an alphabet strategy listed in
+ * seqan3::detail::fm_index_text_layout can be stored.
+ */
+struct fm_index_file_traits
+{
+    //!\brief The identifier of the rank structure.
+    fm_index_rank_structure rank_structure{fm_index_rank_structure::unknown};
+    //!\brief The identifier of the text layout.
+    fm_index_text_layout text_layout{fm_index_text_layout::unknown};
+    //!\brief Every `sa_sampling_rate`-th suffix array value is stored.
+    uint32_t sa_sampling_rate{};
+    //!\brief Every `isa_sampling_rate`-th inverse suffix array value is stored.
+    uint32_t isa_sampling_rate{};
+
+    //!\brief Whether the traits can be stored, i.e. whether they are identified.
+    constexpr bool is_supported() const noexcept
+    {
+        return rank_structure != fm_index_rank_structure::unknown && text_layout != fm_index_text_layout::unknown;
+    }
+};
+
+//!\brief The traits of the SDSL index `sdsl_index_t` as they are stored in an index file; unknown traits by default.
+template <typename sdsl_index_t>
+inline constexpr fm_index_file_traits fm_index_file_traits_v{};
+
+//!\cond
+template <typename rank_structure_t, uint32_t sa_sampling_rate, uint32_t isa_sampling_rate,
+          typename alphabet_strategy_t>
+inline constexpr fm_index_file_traits fm_index_file_traits_v<sdsl::csa_wt<rank_structure_t,
+                                                                          sa_sampling_rate,
+                                                                          isa_sampling_rate,
+                                                                          sdsl::sa_order_sa_sampling<>,
+                                                                          sdsl::isa_sampling<>,
+                                                                          alphabet_strategy_t>> =
+    fm_index_file_traits{fm_index_rank_structure_v<rank_structure_t>,
+                         fm_index_text_layout_v<alphabet_strategy_t>,
+                         sa_sampling_rate,
+                         isa_sampling_rate};
+//!\endcond
+
+/*!\brief The header of an index file written by seqan3::fm_index::store or seqan3::bi_fm_index::store.
+ *
+ * \details
+ *
+ * The layout of an index file is:
+ *
+ * | Field                 | Size                 |
+ * |-----------------------|----------------------|
+ * | magic `SEQAN3FM`      | 8 bytes              |
+ * | format version        | 4 bytes              |
+ * | bidirectional flag    | 1 byte               |
+ * | collection flag       | 1 byte               |
+ * | alphabet size         | 2 bytes              |
+ * | size of `size_type`   | 1 byte               |
+ * | traits version        | 1 byte               |
+ * | reserved              | 2 bytes              |
+ * | traits of the index   | 12 bytes             |
+ * | traits of the reverse | 12 bytes             |
+ * | SDSL data             | rest of the file     |
+ *
+ * The traits of an index are its rank structure (1 byte, seqan3::detail::fm_index_rank_structure), its text layout
+ * (1 byte, seqan3::detail::fm_index_text_layout), 2 reserved bytes and its SA and ISA sampling rates (4 bytes each).
+ * The traits of the reverse index are zero unless the file contains a seqan3::bi_fm_index. The traits version
+ * numbers the identifiers of the traits and is increased if their meaning changes.
+ *
+ * All numbers are stored in the byte order of the machine that wrote the file; a file written on a machine with a
+ * different byte order is rejected because the format version does not match. The SDSL data is the output of the
+ * `serialize` member functions of the SDSL data structures in the order in which the index stores them.
+ */
+struct fm_index_file_header
+{
+    //!\brief The magic bytes at the begin of every index file.
+    static constexpr std::array<char, 8> magic{{'S', 'E', 'Q', 'A', 'N', '3', 'F', 'M'}};
+    //!\brief The current version of the on-disk layout.
+    static constexpr uint32_t version{4};
+    //!\brief The current version of the identifiers in seqan3::detail::fm_index_file_traits.
+    static constexpr uint8_t traits_version{1};
+
+    //!\brief Whether the file contains a bidirectional index.
+    uint8_t is_bidirectional{};
+    //!\brief Whether the index was built over a text collection.
+    uint8_t is_collection{};
+    //!\brief The alphabet size of the indexed text.
+    uint16_t alphabet_size{};
+    //!\brief The size of the index's `size_type` in bytes.
+    uint8_t size_type_bytes{};
+    //!\brief The traits of the (forward) index.
+    fm_index_file_traits traits{};
+    //!\brief The traits of the reverse index of a seqan3::bi_fm_index.
+    fm_index_file_traits rev_traits{};
+
+    //!\brief Writes the header to the stream.
+    void write(std::ostream & out) const
+    {
+        std::array<char, 2> const reserved{};
+
+        out.write(magic.data(), magic.size());
+        out.write(reinterpret_cast<char const *>(&version), sizeof(version));
+        out.write(reinterpret_cast<char const *>(&is_bidirectional), sizeof(is_bidirectional));
+        out.write(reinterpret_cast<char const *>(&is_collection), sizeof(is_collection));
+        out.write(reinterpret_cast<char const *>(&alphabet_size), sizeof(alphabet_size));
+        out.write(reinterpret_cast<char const *>(&size_type_bytes), sizeof(size_type_bytes));
+        out.write(reinterpret_cast<char const *>(&traits_version), sizeof(traits_version));
+        out.write(reserved.data(), reserved.size());
+        write_traits(out, traits);
+        write_traits(out, rev_traits);
+    }
+
+    /*!\brief Reads a header from the stream and checks that it describes the same kind of index as this header.
+     * \param[in] in The stream to read from; positioned at the begin of the SDSL data afterwards.
+     * \throws seqan3::parse_error if the stream does not start with a matching header.
+     */
+    void read_and_check(std::istream & in) const
+    {
+        std::array<char, 8> file_magic{};
+        uint32_t file_version{};
+        uint8_t file_traits_version{};
+        fm_index_file_header file_header{};
+        std::array<char, 2> reserved{};
+
+        in.read(file_magic.data(), file_magic.size());
+        in.read(reinterpret_cast<char *>(&file_version), sizeof(file_version));
+        in.read(reinterpret_cast<char *>(&file_header.is_bidirectional), sizeof(file_header.is_bidirectional));
+        in.read(reinterpret_cast<char *>(&file_header.is_collection), sizeof(file_header.is_collection));
+        in.read(reinterpret_cast<char *>(&file_header.alphabet_size), sizeof(file_header.alphabet_size));
+        in.read(reinterpret_cast<char *>(&file_header.size_type_bytes), sizeof(file_header.size_type_bytes));
+        in.read(reinterpret_cast<char *>(&file_traits_version), sizeof(file_traits_version));
+        in.read(reserved.data(), reserved.size());
+        read_traits(in, file_header.traits);
+        read_traits(in, file_header.rev_traits);
+
+        if (!in || file_magic != magic)
+            throw parse_error{"The file is not an index file written by seqan3."};
+        if (file_version != version)
+            throw parse_error{"The index file has version " + std::to_string(file_version) + " but version " +
+                              std::to_string(version) + " is expected."};
+        if (file_traits_version != traits_version)
+            throw parse_error{"The index file has traits version " + std::to_string(file_traits_version) +
+                              " but version " + std::to_string(traits_version) + " is expected."};
+        if (file_header.is_bidirectional != is_bidirectional)
+            throw parse_error{is_bidirectional ? "The index file does not contain a bidirectional index."
+                                               : "The index file contains a bidirectional index."};
+        if (file_header.is_collection != is_collection)
+            throw parse_error{is_collection ? "The index file does not contain an index over a text collection."
+                                            : "The index file contains an index over a text collection."};
+        if (file_header.alphabet_size != alphabet_size || file_header.size_type_bytes != size_type_bytes)
+            throw parse_error{"The alphabet or the size type of the index file does not match the index type."};
+        check_traits(file_header.traits, traits, "");
+        check_traits(file_header.rev_traits, rev_traits, " of the reverse index");
+    }
+
+private:
+    //!\brief Writes the traits of an index to the stream.
+    static void write_traits(std::ostream & out, fm_index_file_traits const & index_traits)
+    {
+        std::array<char, 2> const reserved{};
+
+        out.write(reinterpret_cast<char const *>(&index_traits.rank_structure), sizeof(index_traits.rank_structure));
+        out.write(reinterpret_cast<char const *>(&index_traits.text_layout), sizeof(index_traits.text_layout));
+        out.write(reserved.data(), reserved.size());
+        out.write(reinterpret_cast<char const *>(&index_traits.sa_sampling_rate),
+                  sizeof(index_traits.sa_sampling_rate));
+        out.write(reinterpret_cast<char const *>(&index_traits.isa_sampling_rate),
+                  sizeof(index_traits.isa_sampling_rate));
+    }
+
+    //!\brief Reads the traits of an index from the stream.
+    static void read_traits(std::istream & in, fm_index_file_traits & index_traits)
+    {
+        std::array<char, 2> reserved{};
+
+        in.read(reinterpret_cast<char *>(&index_traits.rank_structure), sizeof(index_traits.rank_structure));
+        in.read(reinterpret_cast<char *>(&index_traits.text_layout), sizeof(index_traits.text_layout));
+        in.read(reserved.data(), reserved.size());
+        in.read(reinterpret_cast<char *>(&index_traits.sa_sampling_rate), sizeof(index_traits.sa_sampling_rate));
+        in.read(reinterpret_cast<char *>(&index_traits.isa_sampling_rate), sizeof(index_traits.isa_sampling_rate));
+    }
+
+    /*!\brief Checks that the traits read from a file match the expected traits.
+     * \param[in] file_traits The traits read from the file.
+     * \param[in] expected    The traits of the index type.
+     * \param[in] which       Names the index in the error message; empty for the (forward) index.
+     * \throws seqan3::parse_error if the traits differ.
+     */
+    static void check_traits(fm_index_file_traits const & file_traits,
+                             fm_index_file_traits const & expected,
+                             std::string const & which)
+    {
+        if (file_traits.rank_structure != expected.rank_structure)
+            throw parse_error{"The index file has the rank structure " +
+                              std::to_string(static_cast<unsigned>(file_traits.rank_structure)) + which + " but " +
+                              std::to_string(static_cast<unsigned>(expected.rank_structure)) + " is expected."};
+        if (file_traits.text_layout != expected.text_layout)
+            throw parse_error{"The index file has the text layout " +
+                              std::to_string(static_cast<unsigned>(file_traits.text_layout)) + which + " but " +
+                              std::to_string(static_cast<unsigned>(expected.text_layout)) + " is expected."};
+        if (file_traits.sa_sampling_rate != expected.sa_sampling_rate ||
+            file_traits.isa_sampling_rate != expected.isa_sampling_rate)
+            throw parse_error{"The index file has the sampling rates " + std::to_string(file_traits.sa_sampling_rate) +
+                              " (SA) and " + std::to_string(file_traits.isa_sampling_rate) + " (ISA)" + which +
+                              " but " + std::to_string(expected.sa_sampling_rate) + " and " +
+                              std::to_string(expected.isa_sampling_rate) + " are expected."};
+    }
+};
+
+//!\}
+
+} // namespace seqan3::detail
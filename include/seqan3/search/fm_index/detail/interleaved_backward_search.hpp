@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::interleaved_backward_search.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <seqan3/range/view/slice.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief Searches many queries exactly in an FM index by advancing a group of them in turns.
+ * \tparam cursor_t The type of the cursor; must be a seqan3::fm_index_cursor or a seqan3::bi_fm_index_cursor.
+ *
+ * \details
+ *
+ * Every character of a query is a backward search step whose rank queries depend on the interval of the previous
+ * step, i.e. searching a single query is a chain of dependent cache misses. The searches of different queries are
+ * independent, though. Up to seqan3::detail::interleaved_backward_search::batch_size queries are therefore searched
+ * at the same time: each of them is extended by one character in turn, and after a query has been extended, the data
+ * of its next step is prefetched (if the rank dictionary of the index supports it, see
+ * sdsl::epr_dictionary::prefetch). By the time the query is extended again, the data has been loaded while the other
+ * queries were extended.
+ *
+ * The first characters of a query are looked up in the k-mer lookup table of the index if there is one
+ * (see seqan3::fm_index_construction_config::kmer_lookup_length).
+ */
+template <typename cursor_t>
+class interleaved_backward_search
+{
+public:
+    //!\brief The number of queries that are searched at the same time.
+    static constexpr size_t batch_size = 16;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    interleaved_backward_search() = delete;                                                //!< Deleted.
+    interleaved_backward_search(interleaved_backward_search const &) = default;             //!< Defaulted.
+    interleaved_backward_search(interleaved_backward_search &&) = default;                  //!< Defaulted.
+    interleaved_backward_search & operator=(interleaved_backward_search const &) = default; //!< Defaulted.
+    interleaved_backward_search & operator=(interleaved_backward_search &&) = default;      //!< Defaulted.
+    ~interleaved_backward_search() = default;                                               //!< Defaulted.
+
+    /*!\brief Constructs the search for an index.
+     * \param[in] _root A cursor pointing to the root of the index.
+     */
+    interleaved_backward_search(cursor_t const & _root) noexcept : root{_root}
+    {}
+    //!\}
+
+    /*!\brief Searches the queries and reports the cursors of the queries that occur in the text.
+     * \tparam queries_t  The type of the queries; must model std::ranges::ForwardRange over
+     *                    std::ranges::RandomAccessRange.
+     * \tparam callback_t The type of the callback; must model std::Invocable with `size_t` and `cursor_t const &`.
+     * \param[in] queries  The queries to search.
+     * \param[in] callback Invoked with the position of the query in `queries` and a cursor pointing to the query
+     *                     for every query that occurs in the text, in the order the searches finish.
+     */
+    template <std::ranges::ForwardRange queries_t, typename callback_t>
+    void operator()(queries_t && queries, callback_t && callback) const
+    {
+        std::array<search_state<std::ranges::iterator_t<queries_t>>, batch_size> states;
+
+        auto query_it = std::ranges::begin(queries);
+        auto const query_end = std::ranges::end(queries);
+        size_t query_id{0};
+
+        // Starts the search of the next query that does not finish with its first step; returns false if none is left.
+        auto start = [&] (auto & state) -> bool
+        {
+            for (; query_it != query_end; ++query_it, ++query_id)
+            {
+                auto && query = *query_it;
+                size_t const length = std::ranges::distance(query);
+
+                cursor_t cursor{root};
+                if (length == 0)
+                {
+                    callback(query_id, cursor);
+                    continue;
+                }
+
+                size_t const first_length = std::clamp<size_t>(root.lookup_length(), 1, length);
+                if (!cursor.extend_right(query | view::slice(0, first_length)))
+                    continue;
+
+                if (first_length == length)
+                {
+                    callback(query_id, cursor);
+                    continue;
+                }
+
+                cursor.prefetch_extension();
+                state = {cursor, query_it, query_id, first_length, length};
+                ++query_it;
+                ++query_id;
+                return true;
+            }
+            return false;
+        };
+
+        size_t active{0};
+        while (active < batch_size && start(states[active]))
+            ++active;
+
+        while (active > 0)
+        {
+            for (size_t i = 0; i < active;)
+            {
+                auto & state = states[i];
+                auto && query = *state.query;
+
+                if (state.cursor.extend_right(std::ranges::begin(query)[state.position]))
+                {
+                    if (++state.position < state.length)
+                    {
+                        state.cursor.prefetch_extension();
+                        ++i;
+                        continue;
+                    }
+
+                    callback(state.query_id, state.cursor);
+                }
+
+                // The search of this query is finished, continue with the next query or the last active one.
+                if (start(state))
+                {
+                    ++i;
+                }
+                else if (i < --active)
+                {
+                    state = states[active];
+                }
+            }
+        }
+    }
+
+private:
+    //!\brief The state of the search of a single query.
+    template <typename query_iterator_t>
+    struct search_state
+    {
+        //!\brief Points to the prefix of the query searched so far.
+        cursor_t cursor{};
+        //!\brief The query.
+        query_iterator_t query{};
+        //!\brief The position of the query in the range of queries.
+        size_t query_id{};
+        //!\brief The position of the next character to search.
+        size_t position{};
+        //!\brief The length of the query.
+        size_t length{};
+    };
+
+    //!\brief A cursor pointing to the root of the index.
+    cursor_t root;
+};
+
+//!\}
+
+} // namespace seqan3::detail
@@ -0,0 +1,271 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::kmer_lookup_table.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/io.hpp>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+
+namespace seqan3
+{
+// forward declaration
+template <typename index_t>
+class fm_index_cursor;
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// forward declaration
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(fm_index_cursor<index_t> const & cursor) noexcept;
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief Stores the suffix array interval of every k-mer up to a maximum length for an FM index.
+ * \tparam size_type The type of the suffix array positions.
+ *
+ * \details
+ *
+ * A cursor that starts at the root of the index looks up the interval of the first characters of a query instead of
+ * performing one backward search step per character. These are the steps that access the rank data structures at
+ * spread-out positions and therefore usually miss the cache.
+ *
+ * The table holds an entry for each of the \f$\sum_{i=1}^{k} \Sigma^i\f$ strings of length at most `k` over the
+ * alphabet of the indexed text. The entries of strings of the same length are ordered by the lexicographical rank of
+ * the string. Both bounds are bit-compressed to the width of the index size. The right bound is stored plus one, s.t.
+ * 0 marks strings that do not occur in the text.
+ */
+template <typename size_type>
+class kmer_lookup_table
+{
+public:
+    //!\brief The maximum number of entries of a table.
+    static constexpr uint64_t max_entries = 1ULL << 32;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_lookup_table() = default;                                      //!< Defaulted.
+    kmer_lookup_table(kmer_lookup_table const &) = default;             //!< Defaulted.
+    kmer_lookup_table(kmer_lookup_table &&) = default;                  //!< Defaulted.
+    kmer_lookup_table & operator=(kmer_lookup_table const &) = default; //!< Defaulted.
+    kmer_lookup_table & operator=(kmer_lookup_table &&) = default;      //!< Defaulted.
+    ~kmer_lookup_table() = default;                                     //!< Defaulted.
+    //!\}
+
+    /*!\brief Computes the table by traversing the implicit suffix tree of an index up to depth `length`.
+     * \tparam cursor_t     The type of the cursor; must be a seqan3::fm_index_cursor.
+     * \param[in] root      A cursor pointing to the root of the index.
+     * \param[in] length    The maximum length of the k-mers; 0 clears the table.
+     * \param[in] sigma     The size of the alphabet of the indexed text.
+     * \param[in] text_size The size of the index, i.e. the largest position that has to be stored.
+     * \throws std::invalid_argument if the table would have more than seqan3::detail::kmer_lookup_table::max_entries
+     *         entries.
+     */
+    template <typename cursor_t>
+    void construct(cursor_t const & root, uint8_t const length, uint64_t const sigma, size_type const text_size)
+    {
+        m_length = length;
+        m_sigma = sigma;
+        init_offsets();
+
+        uint8_t const width = sdsl::bits::hi(text_size) + 1;
+        m_lb = sdsl::int_vector<>(m_offsets.back(), 0, width);
+        m_end = sdsl::int_vector<>(m_offsets.back(), 0, width);
+
+        if (m_length > 0)
+            fill(root, 0, 0);
+    }
+
+    //!\brief Returns the maximum length of the k-mers in the table; 0 if there is no table.
+    uint8_t length() const noexcept
+    {
+        return m_length;
+    }
+
+    //!\brief Returns the size of the alphabet of the indexed text.
+    uint64_t sigma() const noexcept
+    {
+        return m_sigma;
+    }
+
+    /*!\brief Looks up the suffix array interval of a string given by its lexicographical rank.
+     * \param[in]  kmer        The rank of the string among all strings of length `kmer_length`, i.e.
+     *                         \f$\sum_{i} rank(s_i) \cdot \Sigma^{kmer\_length - 1 - i}\f$.
+     * \param[in]  kmer_length The length of the string; must be in `[1, length()]`.
+     * \param[out] lb          The left bound of the interval; only set if the string occurs in the text.
+     * \param[out] rb          The right bound of the interval (inclusive); only set if the string occurs in the text.
+     * \returns `true` if the string occurs in the text, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool lookup(uint64_t const kmer, uint8_t const kmer_length, size_type & lb, size_type & rb) const noexcept
+    {
+        assert(kmer_length > 0 && kmer_length <= m_length);
+
+        uint64_t const pos = m_offsets[kmer_length] + kmer;
+        size_type const end = m_end[pos];
+        if (end == 0) // empty interval
+            return false;
+
+        lb = m_lb[pos];
+        rb = end - 1;
+        return true;
+    }
+
+    /*!\brief Looks up the suffix array interval of a string.
+     * \tparam iterator_t      The type of the iterator; must model std::InputIterator.
+     * \param[in]  first       The begin of the string; the characters are converted with seqan3::to_rank.
+     * \param[in]  kmer_length The length of the string; must be in `[1, length()]`.
+     * \param[out] lb          The left bound of the interval; only set if the string occurs in the text.
+     * \param[out] rb          The right bound of the interval (inclusive); only set if the string occurs in the text.
+     * \returns `true` if the string occurs in the text, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Linear in `kmer_length` with a single access to the table.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <typename iterator_t>
+    bool lookup(iterator_t first, uint8_t const kmer_length, size_type & lb, size_type & rb) const noexcept
+    {
+        uint64_t kmer{0};
+        for (uint8_t i = 0; i < kmer_length; ++i, ++first)
+            kmer = kmer * m_sigma + seqan3::to_rank(*first);
+
+        return lookup(kmer, kmer_length, lb, rb);
+    }
+
+    //!\brief Compares two tables.
+    bool operator==(kmer_lookup_table const & rhs) const noexcept
+    {
+        return m_length == rhs.m_length && m_sigma == rhs.m_sigma && m_lb == rhs.m_lb && m_end == rhs.m_end;
+    }
+
+    //!\brief Compares two tables.
+    bool operator!=(kmer_lookup_table const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    //!\brief Writes the table to the stream.
+    void serialize(std::ostream & out) const
+    {
+        sdsl::write_member(m_length, out);
+        sdsl::write_member(m_sigma, out);
+        m_lb.serialize(out);
+        m_end.serialize(out);
+    }
+
+    //!\brief Reads the table from the stream.
+    void load(std::istream & in)
+    {
+        sdsl::read_member(m_length, in);
+        sdsl::read_member(m_sigma, in);
+        m_lb.load(in);
+        m_end.load(in);
+        init_offsets();
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(m_length, m_sigma, m_lb, m_end);
+        init_offsets();
+    }
+    //!\endcond
+
+private:
+    //!\brief The maximum length of the k-mers.
+    uint8_t m_length{0};
+    //!\brief The size of the alphabet of the indexed text.
+    uint64_t m_sigma{0};
+    //!\brief The position of the first k-mer of length i is stored at position i; the number of entries at the end.
+    std::vector<uint64_t> m_offsets{0, 0};
+    //!\brief The left bounds of the suffix array intervals.
+    sdsl::int_vector<> m_lb{};
+    //!\brief The right bounds of the suffix array intervals plus one; 0 for strings that do not occur.
+    sdsl::int_vector<> m_end{};
+
+    //!\brief Computes the positions of the first k-mer of every length.
+    void init_offsets()
+    {
+        m_offsets.assign(m_length + 2, 0);
+
+        uint64_t kmers_of_length{1};
+        for (uint8_t i = 1; i <= m_length; ++i)
+        {
+            if (kmers_of_length > max_entries / m_sigma)
+                throw std::invalid_argument{"The k-mer lookup table would have more than 2^32 entries."};
+
+            kmers_of_length *= m_sigma;
+            m_offsets[i + 1] = m_offsets[i] + kmers_of_length;
+
+            if (m_offsets[i + 1] > max_entries)
+                throw std::invalid_argument{"The k-mer lookup table would have more than 2^32 entries."};
+        }
+    }
+
+    //!\brief Stores the intervals of all children of `cur` and descends into them until depth m_length is reached.
+    template <typename cursor_t>
+    void fill(cursor_t cur, uint64_t const prefix, uint8_t const prefix_length)
+    {
+        if (!cur.extend_right())
+            return;
+
+        do
+        {
+            uint64_t const kmer = prefix * m_sigma + seqan3::to_rank(cur.last_char());
+            uint64_t const pos = m_offsets[prefix_length + 1] + kmer;
+            auto const [lb, rb] = get_suffix_array_range(cur);
+
+            m_lb[pos] = lb;
+            m_end[pos] = rb + 1;
+
+            if (prefix_length + 1 < m_length)
+                fill(cur, kmer, prefix_length + 1);
+        } while (cur.cycle_back());
+    }
+};
+
+//!\}
+
+} // namespace seqan3::detail
@@ -0,0 +1,429 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::run_length_bwt, the run-length compressed BWT underlying seqan3::r_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <sdsl/bits.hpp>
+#include <sdsl/construct.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/sd_vector.hpp>
+#include <sdsl/wavelet_trees.hpp>
+
+#include <seqan3/core/concept/cereal.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief A run-length compressed Burrows-Wheeler transform with the suffix array samples of the r-index.
+ *
+ * \details
+ *
+ * The BWT of a byte text with \f$n\f$ characters is partitioned into \f$r\f$ maximal runs of equal characters. The
+ * data structure stores
+ *
+ *   * the character of every run (the *heads*) in a wavelet tree,
+ *   * the begin positions of the runs in the BWT in a sparse bit vector,
+ *   * the LF mapping of the first character of every run, ordered by character, in a sparse bit vector,
+ *   * the suffix array value at the end of every run, and
+ *   * the suffix array values at the begin of every run in a sparse bit vector together with the suffix array value
+ *     in front of each of them in the BWT order.
+ *
+ * All of them occupy \f$O(r)\f$ words. The number of characters smaller than a character is stored for all 256
+ * characters.
+ *
+ * A backward search step is answered with lf(), which maps a rank query on the BWT to a rank query on the heads.
+ * The suffix array value at the right bound of an interval, the *toehold*, is maintained during the backward search
+ * with toehold(). Starting from the toehold, phi() yields the suffix array value in front of a position in the BWT
+ * order, i.e. all values of an interval are computed without suffix array samples at regular distances.
+ * See Gagie, Navarro and Prezza, "Fully Functional Suffix Trees and Optimal Text Searching in BWT-Runs Bounded Space"
+ * (J. ACM 67, 2020).
+ */
+class run_length_bwt
+{
+public:
+    //!\brief Type for representing positions in the BWT and in the text.
+    using size_type = typename sdsl::int_vector<>::size_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The rank and select supports are bound to the bit vectors of the object they belong to.
+     * \{
+     */
+    run_length_bwt() = default; //!< Default constructor.
+
+    //!\brief Copy constructor.
+    run_length_bwt(run_length_bwt const & other) :
+        m_size{other.m_size}, C{other.C}, run_C{other.run_C}, heads{other.heads},
+        run_begin{other.run_begin}, run_begin_rs{other.run_begin_rs}, run_begin_ss{other.run_begin_ss},
+        head_lf{other.head_lf}, head_lf_ss{other.head_lf_ss}, sa_run_end{other.sa_run_end},
+        phi_key{other.phi_key}, phi_key_rs{other.phi_key_rs}, phi_key_ss{other.phi_key_ss},
+        phi_value{other.phi_value}
+    {
+        bind_supports();
+    }
+
+    //!\brief Move constructor.
+    run_length_bwt(run_length_bwt && other) noexcept :
+        m_size{other.m_size}, C{std::move(other.C)}, run_C{std::move(other.run_C)}, heads{std::move(other.heads)},
+        run_begin{std::move(other.run_begin)}, run_begin_rs{std::move(other.run_begin_rs)},
+        run_begin_ss{std::move(other.run_begin_ss)}, head_lf{std::move(other.head_lf)},
+        head_lf_ss{std::move(other.head_lf_ss)}, sa_run_end{std::move(other.sa_run_end)},
+        phi_key{std::move(other.phi_key)}, phi_key_rs{std::move(other.phi_key_rs)},
+        phi_key_ss{std::move(other.phi_key_ss)}, phi_value{std::move(other.phi_value)}
+    {
+        bind_supports();
+    }
+
+    //!\brief Copy assignment.
+    run_length_bwt & operator=(run_length_bwt const & other)
+    {
+        if (this != &other)
+            *this = run_length_bwt{other};
+        return *this;
+    }
+
+    //!\brief Move assignment.
+    run_length_bwt & operator=(run_length_bwt && other) noexcept
+    {
+        m_size = other.m_size;
+        C = std::move(other.C);
+        run_C = std::move(other.run_C);
+        heads = std::move(other.heads);
+        run_begin = std::move(other.run_begin);
+        run_begin_rs = std::move(other.run_begin_rs);
+        run_begin_ss = std::move(other.run_begin_ss);
+        head_lf = std::move(other.head_lf);
+        head_lf_ss = std::move(other.head_lf_ss);
+        sa_run_end = std::move(other.sa_run_end);
+        phi_key = std::move(other.phi_key);
+        phi_key_rs = std::move(other.phi_key_rs);
+        phi_key_ss = std::move(other.phi_key_ss);
+        phi_value = std::move(other.phi_value);
+        bind_supports();
+        return *this;
+    }
+
+    ~run_length_bwt() = default; //!< Destructor.
+    //!\}
+
+    /*!\brief Constructs the data structure from the BWT and the suffix array of a text.
+     * \tparam bwt_t The type of the BWT; must support `size()` and `operator[]` returning the byte at a position.
+     * \tparam sa_t  The type of the suffix array; must support `operator[]` returning the value at a position.
+     * \param[in] bwt The BWT of the text; must not be empty.
+     * \param[in] sa  The suffix array of the text.
+     *
+     * \details
+     *
+     * Both are read once from front to back, i.e. they may be `sdsl::int_vector_buffer`s streaming from files.
+     * Besides the result, the construction holds \f$O(r)\f$ words and two bit vectors of \f$n\f$ bits.
+     */
+    template <typename bwt_t, typename sa_t>
+    void construct(bwt_t & bwt, sa_t & sa)
+    {
+        m_size = bwt.size();
+        assert(m_size > 0);
+
+        // A single pass collects the runs and the suffix array values at their bounds.
+        std::vector<uint8_t> run_heads{};
+        std::vector<size_type> run_positions{};
+        std::vector<size_type> run_end_values{};
+        std::vector<std::pair<size_type, size_type>> phi_samples{}; // value at the run begin and the one in front
+        std::array<size_type, 256> counts{};
+        size_type previous_value{0};
+        for (size_type i = 0; i < m_size; ++i)
+        {
+            uint8_t const c = bwt[i];
+            size_type const value = sa[i];
+            if (i == 0 || c != run_heads.back())
+            {
+                if (i > 0)
+                    run_end_values.push_back(previous_value);
+                run_heads.push_back(c);
+                run_positions.push_back(i);
+                phi_samples.emplace_back(value, previous_value); // the value in front of the first run is unused
+            }
+            ++counts[c];
+            previous_value = value;
+        }
+        run_end_values.push_back(previous_value);
+
+        size_type const run_count = run_heads.size();
+        uint8_t const value_width = sdsl::bits::hi(m_size) + 1;
+
+        C = sdsl::int_vector<64>(257, 0);
+        run_C = sdsl::int_vector<64>(257, 0);
+        for (size_type j = 0; j < run_count; ++j)
+            ++run_C[run_heads[j] + 1];
+        for (size_t c = 0; c < 256; ++c)
+        {
+            C[c + 1] = C[c] + counts[c];
+            run_C[c + 1] += run_C[c];
+        }
+
+        {
+            sdsl::int_vector<8> head_vector(run_count);
+            std::copy(run_heads.begin(), run_heads.end(), head_vector.begin());
+            sdsl::construct_im(heads, head_vector, 0);
+        }
+
+        {
+            sdsl::bit_vector begin_bits(m_size, 0);
+            sdsl::bit_vector head_lf_bits(m_size, 0);
+            std::array<size_type, 256> seen{};
+            for (size_type j = 0; j < run_count; ++j)
+            {
+                uint8_t const c = run_heads[j];
+                size_type const run_end = (j + 1 < run_count) ? run_positions[j + 1] : m_size;
+                begin_bits[run_positions[j]] = 1;
+                head_lf_bits[C[c] + seen[c]] = 1; // the LF mapping of the first character of the run
+                seen[c] += run_end - run_positions[j];
+            }
+            run_begin = sdsl::sd_vector<>(begin_bits);
+            head_lf = sdsl::sd_vector<>(head_lf_bits);
+        }
+
+        sa_run_end = sdsl::int_vector<>(run_count, 0, value_width);
+        std::copy(run_end_values.begin(), run_end_values.end(), sa_run_end.begin());
+
+        std::sort(phi_samples.begin(), phi_samples.end());
+        {
+            sdsl::bit_vector key_bits(m_size, 0);
+            for (auto const & [key, value] : phi_samples)
+                key_bits[key] = 1;
+            phi_key = sdsl::sd_vector<>(key_bits);
+        }
+        phi_value = sdsl::int_vector<>(run_count, 0, value_width);
+        for (size_type q = 0; q < run_count; ++q)
+            phi_value[q] = phi_samples[q].second;
+
+        run_begin_rs = sdsl::rank_support_sd<1>(&run_begin);
+        run_begin_ss = sdsl::select_support_sd<1>(&run_begin);
+        head_lf_ss = sdsl::select_support_sd<1>(&head_lf);
+        phi_key_rs = sdsl::rank_support_sd<1>(&phi_key);
+        phi_key_ss = sdsl::select_support_sd<1>(&phi_key);
+    }
+
+    //!\brief Returns the length of the BWT.
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    //!\brief Returns the number of runs of the BWT.
+    size_type runs() const noexcept
+    {
+        return sa_run_end.size();
+    }
+
+    //!\brief Returns the number of characters in the BWT that are smaller than `c`.
+    size_type smaller(uint8_t const c) const noexcept
+    {
+        return C[c];
+    }
+
+    //!\brief Returns the number of occurrences of `c` in the BWT.
+    size_type occurrences(uint8_t const c) const noexcept
+    {
+        return C[c + 1] - C[c];
+    }
+
+    //!\brief Returns the character at position `i` of the BWT.
+    uint8_t operator[](size_type const i) const noexcept
+    {
+        assert(i < m_size);
+        return heads[run_of(i)];
+    }
+
+    /*!\brief Returns the number of characters in the BWT that are smaller than `c` plus the occurrences of `c` in
+     *        front of position `i`, i.e. the LF mapping of the next occurrence of `c` at or behind `i`.
+     * \param[in] i The number of characters of the BWT to consider; must not be larger than size().
+     * \param[in] c The character.
+     *
+     * ### Complexity
+     *
+     * \f$O(\log \Sigma + \log \frac{n}{r})\f$
+     */
+    size_type lf(size_type const i, uint8_t const c) const noexcept
+    {
+        assert(i <= m_size);
+
+        if (i == 0)
+            return C[c];
+
+        size_type const j = run_of(i - 1);
+        auto const [rank, head] = heads.inverse_select(j);
+        if (head == c) // i - 1 lies in the run of c with the index `rank`
+            return head_lf_of(c, rank) + i - run_begin_ss.select(j + 1);
+
+        return head_lf_of(c, heads.rank(j, c));
+    }
+
+    /*!\brief Returns the suffix array value at the right bound of the interval that results from a backward search
+     *        step.
+     * \param[in] rb      The right bound of the interval before the step.
+     * \param[in] toehold The suffix array value at `rb`.
+     * \param[in] c       The character of the step; must occur in the interval.
+     *
+     * \details
+     *
+     * The new right bound is the LF mapping of the last occurrence of `c` in the interval. If it is `rb`, its suffix
+     * array value is the one of `rb` minus one. Otherwise it is the end of the last run of `c` in front of `rb`,
+     * whose suffix array value is stored.
+     *
+     * ### Complexity
+     *
+     * \f$O(\log \Sigma + \log \frac{n}{r})\f$
+     */
+    size_type toehold(size_type const rb, size_type const toehold, uint8_t const c) const noexcept
+    {
+        size_type const j = run_of(rb);
+        if (heads[j] == c)
+            return toehold - 1;
+
+        size_type const last_run = heads.select(heads.rank(j, c), c);
+        return sa_run_end[last_run] - 1;
+    }
+
+    //!\brief Returns the suffix array value at the last position of the BWT.
+    size_type last_value() const noexcept
+    {
+        return sa_run_end[runs() - 1];
+    }
+
+    /*!\brief Returns the suffix array value in front of the position with the suffix array value `value`.
+     * \param[in] value A suffix array value at a position greater than 0.
+     *
+     * \details
+     *
+     * Inside a run, the text positions in front of two consecutive suffixes are consecutive suffixes again. Hence,
+     * the result differs from the one of the largest sampled run begin value not greater than `value` by the distance
+     * of the two values.
+     *
+     * ### Complexity
+     *
+     * \f$O(\log \frac{n}{r})\f$
+     */
+    size_type phi(size_type const value) const noexcept
+    {
+        assert(value < m_size);
+
+        size_type const q = phi_key_rs.rank(value + 1);
+        return phi_value[q - 1] + value - phi_key_ss.select(q);
+    }
+
+    //!\brief Compares two objects.
+    bool operator==(run_length_bwt const & rhs) const noexcept
+    {
+        return m_size == rhs.m_size && C == rhs.C && heads == rhs.heads && run_begin == rhs.run_begin &&
+               sa_run_end == rhs.sa_run_end && phi_key == rhs.phi_key && phi_value == rhs.phi_value;
+    }
+
+    //!\brief Compares two objects.
+    bool operator!=(run_length_bwt const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(m_size);
+        archive(C);
+        archive(run_C);
+        archive(heads);
+        archive(run_begin);
+        archive(run_begin_rs);
+        archive(run_begin_ss);
+        archive(head_lf);
+        archive(head_lf_ss);
+        archive(sa_run_end);
+        archive(phi_key);
+        archive(phi_key_rs);
+        archive(phi_key_ss);
+        archive(phi_value);
+        bind_supports();
+    }
+    //!\endcond
+
+private:
+    //!\brief Binds the rank and select supports to the bit vectors of this object.
+    void bind_supports() noexcept
+    {
+        run_begin_rs.set_vector(&run_begin);
+        run_begin_ss.set_vector(&run_begin);
+        head_lf_ss.set_vector(&head_lf);
+        phi_key_rs.set_vector(&phi_key);
+        phi_key_ss.set_vector(&phi_key);
+    }
+
+    //!\brief Returns the index of the run containing position `i` of the BWT.
+    size_type run_of(size_type const i) const noexcept
+    {
+        return run_begin_rs.rank(i + 1) - 1;
+    }
+
+    //!\brief Returns the LF mapping of the first character of the `k`-th run of `c`, or the number of characters not
+    //!       greater than `c` if `c` has at most `k` runs.
+    size_type head_lf_of(uint8_t const c, size_type const k) const noexcept
+    {
+        return (run_C[c] + k < run_C[c + 1]) ? head_lf_ss.select(run_C[c] + k + 1) : C[c + 1];
+    }
+
+    //!\brief The length of the BWT.
+    size_type m_size{0};
+    //!\brief The number of characters in the BWT that are smaller than a character.
+    sdsl::int_vector<64> C{};
+    //!\brief The number of runs whose character is smaller than a character.
+    sdsl::int_vector<64> run_C{};
+    //!\brief The character of every run.
+    sdsl::wt_huff<> heads{};
+    //!\brief Marks the first position of every run in the BWT.
+    sdsl::sd_vector<> run_begin{};
+    //!\brief Rank support for run_begin.
+    sdsl::rank_support_sd<1> run_begin_rs{};
+    //!\brief Select support for run_begin.
+    sdsl::select_support_sd<1> run_begin_ss{};
+    //!\brief Marks the LF mapping of the first character of every run.
+    sdsl::sd_vector<> head_lf{};
+    //!\brief Select support for head_lf.
+    sdsl::select_support_sd<1> head_lf_ss{};
+    //!\brief The suffix array value at the last position of every run.
+    sdsl::int_vector<> sa_run_end{};
+    //!\brief Marks the suffix array value at the first position of every run.
+    sdsl::sd_vector<> phi_key{};
+    //!\brief Rank support for phi_key.
+    sdsl::rank_support_sd<1> phi_key_rs{};
+    //!\brief Select support for phi_key.
+    sdsl::select_support_sd<1> phi_key_ss{};
+    //!\brief The suffix array value in front of every value marked in phi_key, in the order of phi_key.
+    sdsl::int_vector<> phi_value{};
+};
+
+//!\}
+
+} // namespace seqan3::detail
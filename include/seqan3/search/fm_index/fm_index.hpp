@@ -12,6 +12,13 @@
 
 #pragma once
 
+#include <array>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
 #include <sdsl/suffix_trees.hpp>
 
 #include <seqan3/core/metafunction/range.hpp>
@@ -20,7 +27,13 @@
 #include <seqan3/range/view/to_rank.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
+#include <seqan3/search/fm_index/detail/epr_dictionary.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_construction.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_file.hpp>
+#include <seqan3/search/fm_index/detail/interleaved_backward_search.hpp>
+#include <seqan3/search/fm_index/detail/kmer_lookup_table.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_config.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
@@ -89,6 +102,80 @@ struct fm_index_default_traits
     >;
 };
 
+/*!\brief An FM Index Configuration with a custom suffix array sampling rate.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th suffix array value is stored; must be at least 1.
+ *
+ * \details
+ *
+ * Same as seqan3::fm_index_default_traits but trades memory for the running time of locating occurrences: every
+ * occurrence is located with at most `sa_sampling_rate - 1` LF mapping steps and the samples occupy
+ * \f$n \log n / SAMPLING\_RATE\f$ bits.
+ *
+ * ### Running time / Space consumption
+ *
+ * \f$SAMPLING\_RATE = sa\_sampling\_rate\f$
+ *
+ * \f$T_{LOCATE}: O(SAMPLING\_RATE \cdot T_{BACKWARD\_SEARCH})\f$
+ */
+template <uint32_t sa_sampling_rate>
+//!\cond
+    requires sa_sampling_rate >= 1
+//!\endcond
+struct fm_index_sampling_traits
+{
+    //!\brief Type of the underlying SDSL index.
+    using sdsl_index_type = sdsl::csa_wt<
+        sdsl::wt_blcd<
+            sdsl::bit_vector,
+            sdsl::rank_support_v<>,
+            sdsl::select_support_scan<>,
+            sdsl::select_support_scan<0>
+        >,
+        sa_sampling_rate,
+        10000000,
+        sdsl::sa_order_sa_sampling<>,
+        sdsl::isa_sampling<>,
+        sdsl::plain_byte_alphabet
+    >;
+};
+
+/*!\brief An FM Index Configuration for small alphabets that uses an EPR dictionary instead of a wavelet tree.
+ * \tparam alphabet_t       The alphabet of the indexed text; must have at most 6 characters (e.g. seqan3::dna4 or
+ *                          seqan3::dna5).
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th suffix array value is stored, see
+ *                          seqan3::fm_index_sampling_traits; must be at least 1.
+ *
+ * \details
+ *
+ * The sdsl::epr_dictionary interleaves the occurrence counts of all characters with the bit-packed BWT in cache lines,
+ * s.t. a backward search step costs a single cache miss per interval border. Besides the sentinel and the delimiter
+ * of text collections, the dictionary holds `alphabet_size + 2` symbols.
+ *
+ * ### Running time / Space consumption
+ *
+ * \f$SAMPLING\_RATE = sa\_sampling\_rate\f$
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(1)\f$
+ *
+ * The EPR dictionary needs 8 bits per character of the text, which is about twice as much as the default wavelet tree.
+ */
+template <Alphabet alphabet_t, uint32_t sa_sampling_rate = 16>
+//!\cond
+    requires alphabet_size_v<alphabet_t> <= 6 && sa_sampling_rate >= 1
+//!\endcond
+struct fm_index_epr_traits
+{
+    //!\brief Type of the underlying SDSL index.
+    using sdsl_index_type = sdsl::csa_wt<
+        sdsl::epr_dictionary<alphabet_size_v<alphabet_t> + 2>,
+        sa_sampling_rate,
+        10000000,
+        sdsl::sa_order_sa_sampling<>,
+        sdsl::isa_sampling<>,
+        sdsl::plain_byte_alphabet
+    >;
+};
+
 /*!\brief The SeqAn FM Index.
  * \implements seqan3::FmIndex
  * \tparam text_t The type of the text to be indexed; must model std::ranges::ForwardRange.
@@ -154,6 +241,9 @@ protected:
     //!\brief Rank support for text_begin.
     sdsl::rank_support_sd<1> text_begin_rs;
 
+    //!\brief Suffix array intervals of short strings, see seqan3::fm_index_construction_config::kmer_lookup_length.
+    detail::kmer_lookup_table<typename sdsl_index_type::size_type> kmer_table;
+
 public:
     /*!\name Member types
      * \{
@@ -197,30 +287,36 @@ public:
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config.
      *
      * ### Complexity
      *
      * \todo At least linear.
      */
-    fm_index(text_t const & text)
+    fm_index(text_t const & text, fm_index_construction_config const & config = {})
     {
-        construct(text);
+        construct(text, config);
     }
 
     //!\overload
-    fm_index(text_t &&) = delete;
+    fm_index(text_t &&, fm_index_construction_config const & = {}) = delete;
 
     //!\overload
-    fm_index(text_t const &&) = delete;
+    fm_index(text_t const &&, fm_index_construction_config const & = {}) = delete;
     //!\}
 
     /*!\brief Constructs the index given a range.
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config.
      *
-     * \details \todo This has to be better implemented with regard to the memory peak due to not matching interfaces
-     *                with the SDSL.
+     * \details The text is read character by character (from back to front), i.e. a text stored in a compact
+     *          container, e.g. a seqan3::bitcompressed_vector or a seqan3::concatenated_sequences thereof, is not
+     *          unpacked into an intermediate copy. If the construction exceeds the memory budget of `config`, the
+     *          intermediate data structures are kept in temporary files instead of main memory. If `config` asks for
+     *          a k-mer lookup table, the suffix array intervals of all strings up to this length are computed
+     *          afterwards.
      *
      * ### Complexity
      *
@@ -230,7 +326,7 @@ public:
      *
      * No guarantees.
      */
-    void construct(text_t const & text)
+    void construct(text_t const & text, fm_index_construction_config const & config = {})
         //!\cond
         requires !is_collection
         //!\endcond
@@ -242,37 +338,37 @@ public:
         this->text = &text;
         // TODO:
         // * check what happens in sdsl when constructed twice!
-        // * choose between in-memory/external and construction algorithms
         // * sdsl construction currently only works for int_vector, std::string and char *, not ranges in general
         // uint8_t largest_char = 0;
-        sdsl::int_vector<8> tmp_text(text.size());
-
-        std::ranges::copy(text
-                          | view::to_rank
-                          | std::view::transform([] (uint8_t const r)
-                          {
-                              if constexpr (alphabet_size_v<char_type> == 256)
-                              {
-                                  if (r == 255)
-                                      throw std::out_of_range("The input text cannot be indexed, because for full"
-                                                              "character alphabets the last one/two values are reserved"
-                                                              "(single sequence/collection).");
-                              }
-                              return r + 1;
-                          })
-                          | std::view::reverse,
-                          seqan3::begin(tmp_text)); // reverse and increase rank by one
-
-        sdsl::construct_im(index, tmp_text, 0);
+        detail::construct_sdsl_index(index,
+                                     text
+                                     | view::to_rank
+                                     | std::view::transform([] (uint8_t const r)
+                                     {
+                                         if constexpr (alphabet_size_v<char_type> == 256)
+                                         {
+                                             if (r == 255)
+                                                 throw std::out_of_range("The input text cannot be indexed, because for"
+                                                                         " full character alphabets the last one/two "
+                                                                         "values are reserved (single sequence/"
+                                                                         "collection).");
+                                         }
+                                         return r + 1;
+                                     })
+                                     | std::view::reverse, // reverse and increase rank by one
+                                     std::ranges::size(text),
+                                     config);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
         // index.m_C.shrink_to_fit();
         // index.m_sigma = largest_char;
+
+        kmer_table.construct(begin(), config.kmer_lookup_length, alphabet_size_v<char_type>, size());
     }
 
     //!\overload
-    void construct(text_t const & text)
+    void construct(text_t const & text, fm_index_construction_config const & config = {})
         //!\cond
         requires is_collection
         //!\endcond
@@ -314,48 +410,42 @@ public:
         text_begin_ss = sdsl::select_support_sd<1>(&text_begin);
         text_begin_rs = sdsl::rank_support_sd<1>(&text_begin);
 
-        sdsl::int_vector<8> tmp_text(text_size - 1); // last text in collection needs no delimiter
-
         uint8_t delimiter = alphabet_size_v<char_type> >= 255 ? 255 : alphabet_size_v<char_type> + 1;
 
-        std::vector<uint8_t> tmp = text
-                                   | view::deep{view::to_rank}
-                                   | view::deep
-                                   {
-                                       std::view::transform([] (uint8_t const r)
-                                       {
-                                           if constexpr (alphabet_size_v<char_type> >= 255)
-                                           {
-                                               if (r >= 254)
-                                                   throw std::out_of_range("The input text cannot be indexed, because"
-                                                                           " for full character alphabets the last one/"
-                                                                           "two values are reserved (single sequence/"
-                                                                           "collection).");
-                                           }
-                                           return r + 1;
-                                       })
-                                   }
-                                   | std::view::join(delimiter);
-
-        std::ranges::copy((tmp | std::view::reverse), seqan3::begin(tmp_text));
-
-        //!\todo Replace with this once this does not cause debug builds to exceed max memory on travis
-        // std::ranges::copy(text
-        //                   | view::deep{view::to_rank}
-        //                   | view::deep{std::view::transform([] (uint8_t const r) { return r + 1; })} // increase rank
-        //                   | view::deep{std::view::reverse}
-        //                   | std::view::reverse
-        //                   | std::view::join(delimiter), // join with delimiter
-        //                   seqan3::begin(tmp_text));
-
-        sdsl::construct_im(index, tmp_text, 0);
+        // The texts are streamed back to front and each of them reversed, s.t. the packed texts are never copied.
+        // The last text in the collection needs no delimiter.
+        detail::construct_sdsl_index(index, [&text, delimiter] (sdsl::int_vector_buffer<8> & text_buffer)
+        {
+            bool is_last{true};
+            for (auto && t : text | std::view::reverse)
+            {
+                if (!is_last)
+                    text_buffer.push_back(delimiter);
+                is_last = false;
+
+                for (auto && c : t | std::view::reverse)
+                {
+                    uint8_t const r = seqan3::to_rank(c);
+                    if constexpr (alphabet_size_v<char_type> >= 255)
+                    {
+                        if (r >= 254)
+                            throw std::out_of_range("The input text cannot be indexed, because for full character "
+                                                    "alphabets the last one/two values are reserved (single "
+                                                    "sequence/collection).");
+                    }
+                    text_buffer.push_back(r + 1); // increase rank by one
+                }
+            }
+        }, text_size - 1, config);
+
+        kmer_table.construct(begin(), config.kmer_lookup_length, alphabet_size_v<char_type>, size());
     }
 
     //!\overload
-    void construct(text_t &&) = delete;
+    void construct(text_t &&, fm_index_construction_config const & = {}) = delete;
 
     //!\overload
-    void construct(text_t const &&) = delete;
+    void construct(text_t const &&, fm_index_construction_config const & = {}) = delete;
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
      * \returns Returns the length of the indexed text including sentinel characters.
@@ -389,6 +479,22 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the indexed text.
+     * \returns A pointer to the indexed text, or `nullptr` if the index has been loaded from a file.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    text_t const * indexed_text() const noexcept
+    {
+        return text;
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -403,7 +509,7 @@ public:
     bool operator==(fm_index const & rhs) const noexcept
     {
         // (void) rhs;
-        return (index == rhs.index) && (text_begin == rhs.text_begin);
+        return (index == rhs.index) && (text_begin == rhs.text_begin) && (kmer_table == rhs.kmer_table);
     }
 
     /*!\brief Compares two indices.
@@ -441,6 +547,141 @@ public:
         return {*this};
     }
 
+    /*!\brief Searches several queries exactly and reports the cursors of the queries that occur in the text.
+     * \tparam queries_t  The type of the queries; must model std::ranges::ForwardRange over
+     *                    std::ranges::RandomAccessRange over the index's alphabet.
+     * \tparam callback_t The type of the callback; must model std::Invocable with `size_t` and `cursor_type const &`.
+     * \param[in] queries  The queries to search.
+     * \param[in] callback Invoked with the position of the query in `queries` and a cursor pointing to the
+     *                     query for every query that occurs in the text.
+     *
+     * \details
+     *
+     * Searching a query character by character is bound by the latency of the memory accesses of each step, which
+     * depend on the previous step. This function searches a group of queries at the same time and extends them in
+     * turns, s.t. the memory accesses of different queries overlap. If the rank dictionary of the index supports it
+     * (e.g. seqan3::fm_index_epr_traits), the data of the next step of a query is prefetched before the other queries
+     * are extended. The first characters of a query are looked up in the k-mer lookup table if the index has one
+     * (see seqan3::fm_index_construction_config::kmer_lookup_length).
+     *
+     * The callback is invoked in the order the searches finish, which is not necessarily the order of the queries.
+     *
+     * ### Complexity
+     *
+     * \f$\sum_{i} |queries_i| * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee if invoking the callback throws; no-throw guarantee otherwise.
+     */
+    template <std::ranges::ForwardRange queries_t, typename callback_t>
+    //!\cond
+        requires std::ranges::RandomAccessRange<value_type_t<queries_t>> &&
+                 ImplicitlyConvertibleTo<innermost_value_type_t<queries_t>, char_type> &&
+                 std::Invocable<callback_t, size_t, cursor_type const &>
+    //!\endcond
+    void search_batch(queries_t && queries, callback_t && callback) const
+    {
+        detail::interleaved_backward_search<cursor_type>{begin()}(queries, callback);
+    }
+
+    /*!\brief Searches several queries exactly.
+     * \tparam queries_t The type of the queries; must model std::ranges::ForwardRange over
+     *                   std::ranges::RandomAccessRange over the index's alphabet.
+     * \param[in] queries The queries to search.
+     * \returns A std::vector with a cursor pointing to the i-th query at position i if the query occurs in the
+     *          text and `std::nullopt` otherwise.
+     *
+     * \details
+     *
+     * See search_batch(queries_t &&, callback_t &&) const.
+     *
+     * ### Complexity
+     *
+     * \f$\sum_{i} |queries_i| * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    template <std::ranges::ForwardRange queries_t>
+    //!\cond
+        requires std::ranges::RandomAccessRange<value_type_t<queries_t>> &&
+                 ImplicitlyConvertibleTo<innermost_value_type_t<queries_t>, char_type>
+    //!\endcond
+    std::vector<std::optional<cursor_type>> search_batch(queries_t && queries) const
+    {
+        std::vector<std::optional<cursor_type>> cursors(std::ranges::distance(queries));
+        search_batch(queries, [&cursors] (size_t const query_id, cursor_type const & cursor)
+        {
+            cursors[query_id] = cursor;
+        });
+        return cursors;
+    }
+
+    /*!\brief Stores the index in a file that can be loaded with seqan3::fm_index::load.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be written.
+     *
+     * \details
+     *
+     * The file consists of a seqan3::detail::fm_index_file_header followed by the SDSL data structures of the index
+     * and its k-mer lookup table. The indexed text is not stored.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        std::ofstream out{path, std::ios::binary};
+        if (!out.good())
+            throw file_open_error{"Could not open file " + path.string() + " for writing."};
+
+        file_header(false).write(out);
+        serialise_sdsl(out);
+
+        if (!out.good())
+            throw file_open_error{"Could not write the index to file " + path.string() + "."};
+    }
+
+    /*!\brief Loads an index from a file written by seqan3::fm_index::store.
+     * \param[in] path The path to the file.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::parse_error if the file does not contain an index of this type.
+     *
+     * \details
+     *
+     * The SDSL data structures are read with their own `load` member functions, i.e. without the overhead of a cereal
+     * archive, and are copied into memory owned by the index; the file is not memory-mapped, since the SDSL data
+     * structures cannot refer to foreign memory. A file written with different index traits, e.g. another sampling
+     * rate or rank dictionary, is rejected. As with deserialisation, the index does not refer to a text afterwards.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void load(std::filesystem::path const & path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in.good())
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        file_header(false).read_and_check(in);
+        deserialise_sdsl(in);
+
+        if (!in)
+            throw parse_error{"The index file " + path.string() + " is truncated."};
+    }
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
@@ -457,9 +698,175 @@ public:
         text_begin_ss.set_vector(&text_begin);
         archive(text_begin_rs);
         text_begin_rs.set_vector(&text_begin);
+        archive(kmer_table);
+    }
+
+    /*!\brief Returns the header of an index file describing this index type.
+     * \param[in] is_bidirectional Whether the file contains a seqan3::bi_fm_index.
+     */
+    static detail::fm_index_file_header file_header(bool const is_bidirectional) noexcept
+    {
+        static_assert(detail::fm_index_file_traits_v<sdsl_index_type>.is_supported(),
+                      "Only indices whose traits are listed in seqan3::detail::fm_index_file_traits can be stored.");
+
+        return {is_bidirectional, is_collection, alphabet_size_v<char_type>, sizeof(size_type),
+                detail::fm_index_file_traits_v<sdsl_index_type>};
+    }
+
+    //!\brief Writes the SDSL data structures to the stream; used by store().
+    void serialise_sdsl(std::ostream & out) const
+    {
+        index.serialize(out);
+        text_begin.serialize(out);
+        text_begin_ss.serialize(out);
+        text_begin_rs.serialize(out);
+        kmer_table.serialize(out);
+    }
+
+    //!\brief Reads the SDSL data structures from the stream; used by load().
+    void deserialise_sdsl(std::istream & in)
+    {
+        text = nullptr;
+        index.load(in);
+        text_begin.load(in);
+        text_begin_ss.load(in, &text_begin);
+        text_begin_rs.load(in, &text_begin);
+        kmer_table.load(in);
     }
     //!\endcond
 
+protected:
+    //!\privatesection
+
+    //!\brief The number of LF walks that locate() advances in lockstep.
+    static constexpr size_t locate_batch_size = 32;
+
+    //!\brief Indicates whether the rank dictionary of the SDSL index can prefetch the data of a rank query.
+    static constexpr bool has_prefetch =
+        detail::is_epr_dictionary_v<typename sdsl_index_type::wavelet_tree_type>;
+
+    /*!\brief Computes the suffix array values of a suffix array interval.
+     * \param[in]  lb    The left bound of the interval.
+     * \param[in]  count The size of the interval.
+     * \param[out] out   Points to `count` values that are set to the suffix array values of the interval.
+     *
+     * \details
+     *
+     * An unsampled suffix array value is resolved by walking the LF mapping until a sampled position is reached.
+     * Every step of a walk depends on the previous one, but the walks of different positions are independent.
+     * Up to seqan3::fm_index::locate_batch_size walks are therefore advanced in lockstep, s.t. their memory accesses
+     * overlap. If the rank dictionary supports it (see sdsl::epr_dictionary::prefetch), the data of the next step
+     * of a walk is prefetched before the other walks are advanced.
+     */
+    void locate_sa_interval(size_type const lb, size_type const count, size_type * const out) const noexcept
+    {
+        std::array<size_type, locate_batch_size> sa_pos;
+        std::array<size_type, locate_batch_size> steps;
+        std::array<size_type, locate_batch_size> slot;
+
+        for (size_type batch_begin = 0; batch_begin < count; batch_begin += locate_batch_size)
+        {
+            size_type active = std::min<size_type>(locate_batch_size, count - batch_begin);
+            for (size_type j = 0; j < active; ++j)
+            {
+                sa_pos[j] = lb + batch_begin + j;
+                steps[j] = 0;
+                slot[j] = batch_begin + j;
+            }
+
+            while (active > 0)
+            {
+                for (size_type j = 0; j < active;)
+                {
+                    if (index.sa_sample.is_sampled(sa_pos[j]))
+                    {
+                        size_type const value = index.sa_sample[index.sa_sample.sample_idx(sa_pos[j])] + steps[j];
+                        out[slot[j]] = (value < index.size()) ? value : value - index.size();
+
+                        // The walk is finished, continue with the last active walk at this position.
+                        --active;
+                        sa_pos[j] = sa_pos[active];
+                        steps[j] = steps[active];
+                        slot[j] = slot[active];
+                    }
+                    else
+                    {
+                        sa_pos[j] = index.lf[sa_pos[j]];
+                        ++steps[j];
+
+                        if constexpr (has_prefetch)
+                            index.wavelet_tree.prefetch(sa_pos[j]);
+
+                        ++j;
+                    }
+                }
+            }
+        }
+    }
+
+    /*!\brief Locates the occurrences of a string given by its suffix array interval.
+     * \param[in] lb    The left bound of the interval.
+     * \param[in] count The size of the interval.
+     * \param[in] depth The length of the string.
+     * \returns The text positions of the occurrences in the order of the suffix array; pairs of text id and
+     *          position for text collections.
+     *
+     * \details
+     *
+     * The suffix array values are computed with locate_sa_interval(). For text collections, the positions in the
+     * concatenated text are sorted and assigned to the texts in a single pass. A rank query and a select query are
+     * only needed for every distinct text that contains an occurrence instead of a rank query for every occurrence.
+     */
+    auto locate_interval(size_type const lb, size_type const count, size_type const depth) const
+    {
+        assert(lb + count <= size() && depth < size());
+
+        std::vector<size_type> occ(count);
+        locate_sa_interval(lb, count, occ.data());
+
+        size_type const offset = size() - depth - 1; // since the string is reversed during construction
+        for (size_type & pos : occ)
+            pos = offset - pos;
+
+        if constexpr (!is_collection)
+        {
+            return occ;
+        }
+        else
+        {
+            std::vector<size_type> order(count);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&occ] (size_type const i, size_type const j)
+            {
+                return occ[i] < occ[j];
+            });
+
+            size_type const text_count = text_begin_rs.rank(text_begin.size());
+            auto text_begin_of = [&] (size_type const text_id) // 1-based, text_count + 1 is past the last text
+            {
+                return (text_id <= text_count) ? text_begin_ss.select(text_id) : std::numeric_limits<size_type>::max();
+            };
+
+            // Only the first hit of every text needs a rank query; the following hits of the same text are
+            // recognised by the begin of the next text.
+            std::vector<std::pair<size_type, size_type>> text_occ(count);
+            size_type text_id{0}, current_begin{0}, next_begin{0};
+            for (size_type const i : order)
+            {
+                if (occ[i] >= next_begin)
+                {
+                    size_type const hit_text_id = text_begin_rs.rank(occ[i] + 1);
+                    current_begin = (text_id > 0 && hit_text_id == text_id + 1) ? next_begin
+                                                                                : text_begin_of(hit_text_id);
+                    text_id = hit_text_id;
+                    next_begin = text_begin_of(text_id + 1);
+                }
+                text_occ[i] = {text_id - 1, occ[i] - current_begin};
+            }
+            return text_occ;
+        }
+    }
+
 };
 
 //!\}
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fm_index_construction_config.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief Options for constructing a seqan3::fm_index or seqan3::bi_fm_index.
+ *
+ * \details
+ *
+ * By default an index is constructed in memory on a single thread. If the estimated memory peak of the in-memory
+ * construction exceeds seqan3::fm_index_construction_config::memory_budget, the text, the suffix array and the
+ * Burrows-Wheeler transform are kept in temporary files in seqan3::fm_index_construction_config::tmp_dir instead,
+ * which about halves the memory peak. If the budget is exceeded even then, the suffix array is built with a
+ * semi-external algorithm, i.e. only the text has to fit into main memory.
+ *
+ * The memory budget is not enforced. It is only compared with estimates of the memory peaks to choose between these
+ * construction modes; the memory used by the chosen mode is not limited.
+ *
+ * A seqan3::bi_fm_index builds its forward and its reverse index concurrently if
+ * seqan3::fm_index_construction_config::thread_count is larger than 1. Both then share the memory budget.
+ *
+ * If seqan3::fm_index_construction_config::kmer_lookup_length is set to \f$k > 0\f$, the suffix array intervals of
+ * all strings of length at most \f$k\f$ are precomputed and stored with the index. A search starting at the root then
+ * skips the first \f$k\f$ backward search steps. The table has \f$\sum_{i=1}^{k} \Sigma^i\f$ entries of two
+ * bit-compressed positions each, e.g. about 1.4 million entries for seqan3::dna4 and \f$k = 10\f$. A
+ * seqan3::bi_fm_index stores a table for both directions.
+ */
+struct fm_index_construction_config
+{
+    //!\brief The number of threads used for the construction.
+    size_t thread_count{1};
+    //!\brief The memory budget in bytes that selects the construction mode; 0 means that the budget is unlimited.
+    size_t memory_budget{0};
+    //!\brief The directory for temporary files; the system's temporary directory is used if empty.
+    std::filesystem::path tmp_dir{};
+    //!\brief The maximum length of the strings in the k-mer lookup table; 0 means that no table is built.
+    uint8_t kmer_lookup_length{0};
+};
+
+//!\}
+
+} // namespace seqan3
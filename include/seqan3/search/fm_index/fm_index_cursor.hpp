@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <type_traits>
+#include <utility>
 
 #include <sdsl/suffix_trees.hpp>
 
@@ -27,11 +29,23 @@
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/std/ranges>
 
-// namespace seqan3::detail
-// {
-//     // forward declaration
-//     auto get_suffix_array_range(fm_index_cursor<index_t> const & it);
-// } // namespace seqan3::detail
+namespace seqan3
+{
+// forward declaration
+template <typename index_t>
+class fm_index_cursor;
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// forward declaration
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(fm_index_cursor<index_t> const & cursor) noexcept;
+
+template <typename cursor_t>
+class interleaved_backward_search;
+} // namespace seqan3::detail
 
 namespace seqan3
 {
@@ -103,10 +117,17 @@ protected:
     //!\brief Indicates whether index is built over a collection
     static bool constexpr is_collection = dimension_v<typename index_type::text_type> == 2;
 
+    //!\brief Indicates whether the underlying SDSL index can rank all characters at once (see sdsl::epr_dictionary).
+    static bool constexpr has_bulk_rank =
+        detail::is_epr_dictionary_v<typename index_type::sdsl_index_type::wavelet_tree_type>;
+
     template <typename _index_t>
     friend class bi_fm_index_cursor;
 
-    // friend detail::get_suffix_array_range;
+    friend std::pair<size_type, size_type> detail::get_suffix_array_range<index_t>(fm_index_cursor const &) noexcept;
+
+    template <typename cursor_t>
+    friend class detail::interleaved_backward_search;
 
     //!\brief Helper function to recompute text positions since the indexed text is reversed.
     size_type offset() const noexcept
@@ -154,6 +175,76 @@ protected:
         return false;
     }
 
+    /*!\brief Searches the smallest child of the suffix array interval [l, r] with an edge label of at least `c`.
+     * \param[in,out] c The smallest character to consider; set to the label of the child found.
+     * \param[in,out] l Left suffix array interval of the parent; set to the one of the child found.
+     * \param[in,out] r Right suffix array interval of the parent; set to the one of the child found.
+     * \returns `true` if a child was found, `false` otherwise (`l` and `r` are not modified).
+     *
+     * \details
+     *
+     * If the underlying SDSL index ranks all characters at once, the occurrences of all characters in front of `l` and
+     * `r + 1` are computed only once instead of performing a backward search for each character.
+     */
+    bool next_child(sdsl_char_type & c, size_type & l, size_type & r) const noexcept
+    {
+        auto const & csa = index->index;
+
+        if constexpr (has_bulk_rank)
+        {
+            if (l == 0 && r + 1 == csa.size()) // [[unlikely]]
+            {
+                for (; c < sigma; ++c)
+                {
+                    if (csa.C[c + 1] > csa.C[c])
+                    {
+                        l = csa.C[c];
+                        r = csa.C[c + 1] - 1;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            auto const l_ranks = csa.wavelet_tree.rank_all(l);     // count all characters in bwt[0..l-1]
+            auto const r_ranks = csa.wavelet_tree.rank_all(r + 1); // count all characters in bwt[0..r]
+            for (; c < sigma; ++c)
+            {
+                sdsl_char_type const cc = csa.comp2char[c];
+                if (r_ranks[cc] > l_ranks[cc])
+                {
+                    l = csa.C[c] + l_ranks[cc];
+                    r = csa.C[c] + r_ranks[cc] - 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+        else
+        {
+            while (c < sigma && !backward_search(csa, csa.comp2char[c], l, r))
+                ++c;
+
+            return c < sigma;
+        }
+    }
+
+    //!\brief The length of the prefix of a query that extend_right() looks up at the root instead of searching it.
+    size_type lookup_length() const noexcept
+    {
+        return index->kmer_table.length();
+    }
+
+    //!\brief Prefetches the data of the rank queries of the next extend_right() if the rank dictionary supports it.
+    void prefetch_extension() const noexcept
+    {
+        if constexpr (has_bulk_rank)
+        {
+            index->index.wavelet_tree.prefetch(node.lb);
+            index->index.wavelet_tree.prefetch(node.rb + 1);
+        }
+    }
+
 public:
 
     /*!\name Constructors, destructor and assignment
@@ -235,18 +326,12 @@ public:
      */
     bool extend_right() noexcept
     {
-        // TODO: specialize extend_right() and cycle_back() for EPR-dictionaries
-        // store all cursors at once in a private std::array of cursors
         assert(index != nullptr);
 
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         size_type _lb = node.lb, _rb = node.rb;
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
-        {
-            ++c;
-        }
 
-        if (c != sigma)
+        if (next_child(c, _lb, _rb))
         {
             parent_lb = node.lb;
             parent_rb = node.rb;
@@ -300,6 +385,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the cursor points to the root and the index has a k-mer lookup table (see
+     * seqan3::fm_index_construction_config::kmer_lookup_length), the interval of the first characters is looked up
+     * instead of searched.
+     *
      * ### Complexity
      *
      * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
@@ -322,8 +411,25 @@ public:
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
 
         sdsl_char_type c{};
+        auto it = first;
+
+        // Look up the interval of the longest prefix that is covered by the k-mer lookup table.
+        if (node.depth == 0 && index->kmer_table.length() > 0 && first != last)
+        {
+            uint8_t const prefix_length = std::min<size_type>(last - first, index->kmer_table.length());
+            if (!index->kmer_table.lookup(first, prefix_length, _lb, _rb))
+                return false;
 
-        for (auto it = first; it != last; ++it)
+            new_parent_lb = node.lb;
+            new_parent_rb = node.rb;
+            if (prefix_length > 1)
+                index->kmer_table.lookup(first, prefix_length - 1, new_parent_lb, new_parent_rb);
+
+            it += prefix_length;
+            c = to_rank(*(it - 1)) + 1;
+        }
+
+        for (; it != last; ++it)
         {
             c = to_rank(*it) + 1;
 
@@ -374,12 +480,7 @@ public:
         sdsl_char_type c = node.last_char + 1;
         size_type _lb = parent_lb, _rb = parent_rb;
 
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
-        {
-            ++c;
-        }
-
-        if (c != sigma) // Collection has additional sentinel as delimiter
+        if (next_child(c, _lb, _rb)) // Collection has additional sentinel as delimiter
         {
             node = {_lb, _rb, node.depth, c};
             return true;
@@ -501,6 +602,11 @@ public:
     /*!\brief Locates the occurrences of the searched query in the text.
      * \returns Positions in the text.
      *
+     * \details
+     *
+     * The occurrences are located in batches whose LF walks advance in lockstep, see
+     * seqan3::fm_index::locate_sa_interval.
+     *
      * ### Complexity
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
@@ -516,12 +622,7 @@ public:
     {
         assert(index != nullptr);
 
-        std::vector<size_type> occ(count());
-        for (size_type i = 0; i < occ.size(); ++i)
-        {
-            occ[i] = offset() - index->index[node.lb + i];
-        }
-        return occ;
+        return index->locate_interval(node.lb, count(), query_length());
     }
 
     //!\overload
@@ -532,16 +633,7 @@ public:
     {
         assert(index != nullptr);
 
-        std::vector<std::pair<size_type, size_type>> occ;
-        occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            size_type loc = offset() - index->index[node.lb + i];
-            size_type sequence_rank = index->text_begin_rs.rank(loc + 1);
-            size_type sequence_position = loc - index->text_begin_ss.select(sequence_rank);
-            occ.emplace_back(sequence_rank - 1, sequence_position);
-        }
-        return occ;
+        return index->locate_interval(node.lb, count(), query_length());
     }
 
     /*!\brief Locates the occurrences of the searched query in the text on demand, i.e. a ranges::view is returned and
@@ -590,3 +682,21 @@ public:
 //!\}
 
 } // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the suffix array interval of a seqan3::fm_index_cursor.
+ * \ingroup fm_index
+ * \tparam index_t The type of the underlying index.
+ * \param[in] cursor The cursor.
+ * \returns A std::pair with the left and the right bound of the suffix array interval (both inclusive).
+ */
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(fm_index_cursor<index_t> const & cursor) noexcept
+{
+    return {cursor.node.lb, cursor.node.rb};
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,531 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::r_index, an FM index whose size depends on the number of runs of the BWT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <sdsl/construct.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/sd_vector.hpp>
+
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/view/to_rank.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_construction.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/run_length_bwt.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_config.hpp>
+#include <seqan3/search/fm_index/r_index_cursor.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief A unidirectional FM index over a run-length compressed BWT (r-index).
+ * \implements seqan3::FmIndex
+ * \tparam text_t The type of the text to be indexed; must model std::ranges::RandomAccessRange.
+ * \details
+ *
+ * The seqan3::fm_index stores every `SAMPLING_RATE`-th suffix array value, i.e. its size grows linearly with the
+ * text. For highly repetitive texts, e.g. a collection of genomes of the same species, the BWT consists of few long
+ * runs of equal characters. The r-index stores the BWT and the suffix array samples it needs to locate occurrences in
+ * space proportional to the number of runs \f$r\f$ instead of the length of the text \f$n\f$, see
+ * seqan3::detail::run_length_bwt. Counting and locating do not depend on a sampling rate.
+ *
+ * The index is used like the seqan3::fm_index: it provides a seqan3::r_index_cursor with the same interface as the
+ * seqan3::fm_index_cursor and can be searched with seqan3::search.
+ *
+ * \attention As for the seqan3::fm_index, the symbol with rank 255 may not occur in the text. When indexing text
+ *            collections, the symbols with rank 254 and 255 are reserved.
+ *
+ * ### Running time / Space consumption
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(\log \Sigma + \log \frac{n}{r})\f$
+ *
+ * \f$T_{LOCATE}: O(\log \frac{n}{r})\f$ per occurrence
+ *
+ * \f$O(r)\f$ words; for text collections additionally a sparse bit vector marking the begin of every text.
+ */
+template <std::ranges::RandomAccessRange text_t>
+//!\cond
+    requires Alphabet<innermost_value_type_t<text_t>> &&
+             alphabet_size_v<innermost_value_type_t<text_t>> <= 256
+//!\endcond
+class r_index
+{
+protected:
+    //!\privatesection
+
+    //!\brief The type of the characters of the BWT.
+    using sdsl_char_type = uint8_t;
+
+    //!\brief The run-length compressed BWT.
+    detail::run_length_bwt rlbwt;
+    //!\brief Pointer to the indexed text.
+    text_t const * text = nullptr;
+    //!\brief The characters occurring in the text in ascending order (without the sentinel and the delimiter).
+    sdsl::int_vector<8> symbols;
+
+    //!\brief Bitvector storing begin positions for collections.
+    sdsl::sd_vector<> text_begin;
+    //!\brief Select support for text_begin.
+    sdsl::select_support_sd<1> text_begin_ss;
+    //!\brief Rank support for text_begin.
+    sdsl::rank_support_sd<1> text_begin_rs;
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the indexed text.
+    using text_type = text_t;
+    //!\brief The type of the underlying character of text_type.
+    using char_type = innermost_value_type_t<text_t>;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = typename detail::run_length_bwt::size_type;
+    //!\brief The type of the (unidirectional) cursor.
+    using cursor_type = r_index_cursor<r_index<text_t>>;
+    //!\}
+
+    static_assert(dimension_v<text_t> == 1 || dimension_v<text_t> == 2,
+                  "Only texts or collections of texts can be indexed.");
+
+    //!\brief Indicates whether index is built over a collection.
+    static bool constexpr is_collection = dimension_v<text_t> == 2;
+
+    template <typename r_index_t>
+    friend class r_index_cursor;
+
+    template <typename fm_index_t>
+    friend class detail::fm_index_cursor_node;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    r_index() = default; //!< Default constructor.
+
+    //!\brief Copy constructor.
+    r_index(r_index const & other) :
+        rlbwt{other.rlbwt}, text{other.text}, symbols{other.symbols}, text_begin{other.text_begin},
+        text_begin_ss{other.text_begin_ss}, text_begin_rs{other.text_begin_rs}
+    {
+        text_begin_ss.set_vector(&text_begin);
+        text_begin_rs.set_vector(&text_begin);
+    }
+
+    //!\brief Copy assignment.
+    r_index & operator=(r_index const & other)
+    {
+        if (this != &other)
+            *this = r_index{other};
+        return *this;
+    }
+
+    //!\brief Move constructor.
+    r_index(r_index && other) noexcept :
+        rlbwt{std::move(other.rlbwt)}, text{other.text}, symbols{std::move(other.symbols)},
+        text_begin{std::move(other.text_begin)}, text_begin_ss{std::move(other.text_begin_ss)},
+        text_begin_rs{std::move(other.text_begin_rs)}
+    {
+        text_begin_ss.set_vector(&text_begin);
+        text_begin_rs.set_vector(&text_begin);
+    }
+
+    //!\brief Move assignment.
+    r_index & operator=(r_index && other) noexcept
+    {
+        rlbwt = std::move(other.rlbwt);
+        text = other.text;
+        symbols = std::move(other.symbols);
+        text_begin = std::move(other.text_begin);
+        text_begin_ss = std::move(other.text_begin_ss);
+        text_begin_rs = std::move(other.text_begin_rs);
+        text_begin_ss.set_vector(&text_begin);
+        text_begin_rs.set_vector(&text_begin);
+        return *this;
+    }
+
+    ~r_index() = default; //!< Destructor.
+
+    /*!\brief Constructor that immediately constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config; the k-mer lookup table
+     *                   is not supported.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the text plus the construction of the suffix array.
+     */
+    r_index(text_t const & text, fm_index_construction_config const & config = {})
+    {
+        construct(text, config);
+    }
+
+    //!\overload
+    r_index(text_t &&, fm_index_construction_config const & = {}) = delete;
+
+    //!\overload
+    r_index(text_t const &&, fm_index_construction_config const & = {}) = delete;
+    //!\}
+
+    /*!\brief Constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text The text to construct from.
+     * \param[in] config The construction options, see seqan3::fm_index_construction_config; the k-mer lookup table
+     *                   is not supported.
+     * \throws std::invalid_argument if the text is empty or `config` asks for a k-mer lookup table.
+     *
+     * \details The suffix array and the BWT are constructed in an SDSL cache like for the seqan3::fm_index, including
+     *          the construction in temporary files if the memory budget of `config` is exceeded. Both are streamed
+     *          from the cache into seqan3::detail::run_length_bwt and removed afterwards.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the text plus the construction of the suffix array.
+     *
+     * ### Exceptions
+     *
+     * No guarantees.
+     */
+    void construct(text_t const & text, fm_index_construction_config const & config = {})
+        //!\cond
+        requires !is_collection
+        //!\endcond
+    {
+        // text must not be empty
+        if (std::ranges::begin(text) == std::ranges::end(text))
+            throw std::invalid_argument("The text that is indexed cannot be empty.");
+        check_config(config);
+
+        this->text = &text;
+        construct_rlbwt([&text] (sdsl::int_vector_buffer<8> & text_buffer)
+        {
+            for (uint8_t const r : text | view::to_rank | std::view::reverse) // reverse and increase rank by one
+            {
+                if constexpr (alphabet_size_v<char_type> == 256)
+                {
+                    if (r == 255)
+                        throw std::out_of_range("The input text cannot be indexed, because for full character "
+                                                "alphabets the last one/two values are reserved (single sequence/"
+                                                "collection).");
+                }
+                text_buffer.push_back(r + 1);
+            }
+        }, std::ranges::size(text), config);
+    }
+
+    //!\overload
+    void construct(text_t const & text, fm_index_construction_config const & config = {})
+        //!\cond
+        requires is_collection
+        //!\endcond
+    {
+        // text collection must not be empty
+        if (std::ranges::begin(text) == std::ranges::end(text))
+            throw std::invalid_argument("The text that is indexed cannot be empty.");
+        check_config(config);
+
+        size_t text_size{0}; // text size including delimiters
+
+        // there must be at least one non-empty text in the collection
+        bool all_empty = true;
+
+        for (auto && t : text)
+        {
+            if (std::ranges::begin(t) != std::ranges::end(t))
+            {
+                all_empty = false;
+            }
+            text_size += 1 + t.size(); // text size and delimiter (sum will be 1 for empty texts)
+        }
+
+        if (all_empty)
+            throw std::invalid_argument("A text collection that only contains empty texts cannot be indexed.");
+
+        this->text = &text;
+
+        // bitvector where 1 marks the begin position of a single text from the collection in the concatenated text
+        sdsl::bit_vector pos(text_size, 0);
+        size_t prefix_sum{0};
+
+        for (auto && t : text)
+        {
+            pos[prefix_sum] = 1;
+            prefix_sum += t.size() + 1;
+        }
+
+        text_begin    = sdsl::sd_vector(pos);
+        text_begin_ss = sdsl::select_support_sd<1>(&text_begin);
+        text_begin_rs = sdsl::rank_support_sd<1>(&text_begin);
+
+        uint8_t delimiter = alphabet_size_v<char_type> >= 255 ? 255 : alphabet_size_v<char_type> + 1;
+
+        // The texts are streamed back to front and each of them reversed, s.t. the packed texts are never copied.
+        // The last text in the collection needs no delimiter.
+        construct_rlbwt([&text, delimiter] (sdsl::int_vector_buffer<8> & text_buffer)
+        {
+            bool is_last{true};
+            for (auto && t : text | std::view::reverse)
+            {
+                if (!is_last)
+                    text_buffer.push_back(delimiter);
+                is_last = false;
+
+                for (auto && c : t | std::view::reverse)
+                {
+                    uint8_t const r = seqan3::to_rank(c);
+                    if constexpr (alphabet_size_v<char_type> >= 255)
+                    {
+                        if (r >= 254)
+                            throw std::out_of_range("The input text cannot be indexed, because for full character "
+                                                    "alphabets the last one/two values are reserved (single "
+                                                    "sequence/collection).");
+                    }
+                    text_buffer.push_back(r + 1); // increase rank by one
+                }
+            }
+        }, text_size - 1, config);
+    }
+
+    //!\overload
+    void construct(text_t &&, fm_index_construction_config const & = {}) = delete;
+
+    //!\overload
+    void construct(text_t const &&, fm_index_construction_config const & = {}) = delete;
+
+    /*!\brief Returns the length of the indexed text including sentinel characters.
+     * \returns Returns the length of the indexed text including sentinel characters.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        return rlbwt.size();
+    }
+
+    /*!\brief Checks whether the index is empty.
+     * \returns `true` if the index is empty, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the number of runs of equal characters in the BWT, which determines the size of the index.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type runs() const noexcept
+    {
+        return rlbwt.runs();
+    }
+
+    /*!\brief Returns the indexed text.
+     * \returns A pointer to the indexed text, or `nullptr` if the index has been deserialised.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    text_t const * indexed_text() const noexcept
+    {
+        return text;
+    }
+
+    /*!\brief Compares two indices.
+     * \returns `true` if the indices are equal, false otherwise.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator==(r_index const & rhs) const noexcept
+    {
+        return (rlbwt == rhs.rlbwt) && (text_begin == rhs.text_begin);
+    }
+
+    /*!\brief Compares two indices.
+     * \returns `true` if the indices are unequal, false otherwise.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the index.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator!=(r_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\brief Returns a seqan3::r_index_cursor on the index that can be used for searching.
+     *        \if DEV
+     *            Cursor is pointing to the root node of the implicit suffix tree.
+     *        \endif
+     * \returns Returns a seqan3::r_index_cursor on the index.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    cursor_type begin() const noexcept
+    {
+        return {*this};
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(rlbwt);
+        archive(symbols);
+        archive(text_begin);
+        archive(text_begin_ss);
+        text_begin_ss.set_vector(&text_begin);
+        archive(text_begin_rs);
+        text_begin_rs.set_vector(&text_begin);
+    }
+    //!\endcond
+
+protected:
+    //!\privatesection
+
+    //!\brief Throws if the construction options ask for something the r-index does not support.
+    static void check_config(fm_index_construction_config const & config)
+    {
+        if (config.kmer_lookup_length > 0)
+            throw std::invalid_argument("The r-index does not support a k-mer lookup table.");
+    }
+
+    /*!\brief Constructs the run-length compressed BWT of the text written by `write_text`.
+     * \param[in] write_text Appends the ranks of the reversed text to the given buffer.
+     * \param[in] text_size  The number of ranks written by `write_text`.
+     * \param[in] config     The construction options.
+     */
+    template <typename write_text_t>
+    void construct_rlbwt(write_text_t && write_text, size_t const text_size,
+                         fm_index_construction_config const & config)
+    {
+        detail::construct_from_sdsl_cache(this, write_text, text_size, config, [this] (sdsl::cache_config & cache)
+        {
+            sdsl::construct_bwt<8>(cache);
+
+            sdsl::int_vector_buffer<8> bwt{sdsl::cache_file_name(sdsl::conf::KEY_BWT, cache)};
+            sdsl::int_vector_buffer<> sa{sdsl::cache_file_name(sdsl::conf::KEY_SA, cache)};
+            rlbwt.construct(bwt, sa);
+        });
+
+        uint8_t const delimiter = alphabet_size_v<char_type> >= 255 ? 255 : alphabet_size_v<char_type> + 1;
+        std::vector<uint8_t> occurring{};
+        for (size_t c = 1; c < 256; ++c)
+        {
+            if (rlbwt.occurrences(c) > 0 && !(is_collection && c == delimiter))
+                occurring.push_back(c);
+        }
+        symbols = sdsl::int_vector<8>(occurring.size());
+        std::copy(occurring.begin(), occurring.end(), symbols.begin());
+    }
+
+    /*!\brief Converts a position in the concatenated text to a position in the text.
+     * \returns The position for single texts; the pair of text id and position for text collections.
+     */
+    auto to_text_position(size_type const pos) const noexcept
+    {
+        if constexpr (!is_collection)
+        {
+            return pos;
+        }
+        else
+        {
+            size_type const text_rank = text_begin_rs.rank(pos + 1);
+            return std::make_pair(text_rank - 1, pos - text_begin_ss.select(text_rank));
+        }
+    }
+
+    /*!\brief Locates the occurrences of a string given by the suffix array value at the right bound of its interval.
+     * \param[in] toehold The suffix array value at the right bound of the interval.
+     * \param[in] count   The size of the interval.
+     * \param[in] depth   The length of the string.
+     * \returns The text positions of the occurrences in the reverse order of the suffix array; pairs of text id and
+     *          position for text collections.
+     */
+    auto locate_interval(size_type const toehold, size_type const count, size_type const depth) const
+    {
+        assert(count <= size() && depth < size());
+
+        std::vector<decltype(to_text_position(0))> occ{};
+        occ.reserve(count);
+
+        size_type const offset = size() - depth - 1; // since the string is reversed during construction
+        size_type value = toehold;
+        for (size_type i = 0; i < count; ++i)
+        {
+            if (i > 0)
+                value = rlbwt.phi(value);
+            occ.push_back(to_text_position(offset - value));
+        }
+        return occ;
+    }
+};
+
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,540 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::r_index_cursor for searching in the seqan3::r_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/all.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/view/slice.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+// forward declaration
+template <typename index_t>
+class r_index_cursor;
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// forward declaration
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(r_index_cursor<index_t> const & cursor) noexcept;
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief The cursor of the seqan3::r_index.
+ * \implements seqan3::FmIndexCursor
+ * \tparam index_t The type of the underlying index; must be a specialisation of seqan3::r_index.
+ * \details
+ *
+ * The cursor has the interface of the seqan3::fm_index_cursor. In addition to the suffix array interval, it
+ * maintains the suffix array value at the right bound of the interval (the *toehold*), from which the occurrences are
+ * located, see seqan3::detail::run_length_bwt.
+ *
+ * The occurrences are reported in the reverse order of the suffix array, i.e. the first occurrence is available
+ * without any further computation.
+ *
+ * ### Running time
+ *
+ * \f$r\f$: the number of runs of the BWT.
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(\log \Sigma + \log \frac{n}{r})\f$
+ *
+ * \f$T_{LOCATE}: O(\log \frac{n}{r})\f$ per occurrence
+ */
+template <typename index_t>
+class r_index_cursor
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type of the index.
+    using index_type = index_t;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = typename index_type::size_type;
+    //!\}
+
+protected:
+    //!\privatesection
+
+    //!\brief Type of the representation of a suffix tree node.
+    using node_type = detail::fm_index_cursor_node<index_t>;
+
+    //!\brief Underlying index.
+    index_type const * index;
+    //!\brief Left suffix array interval of the parent node. Needed for cycle_back().
+    size_type parent_lb;
+    //!\brief Right suffix array interval of the parent node. Needed for cycle_back().
+    size_type parent_rb;
+    //!\brief Suffix array value at the right bound of the parent node. Needed for cycle_back().
+    size_type parent_toehold;
+    //!\brief The suffix array interval, depth and last character of the current node.
+    node_type node;
+    //!\brief Suffix array value at the right bound of the current node.
+    size_type toehold;
+
+    //!\brief Indicates whether index is built over a collection
+    static bool constexpr is_collection = index_type::is_collection;
+
+    friend std::pair<size_type, size_type> detail::get_suffix_array_range<index_t>(r_index_cursor const &) noexcept;
+
+    //!\brief Helper function to recompute text positions since the indexed text is reversed.
+    size_type offset() const noexcept
+    {
+        assert(index->size() > query_length());
+        return index->size() - query_length() - 1; // since the string is reversed during construction
+    }
+
+    /*!\brief Performs a backward search step on the interval [l, r] with the toehold `t`.
+     * \returns `true` if `c` occurs in the interval, `false` otherwise (`l`, `r` and `t` are not modified).
+     */
+    bool backward_search(uint8_t const c, size_type & l, size_type & r, size_type & t) const noexcept
+    {
+        assert(l <= r && r < index->size());
+
+        auto const & bwt = index->rlbwt;
+        size_type const _l = bwt.lf(l, c);
+        size_type const _r = bwt.lf(r + 1, c);
+
+        if (_r > _l)
+        {
+            t = bwt.toehold(r, t, c);
+            l = _l;
+            r = _r - 1;
+            return true;
+        }
+        return false;
+    }
+
+    /*!\brief Searches the smallest child of the suffix array interval [l, r] with an edge label of at least the
+     *        `first`-th character occurring in the text.
+     * \returns The position of the label of the child found in seqan3::r_index::symbols, or the number of characters
+     *          occurring in the text if there is no such child (`l`, `r` and `t` are not modified).
+     */
+    size_type next_child(size_type first, size_type & l, size_type & r, size_type & t) const noexcept
+    {
+        auto const & symbols = index->symbols;
+        while (first < symbols.size() && !backward_search(symbols[first], l, r, t))
+            ++first;
+        return first;
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor. Accessing member functions on a default constructed object is undefined behavior.
+    r_index_cursor() noexcept = default;                                   //!< Default constructor.
+    r_index_cursor(r_index_cursor const &) noexcept = default;             //!< Copy constructor.
+    r_index_cursor & operator=(r_index_cursor const &) noexcept = default; //!< Copy assignment.
+    r_index_cursor(r_index_cursor &&) noexcept = default;                  //!< Move constructor.
+    r_index_cursor & operator=(r_index_cursor &&) noexcept = default;      //!< Move assignment.
+    ~r_index_cursor() = default;                                           //!< Destructor.
+
+    //! \brief Construct from given index.
+    r_index_cursor(index_t const & _index) noexcept :
+        index(&_index), node({0, _index.size() - 1, 0, 0}), toehold(_index.rlbwt.last_value())
+    {}
+    //\}
+
+    /*!\brief Compares two cursors.
+     * \param[in] rhs Other cursor to compare it to.
+     * \returns `true` if both cursors are equal, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator==(r_index_cursor const & rhs) const noexcept
+    {
+        assert(index != nullptr);
+
+        // The suffix array interval and the depth determine the node and its toehold.
+        return node == rhs.node;
+    }
+
+    /*!\brief Compares two cursors.
+     * \param[in] rhs Other cursor to compare it to.
+     * \returns `true` if the cursors are not equal, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator!=(r_index_cursor const & rhs) const noexcept
+    {
+        assert(index != nullptr);
+
+        return !(*this == rhs);
+    }
+
+    /*!\brief Tries to extend the query by the smallest possible character to the right such that the query is found in
+     *        the text.
+     * \returns `true` if the cursor could extend the query successfully.
+     *
+     * ### Complexity
+     *
+     * \f$O(\Sigma) * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * It scans linearly over the characters occurring in the text until it finds the smallest character that is
+     * represented by an edge.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool extend_right() noexcept
+    {
+        assert(index != nullptr);
+
+        size_type _lb = node.lb, _rb = node.rb, _toehold = toehold;
+        size_type const symbol = next_child(0, _lb, _rb, _toehold);
+
+        if (symbol < index->symbols.size())
+        {
+            parent_lb = node.lb;
+            parent_rb = node.rb;
+            parent_toehold = toehold;
+            node = {_lb, _rb, node.depth + 1, index->symbols[symbol]};
+            toehold = _toehold;
+            return true;
+        }
+        return false;
+    }
+
+    /*!\brief Tries to extend the query by the character `c` to the right.
+     * \tparam char_t Type of the character needs to be convertible to the character type `char_type` of the indexed
+     *                text.
+     * \param[in] c Character to extend the query with to the right.
+     * \returns `true` if the cursor could extend the query successfully.
+     *
+     * ### Complexity
+     *
+     * \f$O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <Alphabet char_t>
+    //!\cond
+        requires ImplicitlyConvertibleTo<char_t, typename index_t::char_type>
+    //!\endcond
+    bool extend_right(char_t const c) noexcept
+    {
+        assert(index != nullptr);
+
+        size_type _lb = node.lb, _rb = node.rb, _toehold = toehold;
+        uint8_t const c_char = to_rank(c) + 1;
+
+        if (backward_search(c_char, _lb, _rb, _toehold))
+        {
+            parent_lb = node.lb;
+            parent_rb = node.rb;
+            parent_toehold = toehold;
+            node = {_lb, _rb, node.depth + 1, c_char};
+            toehold = _toehold;
+            return true;
+        }
+        return false;
+    }
+
+    /*!\brief Tries to extend the query by `seq` to the right.
+     * \tparam seq_t The type of range of the sequence to search; must model std::ranges::RandomAccessRange.
+     * \param[in] seq Sequence to extend the query with to the right.
+     * \returns `true` if the cursor could extend the query successfully.
+     *
+     * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
+     * state before calling this method.
+     *
+     * ### Complexity
+     *
+     * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <std::ranges::RandomAccessRange seq_t>
+    //!\cond
+        requires ImplicitlyConvertibleTo<innermost_value_type_t<seq_t>, typename index_t::char_type>
+    //!\endcond
+    bool extend_right(seq_t && seq) noexcept
+    {
+        auto first = std::ranges::begin(seq);
+        auto last = std::ranges::end(seq);
+        assert(index != nullptr);
+
+        size_type _lb = node.lb, _rb = node.rb, _toehold = toehold;
+        size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb, new_parent_toehold = parent_toehold;
+
+        uint8_t c{};
+        for (auto it = first; it != last; ++it)
+        {
+            c = to_rank(*it) + 1;
+
+            new_parent_lb = _lb;
+            new_parent_rb = _rb;
+            new_parent_toehold = _toehold;
+            if (!backward_search(c, _lb, _rb, _toehold))
+                return false;
+        }
+
+        parent_lb = new_parent_lb;
+        parent_rb = new_parent_rb;
+        parent_toehold = new_parent_toehold;
+        node = {_lb, _rb, last - first + node.depth, c};
+        toehold = _toehold;
+        return true;
+    }
+
+    /*!\brief Tries to replace the rightmost character of the query by the next lexicographically larger character such
+     *        that the query is found in the text.
+     * \returns `true` if there exists a query in the text where the rightmost character of the query is
+     *          lexicographically larger than the current rightmost character of the query.
+     *
+     * ### Complexity
+     *
+     * \f$O(\Sigma) * O(T_{BACKWARD\_SEARCH})\f$
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool cycle_back() noexcept
+    {
+        assert(index != nullptr && query_length() > 0);
+        // parent_lb > parent_rb --> invalid interval
+        assert(parent_lb <= parent_rb);
+
+        auto const & symbols = index->symbols;
+        size_type _lb = parent_lb, _rb = parent_rb, _toehold = parent_toehold;
+        size_type const first = std::upper_bound(symbols.begin(), symbols.end(), node.last_char) - symbols.begin();
+        size_type const symbol = next_child(first, _lb, _rb, _toehold);
+
+        if (symbol < symbols.size())
+        {
+            node = {_lb, _rb, node.depth, symbols[symbol]};
+            toehold = _toehold;
+            return true;
+        }
+        return false;
+    }
+
+    /*!\brief Outputs the rightmost character.
+     * \returns Rightmost character.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    typename index_t::char_type last_char() noexcept
+    {
+        // parent_lb > parent_rb --> invalid interval
+        assert(index != nullptr && query_length() > 0 && parent_lb <= parent_rb);
+
+        typename index_t::char_type c;
+        assign_rank_to(node.last_char - 1, c); // text is not allowed to contain ranks of 0
+        return c;
+    }
+
+    /*!\brief Returns the length of the searched query.
+     * \returns Length of query.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type query_length() const noexcept
+    {
+        assert(index != nullptr);
+        assert(node.depth != 0 || (node.lb == 0 && node.rb == index->size() - 1)); // depth == 0 -> root node
+
+        return node.depth;
+    }
+
+    /*!\brief Returns the searched query.
+     * \returns Searched query.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    auto query() const noexcept
+    //!\cond
+        requires !is_collection
+    //!\endcond
+    {
+        assert(index != nullptr && index->text != nullptr);
+
+        size_type const query_begin = offset() - toehold;
+        return *index->text | view::slice(query_begin, query_begin + query_length());
+    }
+
+    //!\overload
+    auto query() const noexcept
+    //!\cond
+        requires is_collection
+    //!\endcond
+    {
+        assert(index != nullptr && index->text != nullptr);
+
+        size_type const loc = offset() - toehold;
+        size_type const query_begin = loc - index->text_begin_rs.rank(loc + 1) + 1; // Substract delimiters
+        return *index->text | std::view::join | view::slice(query_begin, query_begin + query_length());
+    }
+
+    //!\copydoc query()
+    auto operator*() const noexcept
+    {
+       assert(index != nullptr && index->text != nullptr);
+
+       return query();
+    }
+
+    /*!\brief Counts the number of occurrences of the searched query in the text.
+     * \returns Number of occurrences of the searched query in the text.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type count() const noexcept
+    {
+        assert(index != nullptr);
+
+        return 1 + node.rb - node.lb;
+    }
+
+    /*!\brief Locates the occurrences of the searched query in the text.
+     * \returns Positions in the text.
+     *
+     * ### Complexity
+     *
+     * \f$count() * O(T_{LOCATE})\f$
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    std::vector<size_type> locate() const
+    //!\cond
+        requires !is_collection
+    //!\endcond
+    {
+        assert(index != nullptr);
+
+        return index->locate_interval(toehold, count(), query_length());
+    }
+
+    //!\overload
+    std::vector<std::pair<size_type, size_type>> locate() const
+    //!\cond
+        requires is_collection
+    //!\endcond
+    {
+        assert(index != nullptr);
+
+        return index->locate_interval(toehold, count(), query_length());
+    }
+
+    /*!\brief Locates the occurrences of the searched query in the text on demand, i.e. a ranges::view is returned and
+     *        every position is located once it is accessed.
+     * \returns Positions in the text in the same order as locate().
+     *
+     * \details
+     *
+     * The i-th position is computed from the toehold with i steps of seqan3::detail::run_length_bwt::phi, i.e.
+     * accessing the first positions is cheap, but locate() should be preferred to access all of them.
+     *
+     * ### Complexity
+     *
+     * \f$i * O(T_{LOCATE})\f$ for the i-th position
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    auto lazy_locate() const
+    {
+        assert(index != nullptr);
+
+        return std::view::iota(size_type{0}, count())
+               | std::view::transform([*this, _offset = offset()] (size_type steps)
+               {
+                   size_type value = toehold;
+                   for (; steps > 0; --steps)
+                       value = index->rlbwt.phi(value);
+                   return index->to_text_position(_offset - value);
+               });
+    }
+};
+
+//!\}
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the suffix array interval of a seqan3::r_index_cursor.
+ * \ingroup fm_index
+ * \tparam index_t The type of the underlying index.
+ * \param[in] cursor The cursor.
+ * \returns A std::pair with the left and the right bound of the suffix array interval (both inclusive).
+ */
+template <typename index_t>
+std::pair<typename index_t::size_type, typename index_t::size_type>
+get_suffix_array_range(r_index_cursor<index_t> const & cursor) noexcept
+{
+    return {cursor.node.lb, cursor.node.rb};
+}
+
+} // namespace seqan3::detail
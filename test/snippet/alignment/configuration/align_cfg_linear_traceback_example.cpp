@@ -0,0 +1,13 @@
+#include <seqan3/alignment/configuration/align_config_linear_traceback.hpp>
+
+int main()
+{
+//! [example]
+    using namespace seqan3;
+
+    // Compute the traceback in linear memory if the matrix has more than 10^8 cells.
+    align_cfg::linear_traceback cfg{100'000'000u};
+//! [example]
+
+    (void) cfg;
+}
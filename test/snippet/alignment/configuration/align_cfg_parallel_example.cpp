@@ -0,0 +1,13 @@
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+
+int main()
+{
+//! [example]
+    using namespace seqan3;
+
+    // Compute the alignments with 4 threads.
+    align_cfg::parallel cfg{4u};
+//! [example]
+
+    (void) cfg;
+}
@@ -0,0 +1,31 @@
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_mode.hpp>
+#include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+
+int main()
+{
+//! [example]
+    using namespace seqan3;
+
+    // Compute the scores of many global alignments using SIMD vectors.
+    auto cfg = align_cfg::mode{global_alignment} |
+               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+               align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+               align_cfg::result{with_score} |
+               align_cfg::vectorise;
+
+    // Compute the edit distances and end positions of many reads within the same region.
+    auto edit_cfg = align_cfg::edit |
+                    align_cfg::aligned_ends{free_ends_first} |
+                    align_cfg::result{with_back_coordinate} |
+                    align_cfg::vectorise;
+//! [example]
+
+    (void) cfg;
+    (void) edit_cfg;
+}
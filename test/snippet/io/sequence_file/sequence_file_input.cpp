@@ -219,4 +219,30 @@ auto rec0 = std::move(fin.front());
 //! [record_move]
 (void) rec0;
 }
+
+{
+//! [read_batch]
+sequence_file_input fin{tmp_dir/"my.fasta"};
+
+while (true)
+{
+    auto & batch = fin.read_batch(1000);
+    auto & sequences = get<field::SEQ>(batch); // a concatenated_sequences with up to 1000 sequences
+    if (sequences.empty())
+        break;
+
+    debug_stream << sequences.size() << " sequences with " << sequences.concat_size() << " characters\n";
+}
+//! [read_batch]
+}
+
+{
+//! [parallel]
+sequence_file_input fin{tmp_dir/"my.fasta"};
+fin.options.parsing_threads = 4; // parse the records behind the first one on four threads
+
+for (auto & rec : fin)
+    debug_stream << get<field::ID>(rec) << '\n'; // the records are returned in the order of the file
+//! [parallel]
+}
 }
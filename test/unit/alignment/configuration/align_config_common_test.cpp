@@ -22,11 +22,14 @@ class alignment_configuration_test : public ::testing::Test
 using test_types = ::testing::Types<align_cfg::aligned_ends<std::remove_const_t<decltype(free_ends_all)>>,
                                     align_cfg::band<static_band>,
                                     align_cfg::gap<gap_scheme<>>,
+                                    align_cfg::linear_traceback,
                                     align_cfg::max_error,
                                     align_cfg::mode<detail::global_alignment_type>,
                                     align_cfg::mode<detail::local_alignment_type>,
+                                    align_cfg::parallel,
                                     align_cfg::result<>,
-                                    align_cfg::scoring<nucleotide_scoring_scheme<int8_t>>>;
+                                    align_cfg::scoring<nucleotide_scoring_scheme<int8_t>>,
+                                    align_cfg::vectorise_tag>;
 
 TYPED_TEST_CASE(alignment_configuration_test, test_types);
 
@@ -51,7 +54,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 8);
+    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 11);
 }
 
 TYPED_TEST(alignment_configuration_test, ConfigElement)
@@ -0,0 +1,36 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_mode.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_vectorise, ConfigElement)
+{
+    EXPECT_TRUE((detail::ConfigElement<align_cfg::vectorise_tag>));
+}
+
+TEST(align_config_vectorise, configuration)
+{
+    {
+        configuration cfg{align_cfg::vectorise};
+        EXPECT_TRUE(decltype(cfg)::template exists<align_cfg::vectorise_tag>());
+        EXPECT_TRUE(get<align_cfg::vectorise_tag>(cfg).value);
+    }
+
+    {
+        auto cfg = align_cfg::mode{global_alignment} | align_cfg::vectorise;
+        EXPECT_TRUE(decltype(cfg)::template exists<align_cfg::vectorise_tag>());
+        EXPECT_TRUE(get<align_cfg::vectorise_tag>(cfg).value);
+    }
+}
@@ -100,3 +100,30 @@ TEST(align_pairwise, multiple_rng_lvalue)
         EXPECT_EQ(std::string{gap2 | view::to_char}, "A-GTGATACT");
     }
 }
+
+TEST(align_pairwise, parallel_preserves_order)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> vec{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        // Sequence pairs of different lengths produce different scores and different run times.
+        dna4_vector seq1(10 + (i * 7) % 50, 'A'_dna4);
+        dna4_vector seq2(10 + (i * 13) % 50, 'A'_dna4);
+        vec.emplace_back(std::move(seq1), std::move(seq2));
+    }
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    std::vector<int> expected{};
+    for (auto && res : align_pairwise(vec, cfg))
+        expected.push_back(res.score());
+
+    for (uint32_t threads : {1u, 2u, 4u})
+    {
+        std::vector<int> scores{};
+        for (auto && res : align_pairwise(vec, cfg | align_cfg::parallel{threads}))
+            scores.push_back(res.score());
+
+        EXPECT_EQ(scores, expected);
+    }
+}
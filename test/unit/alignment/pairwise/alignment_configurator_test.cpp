@@ -58,7 +58,22 @@ TEST(alignment_configurator, configure_edit_semi)
 
 TEST(alignment_configurator, configure_edit_banded)
 {
-    EXPECT_THROW((run_test(align_cfg::edit | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}})),
+    EXPECT_TRUE(run_test(align_cfg::edit | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}}));
+    EXPECT_TRUE(run_test(align_cfg::edit |
+                         align_cfg::aligned_ends{free_ends_first} |
+                         align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}}));
+
+    {  // invalid band
+        auto cfg_lower = align_cfg::edit | align_cfg::band{static_band{lower_bound{-10}, upper_bound{-5}}};
+        auto cfg_upper = align_cfg::edit | align_cfg::band{static_band{lower_bound{5}, upper_bound{6}}};
+
+        EXPECT_THROW(run_test(cfg_lower), invalid_alignment_configuration);
+        EXPECT_THROW(run_test(cfg_upper), invalid_alignment_configuration);
+    }
+
+    EXPECT_THROW((run_test(align_cfg::edit |
+                           align_cfg::max_error{3u} |
+                           align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}})),
                  invalid_alignment_configuration);
 }
 
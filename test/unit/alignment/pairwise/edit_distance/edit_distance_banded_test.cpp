@@ -0,0 +1,455 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/alignment_score_matrix.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/view/to_char.hpp>
+
+#include "../fixture/global_edit_distance_unbanded.hpp"
+#include "../fixture/semi_global_edit_distance_unbanded.hpp"
+
+using namespace seqan3;
+using namespace seqan3::detail;
+using namespace seqan3::test::alignment::fixture;
+
+template <typename word_t, typename is_semi_global_t>
+struct test_traits_type
+{
+    using word_type = word_t;
+    using is_semi_global_type = is_semi_global_t;
+};
+
+template <auto _fixture, typename word_t>
+struct global_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+
+    using traits_type = test_traits_type<word_t, std::false_type>;
+};
+
+template <auto _fixture, typename word_t>
+struct semi_global_fixture : public global_fixture<_fixture, word_t>
+{
+    using traits_type = test_traits_type<word_t, std::true_type>;
+};
+
+template <typename fixture_t>
+class edit_distance_banded : public fixture_t
+{};
+
+TYPED_TEST_CASE_P(edit_distance_banded);
+
+// A band that covers the whole matrix must reproduce the unbanded results.
+inline constexpr auto full_band = align_cfg::band{static_band{lower_bound{-1000}, upper_bound{1000}}};
+
+template <typename traits_t, typename database_t, typename query_t, typename align_cfg_t>
+auto edit_distance(database_t && database, query_t && query, align_cfg_t && align_cfg)
+{
+    using algorithm_t = pairwise_alignment_edit_distance_banded<database_t, query_t, align_cfg_t, traits_t>;
+
+    auto result = alignment_result{detail::alignment_result_value_type{}};
+    auto alignment = algorithm_t{database, query, align_cfg};
+
+    // compute alignment
+    alignment(result);
+    return alignment;
+}
+
+TYPED_TEST_P(edit_distance_banded, score_matrix)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | full_band;
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment = edit_distance<typename TypeParam::traits_type>(database, query, align_cfg);
+    auto score_matrix = alignment.score_matrix();
+
+    EXPECT_EQ(score_matrix.cols(), database.size()+1);
+    EXPECT_EQ(score_matrix.rows(), query.size()+1);
+    EXPECT_EQ(score_matrix, fixture.score_matrix());
+    EXPECT_EQ(alignment.score(), fixture.score);
+}
+
+TYPED_TEST_P(edit_distance_banded, trace_matrix)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | full_band;
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment = edit_distance<typename TypeParam::traits_type>(database, query, align_cfg);
+    auto trace_matrix = alignment.trace_matrix();
+
+    EXPECT_EQ(trace_matrix.cols(), database.size()+1);
+    EXPECT_EQ(trace_matrix.rows(), query.size()+1);
+    EXPECT_EQ(trace_matrix, fixture.trace_matrix());
+}
+
+TYPED_TEST_P(edit_distance_banded, alignment)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | full_band;
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment = edit_distance<typename TypeParam::traits_type>(database, query, align_cfg);
+    auto && [gapped_database, gapped_query] = alignment.alignment();
+
+    EXPECT_EQ(alignment.front_coordinate(), fixture.front_coordinate);
+    EXPECT_EQ(alignment.back_coordinate(), fixture.back_coordinate);
+    EXPECT_TRUE(ranges::equal(gapped_database | view::to_char, fixture.aligned_sequence1));
+    EXPECT_TRUE(ranges::equal(gapped_query | view::to_char, fixture.aligned_sequence2));
+}
+
+REGISTER_TYPED_TEST_CASE_P(edit_distance_banded, score_matrix, trace_matrix, alignment);
+
+using edit_distance_banded_types
+    = ::testing::Types<
+        global_fixture<&global::edit_distance::unbanded::dna4_01, uint8_t>,
+        global_fixture<&global::edit_distance::unbanded::dna4_01, uint64_t>,
+        global_fixture<&global::edit_distance::unbanded::dna4_01T, uint8_t>,
+        global_fixture<&global::edit_distance::unbanded::dna4_01T, uint64_t>,
+        global_fixture<&global::edit_distance::unbanded::dna4_02, uint8_t>,
+        global_fixture<&global::edit_distance::unbanded::dna4_02, uint64_t>,
+        global_fixture<&global::edit_distance::unbanded::aa27_01, uint8_t>,
+        global_fixture<&global::edit_distance::unbanded::aa27_01, uint64_t>,
+        global_fixture<&global::edit_distance::unbanded::aa27_01T, uint8_t>,
+        global_fixture<&global::edit_distance::unbanded::aa27_01T, uint64_t>,
+
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_01, uint8_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_01, uint64_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_01T, uint8_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_01T, uint64_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_02, uint8_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::dna4_02, uint64_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::aa27_01, uint8_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::aa27_01, uint64_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::aa27_01T, uint8_t>,
+        semi_global_fixture<&semi_global::edit_distance::unbanded::aa27_01T, uint64_t>
+    >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(full_band, edit_distance_banded, edit_distance_banded_types);
+
+// ----------------------------------------------------------------------------
+// narrow bands
+// ----------------------------------------------------------------------------
+
+template <typename config_t>
+auto align(std::vector<dna4> const & database, std::vector<dna4> const & query, config_t const & cfg)
+{
+    return *std::ranges::begin(align_pairwise(std::tie(database, query), cfg | align_cfg::result{with_alignment}));
+}
+
+template <typename alignment_t>
+std::string to_string(alignment_t && gapped_sequence)
+{
+    std::string str{};
+    for (char c : gapped_sequence | view::to_char)
+        str.push_back(c);
+    return str;
+}
+
+TEST(edit_distance_banded, global)
+{
+    std::vector database = "ACGTACGTACGTACGT"_dna4;
+    std::vector query = "ACGTACGACGTACGTT"_dna4;
+
+    for (auto cfg : {align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}},
+                     align_cfg::band{static_band{lower_bound{-2}, upper_bound{2}}}})
+    {
+        auto res = align(database, query, align_cfg::edit | cfg);
+        EXPECT_EQ(res.score(), -2);
+        EXPECT_EQ(res.front_coordinate(), (alignment_coordinate{column_index_type{0u}, row_index_type{0u}}));
+        EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{column_index_type{15u}, row_index_type{15u}}));
+        EXPECT_EQ(to_string(std::get<0>(res.alignment())), "ACGTACGTACGTACGT-");
+        EXPECT_EQ(to_string(std::get<1>(res.alignment())), "ACGTACG-ACGTACGTT");
+    }
+
+    // Only the main diagonal is allowed, hence no gaps can be placed.
+    auto res = align(database, query, align_cfg::edit | align_cfg::band{static_band{lower_bound{0}, upper_bound{0}}});
+    EXPECT_EQ(res.score(), -8);
+    EXPECT_EQ(to_string(std::get<0>(res.alignment())), "ACGTACGTACGTACGT");
+    EXPECT_EQ(to_string(std::get<1>(res.alignment())), "ACGTACGACGTACGTT");
+}
+
+TEST(edit_distance_banded, global_long_query)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTA"_dna4;
+
+    for (auto cfg : {align_cfg::band{static_band{lower_bound{-2}, upper_bound{8}}},
+                     align_cfg::band{static_band{lower_bound{-3}, upper_bound{7}}},
+                     align_cfg::band{static_band{lower_bound{0}, upper_bound{7}}}})
+    {
+        auto res = align(database, query, align_cfg::edit | cfg);
+        EXPECT_EQ(res.score(), -8);
+        EXPECT_EQ(res.front_coordinate(), (alignment_coordinate{column_index_type{0u}, row_index_type{0u}}));
+        EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{column_index_type{15u}, row_index_type{8u}}));
+        EXPECT_EQ(to_string(std::get<0>(res.alignment())), "AACCGGTTAACCGGTT");
+        EXPECT_EQ(to_string(std::get<1>(res.alignment())), "A-C-G-T-A-C-G-TA");
+    }
+}
+
+TEST(edit_distance_banded, semi_global)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTA"_dna4;
+    auto cfg = align_cfg::edit | align_cfg::aligned_ends{free_ends_first};
+
+    {
+        auto res = align(database, query, cfg | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}});
+        EXPECT_EQ(res.score(), -5);
+        EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{column_index_type{8u}, row_index_type{8u}}));
+        EXPECT_EQ(to_string(std::get<0>(res.alignment())), "ACCG--GTTA");
+        EXPECT_EQ(to_string(std::get<1>(res.alignment())), "ACGTACGT-A");
+    }
+
+    {
+        auto res = align(database, query, cfg | align_cfg::band{static_band{lower_bound{0}, upper_bound{2}}});
+        EXPECT_EQ(res.score(), -5);
+        EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{column_index_type{8u}, row_index_type{8u}}));
+        EXPECT_EQ(to_string(std::get<0>(res.alignment())), "ACCGGT--TA");
+        EXPECT_EQ(to_string(std::get<1>(res.alignment())), "AC-GTACGTA");
+    }
+}
+
+TEST(edit_distance_banded, invalid_band)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTA"_dna4;
+
+    auto run = [&] (auto const & cfg)
+    {
+        return align(database, query, cfg).score();
+    };
+
+    // The band does not contain the origin of the matrix.
+    EXPECT_THROW(run(align_cfg::edit | align_cfg::band{static_band{lower_bound{1}, upper_bound{8}}}),
+                 invalid_alignment_configuration);
+    EXPECT_THROW(run(align_cfg::edit | align_cfg::band{static_band{lower_bound{-5}, upper_bound{-1}}}),
+                 invalid_alignment_configuration);
+    // The band does not contain the sink of the matrix.
+    EXPECT_THROW(run(align_cfg::edit | align_cfg::band{static_band{lower_bound{-2}, upper_bound{6}}}),
+                 invalid_alignment_configuration);
+    // The band does not reach the last row of the matrix.
+    EXPECT_THROW(run(align_cfg::edit |
+                     align_cfg::aligned_ends{free_ends_first} |
+                     align_cfg::band{static_band{lower_bound{8}, upper_bound{10}}}),
+                 invalid_alignment_configuration);
+}
+
+// ----------------------------------------------------------------------------
+// bands spanning several machine words
+// ----------------------------------------------------------------------------
+
+std::vector<dna4> random_sequence(size_t const size, size_t const seed)
+{
+    std::mt19937 engine{seed};
+    std::uniform_int_distribution<uint8_t> rank_dist{0, 3};
+
+    std::vector<dna4> sequence(size);
+    for (auto & letter : sequence)
+        letter.assign_rank(rank_dist(engine));
+
+    return sequence;
+}
+
+// Returns a copy of the sequence with roughly `edit_rate` substitutions, insertions and deletions each.
+std::vector<dna4> mutate(std::vector<dna4> const & sequence, double const edit_rate, size_t const seed)
+{
+    std::mt19937 engine{seed};
+    std::uniform_int_distribution<uint8_t> rank_dist{0, 3};
+    std::uniform_real_distribution<double> edit_dist{0.0, 1.0};
+
+    std::vector<dna4> mutated{};
+    for (dna4 letter : sequence)
+    {
+        double const edit = edit_dist(engine);
+        if (edit < edit_rate) // substitution
+            mutated.push_back(dna4{}.assign_rank((letter.to_rank() + 1) % 4));
+        else if (edit < 2 * edit_rate) // deletion
+            continue;
+        else if (edit < 3 * edit_rate) // insertion
+            mutated.insert(mutated.end(), {letter, dna4{}.assign_rank(rank_dist(engine))});
+        else
+            mutated.push_back(letter);
+    }
+
+    return mutated;
+}
+
+// Computes the edit distance with a dynamic programming matrix whose cells outside of [lower, upper] are infinite.
+int banded_dp_score(std::vector<dna4> const & database,
+                    std::vector<dna4> const & query,
+                    int64_t const lower,
+                    int64_t const upper,
+                    bool const is_semi_global)
+{
+    int const inf = std::numeric_limits<int>::max() / 2;
+    auto in_band = [&] (int64_t const col, int64_t const row)
+    {
+        return col - row >= lower && col - row <= upper;
+    };
+
+    std::vector<int> column(query.size() + 1, inf);
+    for (size_t row = 0; row <= query.size(); ++row)
+        column[row] = in_band(0, row) ? row : inf;
+
+    int best = column.back();
+    for (size_t col = 1; col <= database.size(); ++col)
+    {
+        int diagonal = column[0];
+        column[0] = in_band(col, 0) ? (is_semi_global ? 0 : col) : inf;
+
+        for (size_t row = 1; row <= query.size(); ++row)
+        {
+            int const left = column[row];
+            int const score = std::min({diagonal + (database[col - 1] == query[row - 1] ? 0 : 1),
+                                        left + 1,
+                                        column[row - 1] + 1});
+            column[row] = in_band(col, row) ? score : inf;
+            diagonal = left;
+        }
+
+        best = is_semi_global ? std::min(best, column.back()) : column.back();
+    }
+
+    return best;
+}
+
+// Checks that the alignment has the given number of edits and that its path does not leave the band.
+template <typename alignment_t>
+void check_alignment(alignment_t const & alignment, int const expected_edits, int64_t const lower, int64_t const upper)
+{
+    auto && [gapped_database, gapped_query] = alignment.alignment();
+    ASSERT_EQ(std::ranges::size(gapped_database), std::ranges::size(gapped_query));
+
+    int64_t col = alignment.front_coordinate().first;
+    int64_t row = alignment.front_coordinate().second;
+    int edits = 0;
+    for (size_t i = 0; i < std::ranges::size(gapped_database); ++i)
+    {
+        bool const database_gap = gapped_database[i] == gap{};
+        bool const query_gap = gapped_query[i] == gap{};
+        ASSERT_FALSE(database_gap && query_gap);
+
+        col += !database_gap;
+        row += !query_gap;
+        edits += database_gap || query_gap || gapped_database[i] != gapped_query[i];
+        EXPECT_GE(col - row, lower);
+        EXPECT_LE(col - row, upper);
+    }
+
+    EXPECT_EQ(edits, expected_edits);
+}
+
+template <typename word_t>
+class edit_distance_banded_multi_block : public ::testing::Test
+{};
+
+using word_types = ::testing::Types<uint8_t, uint64_t>;
+TYPED_TEST_CASE(edit_distance_banded_multi_block, word_types);
+
+TYPED_TEST(edit_distance_banded_multi_block, global_equals_unbanded)
+{
+    using traits_t = test_traits_type<TypeParam, std::false_type>;
+
+    for (size_t seed = 0; seed < 5; ++seed)
+    {
+        std::vector<dna4> database = random_sequence(700, seed);
+        std::vector<dna4> query = mutate(database, 0.04, seed);
+
+        auto unbanded_cfg = align_cfg::edit;
+        auto unbanded = pairwise_alignment_edit_distance_unbanded<std::vector<dna4> &,
+                                                                  std::vector<dna4> &,
+                                                                  decltype(unbanded_cfg),
+                                                                  traits_t>{database, query, unbanded_cfg};
+        auto unbanded_result = alignment_result{detail::alignment_result_value_type{}};
+        unbanded(unbanded_result);
+        int64_t const distance = -unbanded.score();
+
+        // An alignment with `distance` edits never leaves the diagonals [-distance, distance].
+        ASSERT_GT(2 * distance + 1, 64);
+        auto cfg = align_cfg::edit | align_cfg::band{static_band{lower_bound{-distance}, upper_bound{distance}}};
+        auto banded = edit_distance<traits_t>(database, query, cfg);
+
+        EXPECT_EQ(banded.score(), unbanded.score());
+        check_alignment(banded, distance, -distance, distance);
+    }
+}
+
+TYPED_TEST(edit_distance_banded_multi_block, global_equals_banded_dp)
+{
+    using traits_t = test_traits_type<TypeParam, std::false_type>;
+
+    for (size_t seed = 0; seed < 3; ++seed)
+    {
+        // Unrelated sequences, such that the optimal alignment runs along the border of the band.
+        std::vector<dna4> database = random_sequence(600, seed);
+        std::vector<dna4> query = random_sequence(560, seed + 100);
+
+        for (auto [lower, upper] : {std::pair<int64_t, int64_t>{-30, 70},
+                                    std::pair<int64_t, int64_t>{-100, 40},
+                                    std::pair<int64_t, int64_t>{-65, 65},
+                                    std::pair<int64_t, int64_t>{0, 150}})
+        {
+            auto cfg = align_cfg::edit | align_cfg::band{static_band{lower_bound{lower}, upper_bound{upper}}};
+            auto banded = edit_distance<traits_t>(database, query, cfg);
+            int const expected = banded_dp_score(database, query, lower, upper, false);
+
+            EXPECT_EQ(banded.score(), -expected);
+            check_alignment(banded, expected, lower, upper);
+        }
+    }
+}
+
+TYPED_TEST(edit_distance_banded_multi_block, semi_global_equals_banded_dp)
+{
+    using traits_t = test_traits_type<TypeParam, std::true_type>;
+
+    for (size_t seed = 0; seed < 3; ++seed)
+    {
+        std::vector<dna4> database = random_sequence(800, seed);
+        std::vector<dna4> query = random_sequence(500, seed + 100);
+
+        for (auto [lower, upper] : {std::pair<int64_t, int64_t>{-40, 90},
+                                    std::pair<int64_t, int64_t>{-10, 320},
+                                    std::pair<int64_t, int64_t>{100, 250},
+                                    std::pair<int64_t, int64_t>{-70, 70}})
+        {
+            auto cfg = align_cfg::edit |
+                       align_cfg::aligned_ends{free_ends_first} |
+                       align_cfg::band{static_band{lower_bound{lower}, upper_bound{upper}}};
+            auto banded = edit_distance<traits_t>(database, query, cfg);
+            int const expected = banded_dp_score(database, query, lower, upper, true);
+
+            EXPECT_EQ(banded.score(), -expected);
+            check_alignment(banded, expected, lower, upper);
+        }
+    }
+}
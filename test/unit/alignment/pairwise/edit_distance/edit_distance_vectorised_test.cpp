@@ -0,0 +1,226 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+
+#include "../fixture/global_edit_distance_unbanded.hpp"
+#include "../fixture/semi_global_edit_distance_unbanded.hpp"
+
+using namespace seqan3;
+using namespace seqan3::detail;
+using namespace seqan3::test::alignment::fixture;
+
+template <auto _fixture>
+struct param : public ::testing::Test
+{
+    auto fixture() -> decltype(alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename param_t>
+class edit_distance_vectorised : public param_t
+{};
+
+TYPED_TEST_CASE_P(edit_distance_vectorised);
+
+using edit_distance_vectorised_types
+    = ::testing::Types<
+        param<&global::edit_distance::unbanded::dna4_01>,
+        param<&global::edit_distance::unbanded::dna4_01T>,
+        param<&global::edit_distance::unbanded::dna4_02>,
+        param<&global::edit_distance::unbanded::aa27_01>,
+        param<&global::edit_distance::unbanded::aa27_01T>,
+        param<&semi_global::edit_distance::unbanded::dna4_01>,
+        param<&semi_global::edit_distance::unbanded::dna4_01T>,
+        param<&semi_global::edit_distance::unbanded::dna4_02>,
+        param<&semi_global::edit_distance::unbanded::aa27_01>,
+        param<&semi_global::edit_distance::unbanded::aa27_01T>
+    >;
+
+TYPED_TEST_P(edit_distance_vectorised, score)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::vectorise;
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    // More pairs than lanes to cover multiple groups and a partially filled last group.
+    std::vector<std::pair<first_t, second_t>> sequences(211, {fixture.sequence1, fixture.sequence2});
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, align_cfg))
+    {
+        EXPECT_EQ(res.score(), fixture.score);
+        ++count;
+    }
+    EXPECT_EQ(count, sequences.size());
+}
+
+TYPED_TEST_P(edit_distance_vectorised, back_coordinate)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::result{with_back_coordinate} | align_cfg::vectorise;
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    std::vector<std::pair<first_t, second_t>> sequences(67, {fixture.sequence1, fixture.sequence2});
+
+    for (auto && res : align_pairwise(sequences, align_cfg))
+    {
+        EXPECT_EQ(res.score(), fixture.score);
+        EXPECT_EQ(res.back_coordinate(), fixture.back_coordinate);
+    }
+}
+
+TYPED_TEST_P(edit_distance_vectorised, different_queries)
+{
+    auto const & fixture = this->fixture();
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    // Align queries of different lengths against the same database sequence as well as against different database
+    // sequences, such that groups with a shared and with distinct database sequences are computed.
+    first_t database = fixture.sequence1;
+    second_t query = fixture.sequence2;
+
+    std::vector<std::pair<first_t, second_t>> sequences;
+    for (size_t j = 1; j <= query.size(); ++j)
+        sequences.emplace_back(database, second_t(query.begin(), query.begin() + j));
+
+    for (size_t i = 1; i <= database.size(); ++i)
+        sequences.emplace_back(first_t(database.begin(), database.begin() + i), query);
+
+    auto align_cfg = fixture.config | align_cfg::result{with_back_coordinate};
+
+    std::vector<std::pair<int32_t, alignment_coordinate>> expected;
+    for (auto && res : align_pairwise(sequences, align_cfg))
+        expected.emplace_back(res.score(), res.back_coordinate());
+
+    std::vector<std::pair<int32_t, alignment_coordinate>> vectorised;
+    for (auto && res : align_pairwise(sequences, align_cfg | align_cfg::vectorise))
+        vectorised.emplace_back(res.score(), res.back_coordinate());
+
+    EXPECT_EQ(vectorised, expected);
+}
+
+TYPED_TEST_P(edit_distance_vectorised, parallel)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::vectorise | align_cfg::parallel{4};
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    std::vector<std::pair<first_t, second_t>> sequences(1000, {fixture.sequence1, fixture.sequence2});
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, align_cfg))
+    {
+        EXPECT_EQ(res.score(), fixture.score);
+        ++count;
+    }
+    EXPECT_EQ(count, sequences.size());
+}
+
+REGISTER_TYPED_TEST_CASE_P(edit_distance_vectorised, score, back_coordinate, different_queries, parallel);
+
+INSTANTIATE_TYPED_TEST_CASE_P(vectorised, edit_distance_vectorised, edit_distance_vectorised_types);
+
+TEST(edit_distance_vectorised, long_queries)
+{
+    // Queries spanning several machine words.
+    std::vector database = "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"
+                           "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4;
+    std::vector query = "ACGTACGTACGTACGTACGAACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTTACGTACGTACGTACGTACGTAC"
+                        "ACGTACGTACGTACGTACGTACGTACGTCGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4;
+
+    std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences;
+    for (size_t j = 60; j <= query.size(); j += 7)
+        sequences.emplace_back(database, std::vector<dna4>(query.begin(), query.begin() + j));
+
+    auto run = [&] (auto const & align_cfg)
+    {
+        std::vector<std::pair<int32_t, alignment_coordinate>> expected;
+        for (auto && res : align_pairwise(sequences, align_cfg))
+            expected.emplace_back(res.score(), res.back_coordinate());
+
+        std::vector<std::pair<int32_t, alignment_coordinate>> vectorised;
+        for (auto && res : align_pairwise(sequences, align_cfg | align_cfg::vectorise))
+            vectorised.emplace_back(res.score(), res.back_coordinate());
+
+        EXPECT_EQ(vectorised, expected);
+    };
+
+    run(align_cfg::edit | align_cfg::result{with_back_coordinate});
+    run(align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::result{with_back_coordinate});
+}
+
+TEST(edit_distance_vectorised, empty_sequences)
+{
+    std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences{{"ACGT"_dna4, ""_dna4},
+                                                                           {""_dna4, "ACG"_dna4},
+                                                                           {""_dna4, ""_dna4},
+                                                                           {"ACGT"_dna4, "CG"_dna4}};
+
+    auto run = [&] (auto const & align_cfg)
+    {
+        std::vector<std::pair<int32_t, alignment_coordinate>> results;
+        for (auto && res : align_pairwise(sequences, align_cfg | align_cfg::vectorise))
+            results.emplace_back(res.score(), res.back_coordinate());
+        return results;
+    };
+
+    using column_t = column_index_type;
+    using row_t = row_index_type;
+    std::vector<std::pair<int32_t, alignment_coordinate>> const global_expected
+    {
+        {-4, alignment_coordinate{column_t{3u}, row_t{0u}}},
+        {-3, alignment_coordinate{column_t{0u}, row_t{2u}}},
+        { 0, alignment_coordinate{column_t{0u}, row_t{0u}}},
+        {-2, alignment_coordinate{column_t{3u}, row_t{1u}}}
+    };
+    EXPECT_EQ(run(align_cfg::edit | align_cfg::result{with_back_coordinate}), global_expected);
+
+    std::vector<std::pair<int32_t, alignment_coordinate>> const semi_global_expected
+    {
+        { 0, alignment_coordinate{column_t{3u}, row_t{0u}}},
+        {-3, alignment_coordinate{column_t{0u}, row_t{2u}}},
+        { 0, alignment_coordinate{column_t{0u}, row_t{0u}}},
+        { 0, alignment_coordinate{column_t{2u}, row_t{1u}}}
+    };
+    EXPECT_EQ(run(align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::result{with_back_coordinate}),
+              semi_global_expected);
+}
+
+TEST(edit_distance_vectorised, invalid_configuration)
+{
+    auto const & fixture = *global::edit_distance::unbanded::dna4_01;
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    EXPECT_THROW(align_pairwise(std::tie(database, query),
+                                fixture.config | align_cfg::vectorise | align_cfg::result{with_alignment}),
+                 invalid_alignment_configuration);
+
+    EXPECT_THROW(align_pairwise(std::tie(database, query),
+                                fixture.config | align_cfg::vectorise | align_cfg::result{with_front_coordinate}),
+                 invalid_alignment_configuration);
+}
@@ -64,6 +64,13 @@ auto edit_distance(database_t && database, query_t && query, align_cfg_t && alig
     return alignment;
 }
 
+// The score matrix, the trace matrix, the begin position and the alignment are only stored with the traceback.
+template <typename config_t>
+auto with_traceback(config_t const & cfg)
+{
+    return cfg | align_cfg::result{with_alignment};
+}
+
 TYPED_TEST_P(edit_distance_unbanded, score)
 {
     auto const & fixture = this->fixture();
@@ -74,12 +81,18 @@ TYPED_TEST_P(edit_distance_unbanded, score)
 
     auto alignment = edit_distance<typename TypeParam::traits_type>(database, query, align_cfg);
     EXPECT_EQ(alignment.score(), fixture.score);
+
+    // Without the traceback no column is stored.
+    auto storage = alignment.release_trace_storage();
+    EXPECT_TRUE(storage.vp.empty());
+    EXPECT_TRUE(storage.vn.empty());
+    EXPECT_EQ(storage.column_offsets.size(), 1u);
 }
 
 TYPED_TEST_P(edit_distance_unbanded, score_matrix)
 {
     auto const & fixture = this->fixture();
-    auto align_cfg = fixture.config;
+    auto align_cfg = with_traceback(fixture.config);
 
     std::vector database = fixture.sequence1;
     std::vector query = fixture.sequence2;
@@ -96,7 +109,7 @@ TYPED_TEST_P(edit_distance_unbanded, score_matrix)
 TYPED_TEST_P(edit_distance_unbanded, trace_matrix)
 {
     auto const & fixture = this->fixture();
-    auto align_cfg = fixture.config;
+    auto align_cfg = with_traceback(fixture.config);
 
     std::vector database = fixture.sequence1;
     std::vector query = fixture.sequence2;
@@ -126,7 +139,7 @@ TYPED_TEST_P(edit_distance_unbanded, back_coordinate)
 TYPED_TEST_P(edit_distance_unbanded, front_coordinate)
 {
     auto const & fixture = this->fixture();
-    auto align_cfg = fixture.config;
+    auto align_cfg = with_traceback(fixture.config);
 
     std::vector database = fixture.sequence1;
     std::vector query = fixture.sequence2;
@@ -140,7 +153,7 @@ TYPED_TEST_P(edit_distance_unbanded, front_coordinate)
 TYPED_TEST_P(edit_distance_unbanded, alignment)
 {
     auto const & fixture = this->fixture();
-    auto align_cfg = fixture.config;
+    auto align_cfg = with_traceback(fixture.config);
 
     std::vector database = fixture.sequence1;
     std::vector query = fixture.sequence2;
@@ -152,10 +165,44 @@ TYPED_TEST_P(edit_distance_unbanded, alignment)
     EXPECT_EQ(std::string{gapped_query | view::to_char}, fixture.aligned_sequence2);
 }
 
+TYPED_TEST_P(edit_distance_unbanded, reuse_trace_storage)
+{
+    using traits_t = typename TypeParam::traits_type;
+
+    auto const & fixture = this->fixture();
+    auto align_cfg = with_traceback(fixture.config);
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    using algorithm_t = pairwise_alignment_edit_distance_unbanded<decltype(database) &,
+                                                                  decltype(query) &,
+                                                                  decltype(align_cfg),
+                                                                  traits_t>;
+
+    // Compute a different alignment first and pass its storage to the second alignment.
+    std::vector reversed_query(query.rbegin(), query.rend());
+    auto first_result = alignment_result{detail::alignment_result_value_type{}};
+    auto first = pairwise_alignment_edit_distance_unbanded<decltype(database) &,
+                                                           decltype(reversed_query) &,
+                                                           decltype(align_cfg),
+                                                           traits_t>{database, reversed_query, align_cfg};
+    first(first_result);
+
+    auto result = alignment_result{detail::alignment_result_value_type{}};
+    auto alignment = algorithm_t{database, query, align_cfg, traits_t{}, first.release_trace_storage()};
+    alignment(result);
+
+    EXPECT_EQ(alignment.score(), fixture.score);
+    EXPECT_EQ(alignment.score_matrix(), fixture.score_matrix());
+    EXPECT_EQ(alignment.trace_matrix(), fixture.trace_matrix());
+}
+
 REGISTER_TYPED_TEST_CASE_P(edit_distance_unbanded,
                            score,
                            score_matrix,
                            trace_matrix,
                            back_coordinate,
                            front_coordinate,
-                           alignment);
+                           alignment,
+                           reuse_trace_storage);
@@ -0,0 +1,147 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/execution/alignment_executor_two_way.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
+
+using namespace seqan3;
+
+struct dummy_alignment
+{
+    using result_type = size_t;
+
+    template <typename first_seq_t, typename second_seq_t>
+    size_t operator()(first_seq_t && first_seq, second_seq_t && second_seq) const
+    {
+        return first_seq.size() * 1000 + second_seq.size();
+    }
+};
+
+struct counting_alignment : dummy_alignment
+{
+    counting_alignment() = default;
+    counting_alignment(counting_alignment const &) : dummy_alignment{} { ++copies; }
+    counting_alignment & operator=(counting_alignment const &) = default;
+
+    inline static std::atomic<size_t> copies{0};
+};
+
+TEST(execution_handler_parallel, construction)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<detail::execution_handler_parallel>);
+    EXPECT_TRUE(std::is_move_constructible_v<detail::execution_handler_parallel>);
+    EXPECT_FALSE(std::is_copy_assignable_v<detail::execution_handler_parallel>);
+    EXPECT_TRUE(std::is_move_assignable_v<detail::execution_handler_parallel>);
+
+    detail::execution_handler_parallel handler{4};
+    EXPECT_EQ(handler.thread_count(), 4u);
+
+    detail::execution_handler_parallel handler_default{0};
+    EXPECT_GE(handler_default.thread_count(), 1u);
+}
+
+TEST(execution_handler_parallel, execute)
+{
+    std::vector<std::string> first(1000);
+    std::vector<std::string> second(1000);
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        first[i] = std::string(i % 17, 'A');
+        second[i] = std::string(i % 31, 'C');
+    }
+
+    std::vector<size_t> results(first.size(), 0);
+    detail::execution_handler_parallel handler{4};
+    for (size_t i = 0; i < first.size(); ++i)
+        handler.execute(dummy_alignment{}, first[i], second[i], [&results, i] (size_t res) { results[i] = res; });
+
+    handler.wait();
+
+    for (size_t i = 0; i < first.size(); ++i)
+        EXPECT_EQ(results[i], (i % 17) * 1000 + (i % 31));
+}
+
+TEST(execution_handler_parallel, lvalue_callables_are_not_copied)
+{
+    std::string first{"ACGT"};
+    std::string second{"AC"};
+    std::vector<size_t> results(100, 0);
+    std::vector<size_t> worker_indices(results.size(), 0);
+    counting_alignment alignment{};
+
+    detail::execution_handler_parallel handler{4};
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        handler.execute(alignment, first, second, [&, i] (size_t res)
+        {
+            results[i] = res;
+            worker_indices[i] = handler.worker_index();
+        });
+    }
+
+    handler.wait();
+
+    EXPECT_EQ(counting_alignment::copies.load(), 0u);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i], 4002u);
+        EXPECT_LT(worker_indices[i], handler.thread_count());
+    }
+}
+
+TEST(execution_handler_parallel, worker_index_of_non_workers)
+{
+    std::string seq{"ACGT"};
+    detail::execution_handler_parallel handler{2};
+    detail::execution_handler_parallel other{3};
+
+    // The calling thread is not a worker.
+    EXPECT_EQ(handler.worker_index(), handler.thread_count());
+
+    // A worker of another handler is not a worker of this handler.
+    size_t index_in_other{0};
+    other.execute([] (std::string & s, std::string &) { return s.size(); },
+                  seq, seq,
+                  [&] (size_t) { index_in_other = handler.worker_index(); });
+    other.wait();
+
+    EXPECT_EQ(index_in_other, handler.thread_count());
+}
+
+TEST(execution_handler_parallel, exception)
+{
+    std::string seq{"ACGT"};
+    detail::execution_handler_parallel handler{2};
+    handler.execute([] (std::string &, std::string &) -> size_t { throw std::runtime_error{"error"}; },
+                    seq, seq, [] (size_t) {});
+
+    EXPECT_THROW(handler.wait(), std::runtime_error);
+    EXPECT_NO_THROW(handler.wait()); // the exception was consumed
+}
+
+TEST(execution_handler_parallel, executor_preserves_order)
+{
+    std::vector<std::tuple<std::string, std::string>> collection{};
+    for (size_t i = 0; i < 500; ++i)
+        collection.emplace_back(std::string(i % 23, 'A'), std::string(i % 11, 'C'));
+
+    std::function<size_t(std::string &, std::string &)> fn{dummy_alignment{}};
+    detail::alignment_executor_two_way exec{collection, fn, detail::execution_handler_parallel{4}};
+
+    for (size_t i = 0; i < collection.size(); ++i)
+        EXPECT_EQ(exec.bump().value(), (i % 23) * 1000 + (i % 11));
+
+    EXPECT_FALSE(static_cast<bool>(exec.bump()));
+}
@@ -0,0 +1,318 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include <seqan3/alignment/configuration/align_config_linear_traceback.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/linear_memory_traceback.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/range/view/to_char.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+
+using namespace seqan3;
+using namespace seqan3::detail;
+using namespace seqan3::test::alignment::fixture;
+
+template <auto _fixture>
+struct param : public ::testing::Test
+{
+    auto fixture() -> decltype(alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename param_t>
+class linear_traceback : public param_t
+{};
+
+TYPED_TEST_CASE_P(linear_traceback);
+
+using linear_traceback_types
+    = ::testing::Types<
+        param<&global::affine::unbanded::dna4_01>,
+        param<&global::affine::unbanded::dna4_02>,
+        param<&semi_global::affine::unbanded::dna4_01>,
+        param<&semi_global::affine::unbanded::dna4_02>,
+        param<&semi_global::affine::unbanded::dna4_03>,
+        param<&semi_global::affine::unbanded::dna4_04>,
+        param<&local::affine::unbanded::dna4_01>,
+        param<&local::affine::unbanded::dna4_02>,
+        param<&local::affine::unbanded::dna4_03>,
+        param<&local::affine::unbanded::dna4_04>,
+        param<&local::affine::unbanded::dna4_05>,
+        param<&local::affine::unbanded::rna5_01>,
+        param<&local::affine::unbanded::aa27_01>,
+        param<&local::affine::unbanded::aa27_02>
+    >;
+
+// Recomputes the score of the computed alignment, since co-optimal alignments might be chosen differently.
+template <typename first_alphabet_t, typename second_alphabet_t, typename config_t, typename alignment_t>
+int32_t score_alignment(config_t const & config, alignment_t const & alignment)
+{
+    auto const & scheme = get<align_cfg::scoring>(config).value;
+    auto const & gaps = get<align_cfg::gap>(config).value;
+
+    std::string first{};
+    for (char c : std::get<0>(alignment) | view::to_char)
+        first.push_back(c);
+
+    std::string second{};
+    for (char c : std::get<1>(alignment) | view::to_char)
+        second.push_back(c);
+
+    EXPECT_EQ(first.size(), second.size());
+
+    int32_t score = 0;
+    bool in_first_gap = false;
+    bool in_second_gap = false;
+    for (size_t i = 0; i < std::min(first.size(), second.size()); ++i)
+    {
+        if (first[i] == '-')
+        {
+            score += gaps.get_gap_score() + (in_first_gap ? 0 : gaps.get_gap_open_score());
+            in_first_gap = true;
+            in_second_gap = false;
+        }
+        else if (second[i] == '-')
+        {
+            score += gaps.get_gap_score() + (in_second_gap ? 0 : gaps.get_gap_open_score());
+            in_first_gap = false;
+            in_second_gap = true;
+        }
+        else
+        {
+            score += scheme.score(first_alphabet_t{}.assign_char(first[i]), second_alphabet_t{}.assign_char(second[i]));
+            in_first_gap = false;
+            in_second_gap = false;
+        }
+    }
+
+    return score;
+}
+
+template <typename fixture_t, typename alignment_t>
+int32_t score_alignment(fixture_t const & fixture, alignment_t const & alignment)
+{
+    return score_alignment<value_type_t<decltype(fixture.sequence1)>,
+                           value_type_t<decltype(fixture.sequence2)>>(fixture.config, alignment);
+}
+
+TYPED_TEST_P(linear_traceback, trace)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::result{with_alignment} | align_cfg::linear_traceback{0};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment = align_pairwise(std::tie(database, query), align_cfg);
+
+    auto res = *std::ranges::begin(alignment);
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.back_coordinate(), fixture.back_coordinate);
+    EXPECT_EQ(score_alignment(fixture, res.alignment()), fixture.score);
+
+    // The aligned sequences cover the infixes between the front and the back coordinate.
+    size_t first_letters = 0;
+    for (char c : std::get<0>(res.alignment()) | view::to_char)
+        first_letters += (c != '-');
+    size_t second_letters = 0;
+    for (char c : std::get<1>(res.alignment()) | view::to_char)
+        second_letters += (c != '-');
+
+    EXPECT_EQ(first_letters, res.back_coordinate().first - res.front_coordinate().first);
+    EXPECT_EQ(second_letters, res.back_coordinate().second - res.front_coordinate().second);
+}
+
+TYPED_TEST_P(linear_traceback, begin_position)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::result{with_front_coordinate} | align_cfg::linear_traceback{0};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment = align_pairwise(std::tie(database, query), align_cfg);
+
+    auto res = *std::ranges::begin(alignment);
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.back_coordinate(), fixture.back_coordinate);
+    EXPECT_LE(res.front_coordinate().first, res.back_coordinate().first);
+    EXPECT_LE(res.front_coordinate().second, res.back_coordinate().second);
+}
+
+TYPED_TEST_P(linear_traceback, above_threshold)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::result{with_alignment} | align_cfg::linear_traceback{1'000'000};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    // The matrix is smaller than the threshold, so the full traceback is computed.
+    auto res = *std::ranges::begin(align_pairwise(std::tie(database, query), align_cfg));
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.front_coordinate(), fixture.front_coordinate);
+    EXPECT_EQ(res.back_coordinate(), fixture.back_coordinate);
+    EXPECT_TRUE(ranges::equal(get<0>(res.alignment()) | view::to_char, fixture.aligned_sequence1));
+    EXPECT_TRUE(ranges::equal(get<1>(res.alignment()) | view::to_char, fixture.aligned_sequence2));
+}
+
+REGISTER_TYPED_TEST_CASE_P(linear_traceback, trace, begin_position, above_threshold);
+
+INSTANTIATE_TYPED_TEST_CASE_P(affine_unbanded, linear_traceback, linear_traceback_types);
+
+// ----------------------------------------------------------------------------
+// divide and conquer with small sub-problems
+// ----------------------------------------------------------------------------
+
+// Inserts the gap segments into the infix [begin, end) of the sequence.
+template <typename sequence_t, typename segments_t>
+auto insert_gaps(sequence_t const & sequence, size_t const begin, size_t const end, segments_t const & segments)
+{
+    std::vector<gapped<value_type_t<sequence_t>>> aligned(sequence.begin() + begin, sequence.begin() + end);
+
+    size_t offset = 0;
+    for (auto const & segment : segments)
+    {
+        aligned.insert(aligned.begin() + (segment.position - begin) + offset, segment.size, gap{});
+        offset += segment.size;
+    }
+
+    return aligned;
+}
+
+// Computes the traceback with the given sub-problem size and compares it with the traceback over the full matrix.
+template <typename config_t>
+auto check_small_base_case(std::vector<dna4> const & database,
+                           std::vector<dna4> const & query,
+                           config_t const & config,
+                           size_t const base_case_cells)
+{
+    auto full_config = config | align_cfg::result{with_alignment};
+    auto full = *std::ranges::begin(align_pairwise(std::tie(database, query), full_config));
+
+    auto const & scheme = get<align_cfg::scoring>(config).value;
+    auto const & gaps = get<align_cfg::gap>(config).value;
+    auto align_ends = config.template value_or<align_cfg::aligned_ends>(free_ends_none);
+    constexpr bool is_local = config_t::template exists<align_cfg::mode<detail::local_alignment_type>>();
+
+    affine_linear_memory_traceback<remove_cvref_t<decltype(scheme)>, int32_t>
+        traceback{scheme, gaps.get_gap_open_score() + gaps.get_gap_score(), gaps.get_gap_score(), base_case_cells};
+    auto back = full.back_coordinate();
+    auto [front, database_segments, query_segments] = traceback(database, query, back,
+                                                                is_local || align_ends[0],
+                                                                is_local || align_ends[2],
+                                                                is_local);
+
+    auto alignment = std::tuple{insert_gaps(database, front.first, back.first, database_segments),
+                                insert_gaps(query, front.second, back.second, query_segments)};
+
+    EXPECT_EQ((score_alignment<dna4, dna4>(config, alignment)), full.score());
+    EXPECT_EQ((score_alignment<dna4, dna4>(config, full.alignment())), full.score());
+    return alignment;
+}
+
+template <typename alignment_t>
+std::pair<std::string, std::string> to_strings(alignment_t const & alignment)
+{
+    std::string first{};
+    for (char c : std::get<0>(alignment) | view::to_char)
+        first.push_back(c);
+
+    std::string second{};
+    for (char c : std::get<1>(alignment) | view::to_char)
+        second.push_back(c);
+
+    return {first, second};
+}
+
+inline constexpr auto affine_config = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                      align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                   mismatch_score{-5}}};
+
+// The middle column of the matrix and of most sub-problems lies within the gap over the Gs, so the alignment is split
+// inside of a gap.
+TEST(linear_traceback_split, global_split_in_gap)
+{
+    std::vector database = "ACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTA"_dna4;
+    std::vector query = "ACGTTGCAACTTGACCAGTA"_dna4;
+    auto config = align_cfg::mode{global_alignment} | affine_config;
+
+    for (size_t base_case_cells : {0u, 4u, 16u, 64u})
+    {
+        auto [first, second] = to_strings(check_small_base_case(database, query, config, base_case_cells));
+        EXPECT_EQ(first, "ACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTA");
+        EXPECT_EQ(second, "ACGTTGCAAC----------------TTGACCAGTA");
+    }
+}
+
+TEST(linear_traceback_split, semi_global_split_in_gap)
+{
+    std::vector database = "TTTTTACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTACCCCC"_dna4;
+    std::vector query = "ACGTTGCAACTTGACCAGTA"_dna4;
+    auto config = align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_first} | affine_config;
+
+    for (size_t base_case_cells : {0u, 4u, 16u, 64u})
+    {
+        auto [first, second] = to_strings(check_small_base_case(database, query, config, base_case_cells));
+        EXPECT_EQ(first, "ACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTA");
+        EXPECT_EQ(second, "ACGTTGCAAC----------------TTGACCAGTA");
+    }
+}
+
+TEST(linear_traceback_split, local_split_in_gap)
+{
+    std::vector database = "TTTTTTTTACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTATTTTTTTT"_dna4;
+    std::vector query = "CCCCACGTTGCAACTTGACCAGTACCCC"_dna4;
+    auto config = align_cfg::mode{local_alignment} | affine_config;
+
+    for (size_t base_case_cells : {0u, 4u, 16u, 64u})
+    {
+        auto [first, second] = to_strings(check_small_base_case(database, query, config, base_case_cells));
+        EXPECT_EQ(first, "ACGTTGCAACGGGGGGGGGGGGGGGGTTGACCAGTA");
+        EXPECT_EQ(second, "ACGTTGCAAC----------------TTGACCAGTA");
+    }
+}
+
+TEST(linear_traceback_split, random_sequences)
+{
+    std::mt19937 engine{0};
+    std::uniform_int_distribution<uint8_t> rank_dist{0, 3};
+    auto random_sequence = [&] (size_t const size)
+    {
+        std::vector<dna4> sequence(size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank_dist(engine));
+        return sequence;
+    };
+
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::vector<dna4> database = random_sequence(40 + i);
+        std::vector<dna4> query = random_sequence(30 + 2 * i);
+
+        for (size_t base_case_cells : {0u, 8u, 32u})
+        {
+            check_small_base_case(database, query, align_cfg::mode{global_alignment} | affine_config, base_case_cells);
+            check_small_base_case(database, query,
+                                  align_cfg::mode{global_alignment} |
+                                  align_cfg::aligned_ends{free_ends_first} |
+                                  affine_config,
+                                  base_case_cells);
+            check_small_base_case(database, query, align_cfg::mode{local_alignment} | affine_config, base_case_cells);
+        }
+    }
+}
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+
+using namespace seqan3;
+using namespace seqan3::detail;
+using namespace seqan3::test::alignment::fixture;
+
+template <auto _fixture>
+struct param : public ::testing::Test
+{
+    auto fixture() -> decltype(alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename param_t>
+class vectorised_affine_unbanded : public param_t
+{};
+
+TYPED_TEST_CASE_P(vectorised_affine_unbanded);
+
+using vectorised_affine_unbanded_types
+    = ::testing::Types<
+        param<&global::affine::unbanded::dna4_01>,
+        param<&global::affine::unbanded::dna4_02>,
+        param<&local::affine::unbanded::dna4_01>,
+        param<&local::affine::unbanded::dna4_02>,
+        param<&local::affine::unbanded::dna4_03>,
+        param<&local::affine::unbanded::dna4_04>,
+        param<&local::affine::unbanded::dna4_05>,
+        param<&local::affine::unbanded::rna5_01>,
+        param<&local::affine::unbanded::aa27_01>,
+        param<&local::affine::unbanded::aa27_02>
+    >;
+
+TYPED_TEST_P(vectorised_affine_unbanded, score)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::vectorise;
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    // More pairs than lanes to cover multiple groups and a partially filled last group.
+    std::vector<std::pair<first_t, second_t>> sequences(211, {fixture.sequence1, fixture.sequence2});
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, align_cfg))
+    {
+        EXPECT_EQ(res.score(), fixture.score);
+        ++count;
+    }
+    EXPECT_EQ(count, sequences.size());
+}
+
+TYPED_TEST_P(vectorised_affine_unbanded, different_lengths)
+{
+    auto const & fixture = this->fixture();
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    // Pack sequence pairs of different lengths, including empty sequences, into the same groups.
+    std::vector<std::pair<first_t, second_t>> sequences;
+    for (size_t i = 0; i <= std::ranges::size(fixture.sequence1); ++i)
+    {
+        for (size_t j = 0; j <= std::ranges::size(fixture.sequence2); j += 3)
+        {
+            sequences.emplace_back(first_t(std::ranges::begin(fixture.sequence1),
+                                           std::ranges::begin(fixture.sequence1) + i),
+                                   second_t(std::ranges::begin(fixture.sequence2),
+                                            std::ranges::begin(fixture.sequence2) + j));
+        }
+    }
+
+    std::vector<int32_t> expected;
+    for (auto && res : align_pairwise(sequences, fixture.config))
+        expected.push_back(res.score());
+
+    std::vector<int32_t> vectorised;
+    for (auto && res : align_pairwise(sequences, fixture.config | align_cfg::vectorise))
+        vectorised.push_back(res.score());
+
+    EXPECT_EQ(vectorised, expected);
+}
+
+TYPED_TEST_P(vectorised_affine_unbanded, parallel)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | align_cfg::vectorise | align_cfg::parallel{4};
+
+    using first_t = std::vector<value_type_t<decltype(fixture.sequence1)>>;
+    using second_t = std::vector<value_type_t<decltype(fixture.sequence2)>>;
+
+    std::vector<std::pair<first_t, second_t>> sequences(1000, {fixture.sequence1, fixture.sequence2});
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, align_cfg))
+    {
+        EXPECT_EQ(res.score(), fixture.score);
+        ++count;
+    }
+    EXPECT_EQ(count, sequences.size());
+}
+
+REGISTER_TYPED_TEST_CASE_P(vectorised_affine_unbanded, score, different_lengths, parallel);
+
+INSTANTIATE_TYPED_TEST_CASE_P(vectorised, vectorised_affine_unbanded, vectorised_affine_unbanded_types);
+
+TEST(vectorised_affine_unbanded, invalid_configuration)
+{
+    auto const & fixture = *global::affine::unbanded::dna4_01;
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    EXPECT_THROW(align_pairwise(std::tie(database, query),
+                                fixture.config | align_cfg::vectorise | align_cfg::result{with_alignment}),
+                 invalid_alignment_configuration);
+
+    EXPECT_THROW(align_pairwise(std::tie(database, query),
+                                fixture.config | align_cfg::vectorise | align_cfg::aligned_ends{free_ends_all}),
+                 invalid_alignment_configuration);
+}
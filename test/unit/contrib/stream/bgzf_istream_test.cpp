@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+using namespace seqan3;
+
+template <>
+class istream<contrib::bgzf_istream> : public ::testing::Test
+{
+public:
+    static inline std::string compressed
+    {
+        '\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00',
+        '\x45','\x00','\x0B','\xC9','\x48','\x55','\x28','\x2C','\xCD','\x4C','\xCE','\x56','\x48','\x2A','\xCA','\x2F',
+        '\xCF','\x53','\x48','\xCB','\xAF','\x50','\xC8','\x2A','\xCD','\x2D','\x28','\x56','\xC8','\x2F','\x4B','\x2D',
+        '\x52','\x28','\x01','\x4A','\xE7','\x24','\x56','\x55','\x2A','\xA4','\xE4','\xA7','\x03','\x00','\x39','\xA3',
+        '\x4F','\x41','\x2B','\x00','\x00','\x00','\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF',
+        '\x06','\x00','\x42','\x43','\x02','\x00','\x1B','\x00','\x03','\x00','\x00','\x00','\x00','\x00','\x00','\x00',
+        '\x00','\x00'
+    };
+};
+
+using test_types = ::testing::Types<contrib::bgzf_istream>;
+
+INSTANTIATE_TYPED_TEST_CASE_P(contrib_streams, istream, test_types);
+
+class bgzf_istream_f : public ::testing::Test
+{
+public:
+    bgzf_istream_f()
+    {
+        for (size_t i = 0; i < 1000000; ++i)
+            data.push_back("ACGT\n@+!"[(i * 7919 + i / 13) % 8]);
+
+        std::ostringstream out{};
+        {
+            contrib::bgzf_ostream bgzf_out{out, 1};
+            bgzf_out << data;
+        }
+        compressed = out.str();
+    }
+
+    std::string data{};
+    std::string compressed{};
+};
+
+TEST_F(bgzf_istream_f, multiple_blocks)
+{
+    for (size_t thread_count : {1, 4})
+    {
+        std::istringstream in{compressed};
+        contrib::bgzf_istream decompressed{in, thread_count};
+        EXPECT_FALSE(decompressed.rdbuf()->is_serial());
+
+        std::string buffer{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(buffer, data);
+    }
+}
+
+TEST_F(bgzf_istream_f, set_thread_count)
+{
+    std::istringstream in{compressed};
+    contrib::bgzf_istream decompressed{in};
+    EXPECT_EQ(decompressed.rdbuf()->thread_count(), 0u);
+
+    std::string buffer(data.size(), '\0');
+    decompressed.read(buffer.data(), 200000);
+    decompressed.rdbuf()->set_thread_count(4);
+    EXPECT_EQ(decompressed.rdbuf()->thread_count(), 4u);
+    decompressed.read(buffer.data() + 200000, 300000);
+    decompressed.rdbuf()->set_thread_count(1); // the blocks read ahead are returned first
+    EXPECT_EQ(decompressed.rdbuf()->thread_count(), 0u);
+    decompressed.read(buffer.data() + 500000, data.size() - 500000);
+
+    EXPECT_EQ(buffer, data);
+    EXPECT_EQ(decompressed.get(), std::char_traits<char>::eof());
+}
+
+TEST_F(bgzf_istream_f, seek)
+{
+    for (size_t thread_count : {1, 4})
+    {
+        std::istringstream in{compressed};
+        contrib::bgzf_istream decompressed{in, thread_count};
+
+        // remember the virtual offsets of some positions while reading
+        std::vector<std::pair<std::streampos, size_t>> positions{};
+        std::string buffer(100000, '\0');
+        for (size_t position = 0; position + buffer.size() <= data.size(); position += buffer.size())
+        {
+            positions.emplace_back(decompressed.tellg(), position);
+            ASSERT_TRUE(decompressed.read(buffer.data(), buffer.size()));
+        }
+
+        for (auto it = positions.rbegin(); it != positions.rend(); ++it)
+        {
+            ASSERT_TRUE(decompressed.seekg(it->first));
+            EXPECT_EQ(decompressed.tellg(), it->first);
+            ASSERT_TRUE(decompressed.read(buffer.data(), 1000));
+            EXPECT_EQ(buffer.substr(0, 1000), data.substr(it->second, 1000));
+        }
+
+        // the first block starts at offset 0, the second at its compressed size
+        ASSERT_TRUE(decompressed.seekg(std::streampos{5}));
+        EXPECT_EQ(decompressed.get(), data[5]);
+        size_t const second_block = static_cast<unsigned char>(compressed[16]) +
+                                    (static_cast<unsigned char>(compressed[17]) << 8) + 1;
+        ASSERT_TRUE(decompressed.seekg(std::streampos(second_block << 16)));
+        EXPECT_EQ(decompressed.get(), data[contrib::bgzf_max_block_data_size]);
+
+        // an offset behind the end of a block
+        EXPECT_FALSE(decompressed.seekg(std::streampos(0xffff)));
+    }
+}
+
+TEST(bgzf_istream, plain_gzip)
+{
+    std::string data(100000, 'A');
+    std::ostringstream out{};
+    {
+        contrib::gz_ostream gz_out{out};
+        gz_out << data;
+    }
+
+    std::istringstream in{out.str()};
+    contrib::bgzf_istream decompressed{in, 4};
+    EXPECT_TRUE(decompressed.rdbuf()->is_serial());
+
+    std::string buffer{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(buffer, data);
+    EXPECT_EQ(decompressed.tellg(), std::streampos(-1)); // no virtual offsets
+}
+
+TEST_F(bgzf_istream_f, corrupt_block)
+{
+    compressed[compressed.size() / 2] ^= 0x55;
+
+    for (size_t thread_count : {1, 4})
+    {
+        std::istringstream in{compressed};
+        contrib::bgzf_istream decompressed{in, thread_count};
+
+        std::string buffer(data.size(), '\0');
+        EXPECT_FALSE(decompressed.read(buffer.data(), buffer.size()));
+        EXPECT_TRUE(decompressed.bad());
+    }
+}
@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#include <seqan3/contrib/stream/gz_istream.hpp>
+
+#include "../../io/stream/ostream_test_template.hpp"
+
+using namespace seqan3;
+
+template <>
+class ostream<contrib::bgzf_ostream> : public ::testing::Test
+{
+public:
+    static inline std::string compressed
+    {
+        '\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00',
+        '\x45','\x00','\x0B','\xC9','\x48','\x55','\x28','\x2C','\xCD','\x4C','\xCE','\x56','\x48','\x2A','\xCA','\x2F',
+        '\xCF','\x53','\x48','\xCB','\xAF','\x50','\xC8','\x2A','\xCD','\x2D','\x28','\x56','\xC8','\x2F','\x4B','\x2D',
+        '\x52','\x28','\x01','\x4A','\xE7','\x24','\x56','\x55','\x2A','\xA4','\xE4','\xA7','\x03','\x00','\x39','\xA3',
+        '\x4F','\x41','\x2B','\x00','\x00','\x00','\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF',
+        '\x06','\x00','\x42','\x43','\x02','\x00','\x1B','\x00','\x03','\x00','\x00','\x00','\x00','\x00','\x00','\x00',
+        '\x00','\x00'
+    };
+};
+
+using test_types = ::testing::Types<contrib::bgzf_ostream>;
+
+INSTANTIATE_TYPED_TEST_CASE_P(contrib_streams, ostream, test_types);
+
+TEST(bgzf_ostream, multiple_blocks)
+{
+    std::string data{};
+    for (size_t i = 0; i < 1000000; ++i)
+        data.push_back("ACGT\n@+!"[(i * 7919 + i / 13) % 8]);
+
+    std::string output[2]{};
+    size_t const thread_count[2]{1, 4};
+    for (size_t t = 0; t < 2; ++t)
+    {
+        std::ostringstream out{};
+        {
+            contrib::bgzf_ostream bgzf_out{out, thread_count[t]};
+            bgzf_out << data.substr(0, 300000) << std::flush; // flushing ends the block
+            bgzf_out << data.substr(300000);
+        }
+        output[t] = out.str();
+    }
+
+    EXPECT_EQ(output[0], output[1]); // the threads do not change the output
+
+    // every block has the BGZF header and ends before the next one
+    size_t blocks = 0;
+    for (size_t pos = 0; pos < output[0].size(); ++blocks)
+    {
+        ASSERT_EQ(output[0].substr(pos, 4), (std::string{'\x1f', '\x8b', '\x08', '\x04'}));
+        ASSERT_EQ(output[0].substr(pos + 12, 2), "BC");
+        size_t const block_size = static_cast<unsigned char>(output[0][pos + 16]) +
+                                  (static_cast<unsigned char>(output[0][pos + 17]) << 8) + 1;
+        pos += block_size;
+    }
+    EXPECT_EQ(blocks, 300000 / contrib::bgzf_max_block_data_size + 1 + 700000 / contrib::bgzf_max_block_data_size + 1
+                      + 1); // including the end-of-file marker
+    EXPECT_TRUE(std::equal(contrib::bgzf_eof_marker.begin(), contrib::bgzf_eof_marker.end(),
+                           output[0].end() - contrib::bgzf_eof_marker.size()));
+
+    std::istringstream in{output[1]};
+    contrib::gz_istream decompressed{in};
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}}), data);
+}
+
+TEST(bgzf_ostream, set_thread_count)
+{
+    std::string data{};
+    for (size_t i = 0; i < 1000000; ++i)
+        data.push_back("ACGT\n@+!"[(i * 7919 + i / 13) % 8]);
+
+    std::ostringstream serial_out{};
+    {
+        contrib::bgzf_ostream bgzf_out{serial_out};
+        EXPECT_EQ(bgzf_out.rdbuf()->thread_count(), 0u);
+        bgzf_out << data;
+    }
+
+    std::ostringstream out{};
+    {
+        contrib::bgzf_ostream bgzf_out{out};
+        bgzf_out << data.substr(0, 200000);
+        bgzf_out.rdbuf()->set_thread_count(4);
+        EXPECT_EQ(bgzf_out.rdbuf()->thread_count(), 4u);
+        bgzf_out << data.substr(200000, 500000);
+        bgzf_out.rdbuf()->set_thread_count(1);
+        EXPECT_EQ(bgzf_out.rdbuf()->thread_count(), 0u);
+        bgzf_out << data.substr(700000);
+    }
+
+    EXPECT_EQ(out.str(), serial_out.str()); // the block boundaries do not depend on the thread count
+}
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <fstream>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -19,6 +20,9 @@
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/std/iterator>
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/gz_istream.hpp>
+#endif
 
 using namespace seqan3;
 
@@ -194,7 +198,7 @@ void row_wise_impl(fn_t fn)
         fn(fout, i);
 
     fout.get_stream().flush();
-    EXPECT_EQ(fout.get_stream().str(), output_comp);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), output_comp);
 }
 
 template <typename source_t>
@@ -205,7 +209,7 @@ void assign_impl(source_t && source)
     fout = source;
 
     fout.get_stream().flush();
-    EXPECT_EQ(fout.get_stream().str(), output_comp);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), output_comp);
 }
 
 // ----------------------------------------------------------------------------
@@ -335,7 +339,7 @@ TEST(row, different_fields_in_record_and_file)
         "read2\t0\t*\t0\t0\t*\t*\t0\t0\tAGGCTGNAGGCTGNA\t!!!!!!!!!!!!!!!\n"
     };
 
-    EXPECT_EQ(fout.get_stream().str(), expected_out);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected_out);
 }
 
 TEST(row, print_header_in_file)
@@ -361,7 +365,7 @@ TEST(row, print_header_in_file)
         "read1\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\n" // empty read
     };
 
-    EXPECT_EQ(fout.get_stream().str(), expected_out);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected_out);
 }
 
 TEST(row, print_header_in_record)
@@ -392,7 +396,7 @@ TEST(row, print_header_in_record)
             "*\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\n" // empty read
         };
 
-        EXPECT_EQ(fout.get_stream().str(), expected_out);
+        EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected_out);
     }
 
     // file header present but record header pointer is favoured
@@ -415,7 +419,7 @@ TEST(row, print_header_in_record)
             "*\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\n" // empty read
         };
 
-        EXPECT_EQ(fout.get_stream().str(), expected_out);
+        EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected_out);
     }
 }
 
@@ -475,7 +479,7 @@ read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
 
     fout.get_stream().flush();
 
-    EXPECT_EQ(fout.get_stream().str(), comp);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), comp);
 }
 
 TEST(rows, assign_alignment_file_pipes)
@@ -500,10 +504,42 @@ read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
 
     fout.get_stream().flush();
 
-    EXPECT_EQ(fout.get_stream().str(), comp);
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), comp);
 }
 
 TEST(rows, convert_sam_to_blast)
 {
     // TODO when blast format is implemented
 }
+
+// ----------------------------------------------------------------------------
+// compression
+// ----------------------------------------------------------------------------
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST(compression, by_filename_gz)
+{
+    test::tmp_filename filename{"alignment_file_output_test.sam.gz"};
+
+    {
+        alignment_file_output fout{filename.get_path()};
+        alignment_file_output moved_fout{std::move(fout)}; // the compression stream stays valid
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            record<type_list<dna5_vector, std::string>, fields<field::SEQ, field::ID>> r{seqs[i], ids[i]};
+
+            moved_fout.push_back(r);
+        }
+
+        moved_fout.get_stream() << "@CO\tappended through get_stream\n"; // writes to the compression stream
+        EXPECT_TRUE(moved_fout.get_stream().good());
+    }
+
+    std::ifstream fi{filename.get_path(), std::ios::binary};
+    contrib::gz_istream decompressed{fi};
+    std::string buffer{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(buffer, output_comp + "@CO\tappended through get_stream\n");
+}
+#endif
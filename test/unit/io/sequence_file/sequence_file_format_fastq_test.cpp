@@ -184,6 +184,62 @@ TEST_F(read, mixed_issues)
     do_read_test(input);
 }
 
+// A stream buffer that exposes only three characters at a time, such that records span many buffer boundaries.
+struct small_chunk_buffer : public std::streambuf
+{
+    small_chunk_buffer(std::string const & input) : data{input} {}
+
+    int_type underflow() override
+    {
+        if (pos == data.size())
+            return traits_type::eof();
+
+        size_t const n = std::min<size_t>(3, data.size() - pos);
+        setg(data.data() + pos, data.data() + pos, data.data() + pos + n);
+        pos += n;
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::string data;
+    size_t pos{0};
+};
+
+TEST_F(read, small_buffer)
+{
+    input =
+    {
+        "@ID1\n"
+        "ACGTTTTTTTT\nTTTTTTT\n"
+        "+\n"
+        "!##$\n%&'()*+,-./++-\n"
+        "@ID2\r\n"
+        "ACGTTTTTTTTTT\r\nTTTTTT\r\nTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT\r\nTTTTTTTTTTTTTTTTTTTTTTT\r\n"
+        "+\r\n"
+        "!##$&'()*+,-./+)*+,-)*+,-)*+,-)*+,BDEBDEBD\nEBDEB\nDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDE\r\n"
+        "@ID3 lala\n"
+        "ACGTT\nTA\n"
+        "+ID3 lala\n"
+        "!!!!!\n!!"
+    };
+
+    small_chunk_buffer buffer{input};
+    std::istream istream{&buffer};
+
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        id.clear();
+        seq.clear();
+        qual.clear();
+
+        EXPECT_NO_THROW(( format.read(istream, options, seq, id, qual) ));
+
+        EXPECT_TRUE((std::ranges::equal(seq, expected_seqs[i])));
+        EXPECT_TRUE((std::ranges::equal(id, expected_ids[i])));
+        EXPECT_TRUE((std::ranges::equal(qual, expected_quals[i])));
+    }
+    EXPECT_EQ(istream.peek(), std::char_traits<char>::eof());
+}
+
 TEST_F(read, options_truncate_ids)
 {
     input =
@@ -396,6 +396,161 @@ TEST_F(sequence_file_input_f, column_reading_decomposed_temporary)
     }
 }
 
+TEST_F(sequence_file_input_f, batch_reading)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    auto & batch = fin.read_batch(2);
+    auto & seqs = get<field::SEQ>(batch);
+    auto & ids = get<field::ID>(batch);
+    ASSERT_EQ(seqs.size(), 2u);
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_EQ(get<field::QUAL>(batch).size(), 2u);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(seqs[i], seq_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(ids[i],  id_comp[i])));
+    }
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(fin.front()), seq_comp[2]))); // the record behind the batch
+
+    auto & batch2 = fin.read_batch(2); // the same buffer is reused
+    EXPECT_EQ(std::addressof(batch), std::addressof(batch2));
+    ASSERT_EQ(seqs.size(), 1u);
+    EXPECT_TRUE((std::ranges::equal(seqs[0], seq_comp[2])));
+    EXPECT_TRUE((std::ranges::equal(ids[0],  id_comp[2])));
+    EXPECT_EQ(fin.begin(), fin.end());
+
+    EXPECT_TRUE(get<field::SEQ>(fin.read_batch(2)).empty());
+}
+
+TEST_F(sequence_file_input_f, batch_reading_seq_qual)
+{
+    sequence_file_input fin{std::istringstream{input},
+                         sequence_file_format_fasta{},
+                         fields<field::ID, field::SEQ_QUAL>{}};
+
+    auto & batch = fin.read_batch(5);
+    ASSERT_EQ(get<field::SEQ_QUAL>(batch).size(), 3u);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ_QUAL>(batch)[i] | view::convert<dna5>, seq_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(batch)[i], id_comp[i])));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// parallel parsing
+// ----------------------------------------------------------------------------
+
+TEST_F(sequence_file_input_f, parallel_record_reading)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+    fin.options.parsing_threads = 2;
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter])));
+        EXPECT_TRUE(empty(get<field::QUAL>(rec)));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_f, parallel_multiple_chunks)
+{
+    // several megabytes, such that the stream is cut into many chunks
+    std::string fastq_input{};
+    for (size_t i = 0; i < 30000; ++i)
+    {
+        std::string const sequence(50 + i % 150, "ACGTN"[i % 5]);
+        std::string const qualities(sequence.size(), static_cast<char>('!' + i % 40));
+        fastq_input += "@read " + std::to_string(i) + "\n" + sequence + "\n+\n" + qualities + "\n";
+    }
+
+    sequence_file_input fin_serial{std::istringstream{fastq_input}, sequence_file_format_fastq{}};
+    sequence_file_input fin_parallel{std::istringstream{fastq_input}, sequence_file_format_fastq{}};
+    fin_parallel.options.parsing_threads = 4;
+    fin_parallel.options.truncate_ids = true;
+
+    size_t counter = 0;
+    auto it_parallel = fin_parallel.begin();
+    for (auto & rec : fin_serial)
+    {
+        ASSERT_NE(it_parallel, fin_parallel.end());
+        EXPECT_EQ(get<field::ID>(*it_parallel), "read");
+        EXPECT_EQ(get<field::SEQ>(*it_parallel), get<field::SEQ>(rec));
+        EXPECT_EQ(get<field::QUAL>(*it_parallel), get<field::QUAL>(rec));
+
+        ++it_parallel;
+        ++counter;
+    }
+
+    EXPECT_EQ(it_parallel, fin_parallel.end());
+    EXPECT_EQ(counter, 30000u);
+}
+
+TEST_F(sequence_file_input_f, parallel_parse_error)
+{
+    sequence_file_input fin{std::istringstream{input + "> Test4\nACGPT\n" + input}, sequence_file_format_fasta{}};
+    fin.options.parsing_threads = 2;
+
+    auto it = fin.begin();
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(*it), seq_comp[0])));
+    for (size_t i = 1; i < 3; ++i) // the records in front of the error are returned
+    {
+        ++it;
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(*it), seq_comp[i])));
+    }
+
+    EXPECT_THROW(++it, parse_error);
+    ++it; // no records are returned behind the error
+    EXPECT_EQ(it, fin.end());
+}
+
+TEST_F(sequence_file_input_f, parallel_early_destruction)
+{
+    std::string long_input{};
+    for (size_t i = 0; i < 100000; ++i)
+        long_input += input;
+
+    sequence_file_input fin{std::istringstream{long_input}, sequence_file_format_fasta{}};
+    fin.options.parsing_threads = 4;
+
+    auto it = fin.begin();
+    ++it;
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(*it), seq_comp[1])));
+} // the file is destroyed while the threads are still reading
+
+TEST_F(sequence_file_input_f, parallel_move_assignment)
+{
+    std::string long_input{};
+    for (size_t i = 0; i < 100000; ++i)
+        long_input += input;
+
+    sequence_file_input fin{std::istringstream{long_input}, sequence_file_format_fasta{}};
+    fin.options.parsing_threads = 4;
+
+    auto it = fin.begin();
+    ++it;
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(*it), seq_comp[1])));
+
+    // the threads are still reading from the stream that is replaced
+    fin = sequence_file_input{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter])));
+        counter++;
+    }
+    EXPECT_EQ(counter, 3u);
+}
+
 // ----------------------------------------------------------------------------
 // decompression
 // ----------------------------------------------------------------------------
@@ -448,6 +603,47 @@ TEST_F(sequence_file_input_f, decompression_by_stream_gz)
     decompression_impl(*this, fin);
 }
 
+std::string input_bgzf
+{
+    '\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00',
+    '\x4A','\x00','\xB3','\x53','\x08','\x71','\x0D','\x0E','\x51','\x30','\xE4','\x72','\x74','\x76','\x0F','\xE1',
+    '\xB2','\x0B','\x49','\x2D','\x2E','\x31','\xE2','\x72','\x74','\x77','\x77','\x0E','\x71','\xF7','\xE3','\xB2',
+    '\x53','\x00','\xF1','\x8D','\xB9','\xDC','\xDD','\x1D','\xDD','\x43','\x1C','\x43','\x1C','\x1D','\x43','\x50',
+    '\x21','\x17','\x00','\xEF','\x24','\xC2','\xE9','\x3E','\x00','\x00','\x00','\x1F','\x8B','\x08','\x04','\x00',
+    '\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00','\x1B','\x00','\x03','\x00','\x00',
+    '\x00','\x00','\x00','\x00','\x00','\x00','\x00'
+};
+
+TEST_F(sequence_file_input_f, decompression_by_filename_bgzf)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+
+        std::copy(begin(input_bgzf), end(input_bgzf), std::ostreambuf_iterator<char>{of});
+    }
+
+    sequence_file_input fin{filename.get_path()};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_bgzf_threads)
+{
+    sequence_file_input fin{std::istringstream{input_bgzf}, sequence_file_format_fasta{}};
+    fin.options.decompression_threads = 4; // takes effect behind the first record
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_bgzf)
+{
+    sequence_file_input fin{std::istringstream{input_bgzf}, sequence_file_format_fasta{}};
+
+    decompression_impl(*this, fin);
+}
+
 TEST_F(sequence_file_input_f, read_empty_gz_file)
 {
     std::string empty_zipped_file
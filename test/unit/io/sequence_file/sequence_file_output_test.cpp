@@ -452,11 +452,14 @@ TEST(columns, writing_seq_qual)
 // compression
 // ----------------------------------------------------------------------------
 
-void compression_by_filename_impl(test::tmp_filename & filename, std::string_view const expected)
+void compression_by_filename_impl(test::tmp_filename & filename,
+                                  std::string_view const expected,
+                                  size_t const compression_threads = 1)
 {
     {
         sequence_file_output fout{filename.get_path()};
         fout.options.fasta_letters_per_line = 0;
+        fout.options.compression_threads = compression_threads;
 
         for (size_t i = 0; i < 3; ++i)
         {
@@ -502,11 +505,36 @@ std::string expected_gz
     '\x93','\x00','\x00','\x00'
 };
 
+std::string expected_bgzf
+{
+    '\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00',
+    '\x4B','\x00','\xB3','\x53','\x08','\x71','\x0D','\x0E','\x51','\x30','\xE4','\x72','\x74','\x76','\x0F','\xE1',
+    '\xB2','\x53','\x08','\x49','\x2D','\x2E','\x31','\xE2','\x72','\x74','\x77','\x77','\x0E','\x71','\xF7','\xA3',
+    '\x05','\x05','\xB5','\xC3','\x98','\xCB','\xDD','\xDD','\xD1','\x3D','\xC4','\x31','\xC4','\xD1','\x31','\x04',
+    '\x15','\x72','\x01','\x00','\x27','\xAD','\xB4','\xE9','\x93','\x00','\x00','\x00','\x1F','\x8B','\x08','\x04',
+    '\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00','\x1B','\x00','\x03','\x00',
+    '\x00','\x00','\x00','\x00','\x00','\x00','\x00','\x00'
+};
+
 TEST(compression, by_filename_gz)
 {
     test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
 
-    compression_by_filename_impl(filename, expected_gz);
+    compression_by_filename_impl(filename, expected_bgzf); // BGZF is written for GZip, too
+}
+
+TEST(compression, by_filename_bgzf)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.bgzf"};
+
+    compression_by_filename_impl(filename, expected_bgzf);
+}
+
+TEST(compression, by_filename_bgzf_threads)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.bgzf"};
+
+    compression_by_filename_impl(filename, expected_bgzf, 4); // the threads do not change the output
 }
 
 TEST(compression, by_stream_gz)
@@ -520,6 +548,18 @@ TEST(compression, by_stream_gz)
 
     EXPECT_EQ(out.str(), expected_gz);
 }
+
+TEST(compression, by_stream_bgzf)
+{
+    std::ostringstream out;
+
+    {
+        contrib::bgzf_ostream compout{out, 4};
+        compression_by_stream_impl(compout);
+    }
+
+    EXPECT_EQ(out.str(), expected_bgzf);
+}
 #endif
 
 #ifdef SEQAN3_HAS_BZIP2
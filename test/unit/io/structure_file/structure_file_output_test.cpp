@@ -468,10 +468,27 @@ std::string expected_gz
     '\xFC','\x00','\x00','\x00'
 };
 
+std::string expected_bgzf
+{
+    '\x1F','\x8B','\x08','\x04','\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00',
+    '\xAB','\x00','\x55','\x8E','\xC1','\x0A','\xC2','\x40','\x0C','\x44','\xEF','\xF9','\x8A','\x3D','\x76','\x0F',
+    '\x5D','\x5B','\x14','\x7A','\x2B','\x84','\x20','\xF1','\xA2','\x88','\x92','\xB3','\x14','\xD9','\x43','\x41',
+    '\x41','\xB4','\x14','\x3F','\xDF','\x64','\x23','\x52','\x27','\xB0','\x64','\x1E','\x61','\x66','\xFB','\x70',
+    '\x4E','\xD7','\xFC','\xCC','\xF3','\xF8','\x1A','\x87','\x7C','\x99','\x4E','\x07','\xAC','\x8F','\xBB','\x6D',
+    '\xD8','\xB7','\x4D','\xB7','\x69','\x56','\x6D','\xDD','\xAD','\x81','\x89','\x19','\x45','\x04','\x99','\x84',
+    '\x90','\x45','\x58','\xBD','\x0E','\x31','\xA9','\x45','\x12','\x46','\x2C','\x07','\x86','\x59','\x48','\x81',
+    '\x8E','\x90','\x32','\x3D','\xB0','\x13','\x34','\x47','\x08','\x95','\x2B','\x25','\x7F','\x5D','\x51','\xF5',
+    '\x07','\x9C','\x98','\xAA','\x05','\x8E','\x0B','\x25','\xE8','\x43','\x7E','\x0F','\xF7','\xC7','\x2D','\x83',
+    '\xD7','\x0A','\x5A','\x13','\x96','\x6E','\x5B','\x85','\xF4','\x3F','\x04','\xBF','\x08','\xCF','\x29','\xB9',
+    '\xF1','\x1B','\x0F','\x1F','\xA0','\x5A','\xBE','\x54','\xFC','\x00','\x00','\x00','\x1F','\x8B','\x08','\x04',
+    '\x00','\x00','\x00','\x00','\x00','\xFF','\x06','\x00','\x42','\x43','\x02','\x00','\x1B','\x00','\x03','\x00',
+    '\x00','\x00','\x00','\x00','\x00','\x00','\x00','\x00'
+};
+
 TEST_F(structure_file_output_compression, by_filename_gz)
 {
     test::tmp_filename filename{"structure_file_output_test.dbn.gz"};
-    compression_by_filename_impl(filename, expected_gz);
+    compression_by_filename_impl(filename, expected_bgzf); // BGZF is written for GZip, too
 }
 
 TEST_F(structure_file_output_compression, by_stream_gz)
@@ -10,10 +10,15 @@
 
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, fm_index_test, bi_fm_index<std::vector<dna4>>);
 INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection, fm_index_collection_test, bi_fm_index<std::vector<std::vector<dna4>>>);
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, fm_index_test, bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits<dna4>>);
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr_collection, fm_index_collection_test,
+                              bi_fm_index<std::vector<std::vector<dna4>>, bi_fm_index_epr_traits<dna4>>);
 
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(BiFmIndexTraits<bi_fm_index_default_traits>);
+    EXPECT_TRUE(BiFmIndexTraits<bi_fm_index_epr_traits<dna4>>);
+    EXPECT_TRUE(BiFmIndexTraits<bi_fm_index_sampling_traits<4>>);
     EXPECT_TRUE(BiFmIndex<bi_fm_index<std::string>>);
 }
 
@@ -21,3 +26,26 @@ TEST(fm_index_collection_test, additional_concepts)
 {
     EXPECT_TRUE(BiFmIndex<bi_fm_index<std::vector<std::string>>>);
 }
+
+TEST(fm_index_test, load_with_other_traits)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+    test::tmp_filename filename{"index_traits"};
+    bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits<dna4>>{text}.store(filename.get_path());
+
+    bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits<dna4>> same{};
+    EXPECT_NO_THROW(same.load(filename.get_path()));
+    bi_fm_index<std::vector<dna4>> wavelet_tree{};
+    EXPECT_THROW(wavelet_tree.load(filename.get_path()), parse_error);
+    bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits<dna4, 4>> sampling{};
+    EXPECT_THROW(sampling.load(filename.get_path()), parse_error);
+
+    // the traits of the reverse index are checked as well
+    struct mixed_traits
+    {
+        using fm_index_traits = fm_index_epr_traits<dna4>;
+        using rev_fm_index_traits = fm_index_default_traits;
+    };
+    bi_fm_index<std::vector<dna4>, mixed_traits> mixed{};
+    EXPECT_THROW(mixed.load(filename.get_path()), parse_error);
+}
@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <seqan3/search/fm_index/all.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace sdsl;
+
+static std::vector<uint8_t> random_text(size_t const size, uint8_t const sigma)
+{
+    std::mt19937_64 engine{size};
+    std::uniform_int_distribution<unsigned> dist{0, sigma - 1u};
+    std::vector<uint8_t> text(size);
+    for (uint8_t & c : text)
+        c = static_cast<uint8_t>(dist(engine));
+    return text;
+}
+
+static std::vector<size_t> const text_sizes{0, 1, 63, 64, 65, 128, 1000};
+
+TEST(epr_dictionary_test, concepts)
+{
+    using sdsl_index_type = csa_wt<epr_dictionary<6>, 16, 10000000, sa_order_sa_sampling<>, isa_sampling<>,
+                                   plain_byte_alphabet>;
+
+    EXPECT_TRUE(seqan3::detail::SdslIndex<sdsl_index_type>);
+    EXPECT_TRUE(seqan3::detail::is_epr_dictionary_v<epr_dictionary<4>>);
+    EXPECT_FALSE((seqan3::detail::is_epr_dictionary_v<wt_blcd<>>));
+}
+
+TEST(epr_dictionary_test, construction)
+{
+    for (size_t const size : text_sizes)
+    {
+        std::vector<uint8_t> text = random_text(size, 6);
+
+        epr_dictionary<6> dict{text.begin(), text.end()};
+        EXPECT_EQ(dict.size(), size);
+        EXPECT_EQ(dict.empty(), size == 0);
+
+        for (size_t i = 0; i < size; ++i)
+            EXPECT_EQ(dict[i], text[i]);
+    }
+
+    std::vector<uint8_t> text{0, 1, 6};
+    EXPECT_THROW((epr_dictionary<6>{text.begin(), text.end()}), std::invalid_argument);
+}
+
+TEST(epr_dictionary_test, rank)
+{
+    for (size_t const size : text_sizes)
+    {
+        std::vector<uint8_t> text = random_text(size, 6);
+        epr_dictionary<6> dict{text.begin(), text.end()};
+
+        std::array<size_t, 6> expected{};
+        for (size_t i = 0; i <= size; ++i)
+        {
+            std::array<size_t, 6> const all = dict.rank_all(i);
+            for (uint8_t c = 0; c < 6; ++c)
+            {
+                EXPECT_EQ(dict.rank(i, c), expected[c]);
+                EXPECT_EQ(all[c], expected[c]);
+            }
+            EXPECT_EQ(dict.rank(i, 7), 0u);
+
+            if (i < size)
+            {
+                auto [rank, c] = dict.inverse_select(i);
+                EXPECT_EQ(c, text[i]);
+                EXPECT_EQ(rank, expected[text[i]]);
+                ++expected[text[i]];
+            }
+        }
+    }
+}
+
+TEST(epr_dictionary_test, select)
+{
+    for (size_t const size : text_sizes)
+    {
+        std::vector<uint8_t> text = random_text(size, 6);
+        epr_dictionary<6> dict{text.begin(), text.end()};
+
+        std::array<size_t, 6> occurrences{};
+        for (size_t i = 0; i < size; ++i)
+            EXPECT_EQ(dict.select(++occurrences[text[i]], text[i]), i);
+    }
+}
+
+TEST(epr_dictionary_test, lex_count)
+{
+    std::vector<uint8_t> text = random_text(200, 6);
+    epr_dictionary<6> dict{text.begin(), text.end()};
+
+    for (size_t i = 0; i <= text.size(); i += 7)
+    {
+        for (size_t j = i; j <= text.size(); j += 13)
+        {
+            for (uint8_t c = 0; c < 6; ++c)
+            {
+                size_t smaller{0}, greater{0};
+                for (size_t k = i; k < j; ++k)
+                {
+                    smaller += text[k] < c;
+                    greater += text[k] > c;
+                }
+
+                auto [rank, s, g] = dict.lex_count(i, j, c);
+                EXPECT_EQ(rank, dict.rank(i, c));
+                EXPECT_EQ(s, smaller);
+                EXPECT_EQ(g, greater);
+            }
+        }
+    }
+}
+
+TEST(epr_dictionary_test, serialization)
+{
+    std::vector<uint8_t> text = random_text(1000, 4);
+    epr_dictionary<4> dict{text.begin(), text.end()};
+
+    std::stringstream stream{};
+    dict.serialize(stream);
+
+    epr_dictionary<4> loaded{};
+    loaded.load(stream);
+    EXPECT_TRUE(loaded == dict);
+}
@@ -7,11 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <type_traits>
 
 #include <seqan3/core/metafunction/template_inspection.hpp>
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 using namespace seqan3;
 
@@ -114,4 +116,56 @@ TYPED_TEST_P(fm_index_collection_test, serialisation)
     test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text);
+TYPED_TEST_P(fm_index_collection_test, store_load)
+{
+    using inner_text_type = value_type_t<typename TypeParam::text_type>;
+    typename TypeParam::text_type text{inner_text_type(4), inner_text_type(12)};
+
+    TypeParam fm{text};
+    test::tmp_filename filename{"index_store_load"};
+    fm.store(filename.get_path());
+
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_EQ(fm, loaded);
+    EXPECT_EQ(fm.size(), loaded.size());
+    EXPECT_EQ(fm.begin().count(), loaded.begin().count());
+
+    // the file does not exist
+    EXPECT_THROW(loaded.load(filename.get_path().string() + ".missing"), file_open_error);
+
+    // the file does not contain an index
+    {
+        std::ofstream out{filename.get_path()};
+        out << "this is not an index";
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), parse_error);
+}
+
+TYPED_TEST_P(fm_index_collection_test, construction_config)
+{
+    using inner_text_type = value_type_t<typename TypeParam::text_type>;
+    typename TypeParam::text_type text{inner_text_type(4), inner_text_type(12)};
+
+    TypeParam fm{text};
+
+    // in memory with several threads
+    TypeParam fm_parallel{text, fm_index_construction_config{4}};
+    EXPECT_EQ(fm, fm_parallel);
+
+    // a budget of one byte enforces the construction in temporary files
+    test::tmp_filename filename{"index_construction"};
+    std::filesystem::path const tmp_dir = filename.get_path().parent_path();
+    for (size_t thread_count : {1, 2})
+    {
+        TypeParam fm_external{text, fm_index_construction_config{thread_count, 1, tmp_dir}};
+        EXPECT_EQ(fm, fm_external);
+        EXPECT_TRUE(std::filesystem::is_empty(tmp_dir)); // temporary files are removed
+    }
+
+    // the directory for temporary files does not exist
+    EXPECT_THROW((TypeParam{text, fm_index_construction_config{1, 1, tmp_dir / "missing"}}), file_open_error);
+}
+
+REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text,
+                           store_load, construction_config);
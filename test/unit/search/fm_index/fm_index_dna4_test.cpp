@@ -5,15 +5,57 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <array>
+#include <fstream>
+
 #include "fm_index_test_template.hpp"
 #include "fm_index_collection_test_template.hpp"
 
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
+// Checks that two indices over the same text find all strings of length up to 4 at the same positions.
+template <typename index1_t, typename index2_t>
+void expect_same_occurrences(index1_t const & index1, index2_t const & index2)
+{
+    ASSERT_EQ(index1.size(), index2.size());
+
+    for (size_t length = 1; length <= 4; ++length)
+    {
+        std::vector<dna4> query(length);
+        for (size_t kmer = 0; kmer < (1ULL << (2 * length)); ++kmer)
+        {
+            for (size_t i = 0; i < length; ++i)
+                assign_rank_to((kmer >> (2 * (length - 1 - i))) & 3, query[i]);
+
+            auto it1 = index1.begin();
+            auto it2 = index2.begin();
+            bool const found = it1.extend_right(query);
+            ASSERT_EQ(found, it2.extend_right(query));
+            if (found)
+            {
+                auto occ1 = it1.locate();
+                auto occ2 = it2.locate();
+                std::sort(occ1.begin(), occ1.end());
+                std::sort(occ2.begin(), occ2.end());
+                EXPECT_EQ(occ1, occ2);
+            }
+        }
+    }
+}
+
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, fm_index_test, fm_index<std::vector<dna4>>);
 INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection, fm_index_collection_test, fm_index<std::vector<std::vector<dna4>>>);
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, fm_index_test, fm_index<std::vector<dna4>, fm_index_epr_traits<dna4>>);
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr_collection, fm_index_collection_test,
+                              fm_index<std::vector<std::vector<dna4>>, fm_index_epr_traits<dna4>>);
 
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(FmIndexTraits<fm_index_default_traits>);
+    EXPECT_TRUE(FmIndexTraits<fm_index_epr_traits<dna4>>);
+    EXPECT_TRUE(FmIndexTraits<fm_index_sampling_traits<4>>);
     EXPECT_TRUE(FmIndex<fm_index<std::string>>);
 }
 
@@ -21,3 +63,59 @@ TEST(fm_index_collection_test, additional_concepts)
 {
     EXPECT_TRUE(FmIndex<fm_index<std::vector<std::string>>>);
 }
+
+TEST(fm_index_test, bitcompressed_text)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+    bitcompressed_vector<dna4> packed_text{text};
+
+    expect_same_occurrences(fm_index<std::vector<dna4>>{text}, fm_index<bitcompressed_vector<dna4>>{packed_text});
+}
+
+TEST(fm_index_collection_test, bitcompressed_text)
+{
+    std::vector<std::vector<dna4>> text{"ACGTACGTTTAG"_dna4, ""_dna4, "CAGCATTACGCA"_dna4, "ACGGATTACGCC"_dna4};
+    concatenated_sequences<bitcompressed_vector<dna4>> packed_text{};
+    for (auto const & t : text)
+        packed_text.push_back(bitcompressed_vector<dna4>{t});
+
+    expect_same_occurrences(fm_index<std::vector<std::vector<dna4>>>{text},
+                            fm_index<concatenated_sequences<bitcompressed_vector<dna4>>>{packed_text});
+}
+
+TEST(fm_index_test, load_with_other_traits)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+    test::tmp_filename filename{"index_traits"};
+    fm_index<std::vector<dna4>>{text}.store(filename.get_path());
+
+    fm_index<std::vector<dna4>> same{};
+    EXPECT_NO_THROW(same.load(filename.get_path()));
+    fm_index<std::vector<dna4>, fm_index_epr_traits<dna4>> epr{};
+    EXPECT_THROW(epr.load(filename.get_path()), parse_error);
+    fm_index<std::vector<dna4>, fm_index_sampling_traits<4>> sampling{};
+    EXPECT_THROW(sampling.load(filename.get_path()), parse_error);
+    bi_fm_index<std::vector<dna4>> bidirectional{};
+    EXPECT_THROW(bidirectional.load(filename.get_path()), parse_error);
+
+    // the traits are stored as explicit identifiers at fixed offsets of the header
+    std::array<char, 44> header{};
+    {
+        std::ifstream in{filename.get_path(), std::ios::binary};
+        in.read(header.data(), header.size());
+        ASSERT_TRUE(in.good());
+    }
+    EXPECT_EQ(header[17], static_cast<char>(detail::fm_index_file_header::traits_version));
+    EXPECT_EQ(header[20], static_cast<char>(detail::fm_index_rank_structure::wt_blcd));
+    EXPECT_EQ(header[21], static_cast<char>(detail::fm_index_text_layout::plain_byte));
+    uint32_t sa_sampling_rate{};
+    std::copy_n(header.data() + 24, sizeof(sa_sampling_rate), reinterpret_cast<char *>(&sa_sampling_rate));
+    EXPECT_EQ(sa_sampling_rate, 16u);
+    EXPECT_TRUE(std::all_of(header.begin() + 32, header.end(), [] (char const c) { return c == 0; })); // no reverse
+
+    constexpr auto epr_file_traits = detail::fm_index_file_traits_v<fm_index_epr_traits<dna4, 4>::sdsl_index_type>;
+    EXPECT_EQ(epr_file_traits.rank_structure, detail::fm_index_rank_structure::epr_dictionary);
+    EXPECT_EQ(epr_file_traits.text_layout, detail::fm_index_text_layout::plain_byte);
+    EXPECT_EQ(epr_file_traits.sa_sampling_rate, 4u);
+    EXPECT_FALSE(detail::fm_index_file_traits_v<sdsl::csa_wt<>>.is_supported());
+}
@@ -7,11 +7,16 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <optional>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/core/metafunction/template_inspection.hpp>
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 using namespace seqan3;
 
@@ -104,4 +109,112 @@ TYPED_TEST_P(fm_index_test, serialisation)
     test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation);
+TYPED_TEST_P(fm_index_test, store_load)
+{
+    typename TypeParam::text_type text(10);
+
+    TypeParam fm{text};
+    test::tmp_filename filename{"index_store_load"};
+    fm.store(filename.get_path());
+
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_EQ(fm, loaded);
+    EXPECT_EQ(fm.size(), loaded.size());
+    EXPECT_EQ(fm.begin().count(), loaded.begin().count());
+
+    // the file does not exist
+    EXPECT_THROW(loaded.load(filename.get_path().string() + ".missing"), file_open_error);
+
+    // the file does not contain an index
+    {
+        std::ofstream out{filename.get_path()};
+        out << "this is not an index";
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), parse_error);
+}
+
+TYPED_TEST_P(fm_index_test, construction_config)
+{
+    typename TypeParam::text_type text(10);
+
+    TypeParam fm{text};
+
+    // in memory with several threads
+    TypeParam fm_parallel{text, fm_index_construction_config{4}};
+    EXPECT_EQ(fm, fm_parallel);
+
+    // a budget of one byte enforces the construction in temporary files
+    test::tmp_filename filename{"index_construction"};
+    std::filesystem::path const tmp_dir = filename.get_path().parent_path();
+    for (size_t thread_count : {1, 2})
+    {
+        TypeParam fm_external{text, fm_index_construction_config{thread_count, 1, tmp_dir}};
+        EXPECT_EQ(fm, fm_external);
+        EXPECT_TRUE(std::filesystem::is_empty(tmp_dir)); // temporary files are removed
+    }
+
+    // the directory for temporary files does not exist
+    EXPECT_THROW((TypeParam{text, fm_index_construction_config{1, 1, tmp_dir / "missing"}}), file_open_error);
+
+    // a budget between the two estimates keeps the files on disk, but sorts the suffix array in memory
+    {
+        size_t const disk_cache_bytes = detail::fm_index_disk_cache_construction_bytes(text.size());
+        EXPECT_LT(disk_cache_bytes, detail::fm_index_in_memory_construction_bytes(text.size()));
+
+        fm_index_construction_config const config{1, disk_cache_bytes, tmp_dir};
+        EXPECT_EQ(detail::select_sdsl_construction_mode(text.size(), config),
+                  detail::sdsl_construction_mode::disk_cache);
+        EXPECT_EQ(detail::select_sdsl_construction_mode(text.size(), fm_index_construction_config{1, 1, tmp_dir}),
+                  detail::sdsl_construction_mode::semi_external);
+
+        TypeParam fm_disk_cache{text, config};
+        EXPECT_EQ(fm, fm_disk_cache);
+        EXPECT_TRUE(std::filesystem::is_empty(tmp_dir));
+    }
+
+    // the k-mer lookup table is stored with the index
+    TypeParam fm_table{text, fm_index_construction_config{1, 0, {}, 2}};
+    EXPECT_NE(fm, fm_table);
+    test::do_serialisation(fm_table);
+
+    fm_table.store(filename.get_path());
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_EQ(fm_table, loaded);
+
+    // the k-mer lookup table is too large
+    EXPECT_THROW((TypeParam{text, fm_index_construction_config{1, 0, {}, 255}}), std::invalid_argument);
+}
+
+TYPED_TEST_P(fm_index_test, concurrent_construction)
+{
+    typename TypeParam::text_type text(1000);
+
+    TypeParam fm{text};
+
+    // in-memory and external constructions run concurrently and do not interfere with each other
+    test::tmp_filename filename{"concurrent_construction"};
+    std::filesystem::path const tmp_dir = filename.get_path().parent_path();
+    std::vector<std::optional<TypeParam>> indices(8);
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        threads.emplace_back([&, i] ()
+        {
+            fm_index_construction_config const config = (i % 2 == 0) ? fm_index_construction_config{}
+                                                                      : fm_index_construction_config{1, 1, tmp_dir};
+            indices[i].emplace(text, config);
+        });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    for (auto & index : indices)
+        EXPECT_EQ(fm, *index);
+    EXPECT_TRUE(std::filesystem::is_empty(tmp_dir));
+}
+
+REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation, store_load,
+                           construction_config, concurrent_construction);
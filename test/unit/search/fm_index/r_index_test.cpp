@@ -0,0 +1,216 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../helper.hpp"
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+// Checks that an r-index and an FM index over the same text find all strings of length up to 4 at the same positions
+// and enumerate the same children.
+template <typename r_index_t, typename fm_index_t>
+void expect_same_occurrences(r_index_t const & r_index, fm_index_t const & fm_index)
+{
+    ASSERT_EQ(r_index.size(), fm_index.size());
+
+    for (size_t length = 1; length <= 4; ++length)
+    {
+        std::vector<dna4> query(length);
+        for (size_t kmer = 0; kmer < (1ULL << (2 * length)); ++kmer)
+        {
+            for (size_t i = 0; i < length; ++i)
+                assign_rank_to((kmer >> (2 * (length - 1 - i))) & 3, query[i]);
+
+            auto r_it = r_index.begin();
+            auto fm_it = fm_index.begin();
+            bool const found = r_it.extend_right(query);
+            ASSERT_EQ(found, fm_it.extend_right(query));
+            if (!found)
+                continue;
+
+            EXPECT_EQ(r_it.count(), fm_it.count());
+            EXPECT_EQ(uniquify(r_it.locate()), uniquify(fm_it.locate()));
+            EXPECT_TRUE(std::ranges::equal(r_it.locate(), r_it.lazy_locate()));
+
+            bool has_child = r_it.extend_right();
+            ASSERT_EQ(has_child, fm_it.extend_right());
+            while (has_child)
+            {
+                EXPECT_EQ(r_it.last_char(), fm_it.last_char());
+                EXPECT_EQ(uniquify(r_it.locate()), uniquify(fm_it.locate()));
+
+                has_child = r_it.cycle_back();
+                ASSERT_EQ(has_child, fm_it.cycle_back());
+            }
+        }
+    }
+}
+
+TEST(r_index_test, ctr)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+
+    // default/zero construction
+    r_index<std::vector<dna4>> index0;
+    index0.construct(text);
+
+    // copy construction
+    r_index<std::vector<dna4>> index1{index0};
+    EXPECT_EQ(index0, index1);
+
+    // copy assignment
+    r_index<std::vector<dna4>> index2 = index0;
+    EXPECT_EQ(index0, index2);
+
+    // move construction
+    r_index<std::vector<dna4>> index3{std::move(index1)};
+    EXPECT_EQ(index0, index3);
+
+    // move assigment
+    r_index<std::vector<dna4>> index4 = std::move(index2);
+    EXPECT_EQ(index0, index4);
+
+    // container contructor
+    r_index<std::vector<dna4>> index5{text};
+    EXPECT_EQ(index0, index5);
+
+    // copies do not refer to the data structures of the copied index
+    {
+        r_index<std::vector<dna4>> tmp{text};
+        index1 = tmp;
+    }
+    expect_same_occurrences(index1, fm_index<std::vector<dna4>>{text});
+}
+
+TEST(r_index_test, size)
+{
+    r_index<std::vector<dna4>> index;
+    EXPECT_TRUE(index.empty());
+
+    std::vector<dna4> text(8);
+    index.construct(text);
+    EXPECT_EQ(index.size(), 9u); // including a sentinel character
+    EXPECT_EQ(index.runs(), 2u); // the sentinel and the run of 'A'
+}
+
+TEST(r_index_test, concept_check)
+{
+    EXPECT_TRUE(FmIndex<r_index<std::vector<dna4>>>);
+    EXPECT_TRUE(FmIndex<r_index<std::vector<std::vector<dna4>>>>);
+    EXPECT_FALSE(BiFmIndex<r_index<std::vector<dna4>>>);
+    EXPECT_TRUE(FmIndexCursor<r_index_cursor<r_index<std::vector<dna4>>>>);
+}
+
+TEST(r_index_test, empty_text)
+{
+    std::vector<dna4> text{};
+    EXPECT_THROW(r_index<std::vector<dna4>>{text}, std::invalid_argument);
+
+    std::vector<std::vector<dna4>> collection{""_dna4, ""_dna4};
+    EXPECT_THROW(r_index<std::vector<std::vector<dna4>>>{collection}, std::invalid_argument);
+}
+
+TEST(r_index_test, serialisation)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+
+    r_index<std::vector<dna4>> index{text};
+    test::do_serialisation(index);
+}
+
+TEST(r_index_test, construction_config)
+{
+    std::vector<dna4> text{"ACGTACGTTTAGCAGCATTACGCAACGGATTACGCC"_dna4};
+    r_index<std::vector<dna4>> index{text};
+
+    // a budget of one byte enforces the construction in temporary files
+    test::tmp_filename filename{"r_index_construction"};
+    std::filesystem::path const tmp_dir = filename.get_path().parent_path();
+    r_index<std::vector<dna4>> index_external{text, fm_index_construction_config{1, 1, tmp_dir}};
+    EXPECT_EQ(index, index_external);
+    EXPECT_TRUE(std::filesystem::is_empty(tmp_dir)); // temporary files are removed
+
+    // the k-mer lookup table is not supported
+    EXPECT_THROW((r_index<std::vector<dna4>>{text, fm_index_construction_config{1, 0, {}, 2}}),
+                 std::invalid_argument);
+}
+
+TEST(r_index_test, cursor)
+{
+    std::vector<dna4> text{"ACGACG"_dna4};
+    r_index<std::vector<dna4>> index{text};
+
+    r_index_cursor<r_index<std::vector<dna4>>> it{index};
+    EXPECT_EQ(it, index.begin());
+    EXPECT_EQ(it.query_length(), 0u);
+    EXPECT_EQ(it.count(), 7u);
+
+    EXPECT_TRUE(it.extend_right("ACG"_dna4));
+    EXPECT_EQ(it.query_length(), 3u);
+    EXPECT_EQ(uniquify(it.locate()), (std::vector<uint64_t>{0, 3}));
+    EXPECT_TRUE(std::ranges::equal(it.query(), "ACG"_dna4));
+
+    EXPECT_FALSE(it.extend_right("T"_dna4)); // the cursor is not modified
+    EXPECT_EQ(it.query_length(), 3u);
+
+    EXPECT_FALSE(it.cycle_back()); // "ACG" is the only child of "AC"
+    EXPECT_TRUE(std::ranges::equal(it.query(), "ACG"_dna4));
+
+    it = index.begin();
+    EXPECT_TRUE(it.extend_right());
+    EXPECT_EQ(it.last_char(), 'A'_dna4);
+    EXPECT_TRUE(it.cycle_back());
+    EXPECT_EQ(it.last_char(), 'C'_dna4);
+    EXPECT_EQ(uniquify(it.locate()), (std::vector<uint64_t>{1, 4}));
+    EXPECT_TRUE(it.cycle_back());
+    EXPECT_EQ(it.last_char(), 'G'_dna4);
+    EXPECT_FALSE(it.cycle_back());
+    EXPECT_FALSE(it.extend_right('T'_dna4));
+    EXPECT_TRUE(it.extend_right('A'_dna4));
+    EXPECT_EQ(uniquify(it.locate()), (std::vector<uint64_t>{2}));
+}
+
+TEST(r_index_test, same_occurrences)
+{
+    std::vector<dna4> text{};
+    random_text(text, 2000);
+    expect_same_occurrences(r_index<std::vector<dna4>>{text}, fm_index<std::vector<dna4>>{text});
+
+    // a repetitive text has few runs
+    std::vector<dna4> repetitive_text{};
+    for (size_t i = 0; i < 50; ++i)
+        repetitive_text.insert(repetitive_text.end(), text.begin(), text.begin() + 40);
+    repetitive_text[1000] = 'T'_dna4;
+
+    r_index<std::vector<dna4>> repetitive_index{repetitive_text};
+    EXPECT_LT(repetitive_index.runs() * 10, repetitive_index.size());
+    expect_same_occurrences(repetitive_index, fm_index<std::vector<dna4>>{repetitive_text});
+}
+
+TEST(r_index_collection_test, same_occurrences)
+{
+    std::vector<std::vector<dna4>> text{"ACGTACGTTTAG"_dna4, ""_dna4, "CAGCATTACGCA"_dna4, "ACGGATTACGCC"_dna4,
+                                        "ACGTACGTTTAG"_dna4};
+
+    r_index<std::vector<std::vector<dna4>>> index{text};
+    fm_index<std::vector<std::vector<dna4>>> fm{text};
+    expect_same_occurrences(index, fm);
+
+    auto it = index.begin();
+    EXPECT_TRUE(it.extend_right("ACGT"_dna4));
+    EXPECT_EQ(uniquify(it.locate()), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 0}, {0, 4}, {4, 0}, {4, 4}}));
+    EXPECT_TRUE(std::ranges::equal(it.query(), "ACGT"_dna4));
+}
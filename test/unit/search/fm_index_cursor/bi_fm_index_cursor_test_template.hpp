@@ -228,5 +228,53 @@ TYPED_TEST_P(bi_fm_index_cursor_test, to_rev_cursor)
     }
 }
 
+TYPED_TEST_P(bi_fm_index_cursor_test, kmer_lookup_table)
+{
+    typename TypeParam::index_type::text_type text{"ACGGTAGGACGTAGCCATTG"_dna4};
+    typename TypeParam::index_type bi_fm{text};
+    typename TypeParam::index_type bi_fm_table{text, fm_index_construction_config{1, 0, {}, 3}};
+
+    // all queries of length 1 to 5 must behave like without the table
+    for (size_t length = 1; length <= 5; ++length)
+    {
+        std::vector<dna4> query(length);
+        for (size_t kmer = 0; kmer < (1ULL << (2 * length)); ++kmer)
+        {
+            for (size_t i = 0; i < length; ++i)
+                assign_rank_to((kmer >> (2 * (length - 1 - i))) & 3, query[i]);
+
+            TypeParam it(bi_fm), it_table(bi_fm_table);
+            bool const found_right = it.extend_right(query);
+            ASSERT_EQ(found_right, it_table.extend_right(query));
+            if (found_right)
+            {
+                EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+                // both intervals have to be set: extend the other direction afterwards
+                EXPECT_EQ(it.extend_left(), it_table.extend_left());
+                EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+            }
+
+            it = TypeParam(bi_fm);
+            it_table = TypeParam(bi_fm_table);
+            bool const found_left = it.extend_left(query);
+            ASSERT_EQ(found_left, it_table.extend_left(query));
+            ASSERT_EQ(found_left, found_right);
+            if (found_left)
+            {
+                EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+
+                // the parent node has to be restored correctly
+                bool const cycled = it.cycle_front();
+                ASSERT_EQ(cycled, it_table.cycle_front());
+                if (cycled)
+                    EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+
+                EXPECT_EQ(it.extend_right(), it_table.extend_right());
+                EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+            }
+        }
+    }
+}
+
 REGISTER_TYPED_TEST_CASE_P(bi_fm_index_cursor_test, begin, extend, extend_char, extend_range, extend_and_cycle,
-                           extend_range_and_cycle, to_fwd_cursor, to_rev_cursor);
+                           extend_range_and_cycle, to_fwd_cursor, to_rev_cursor, kmer_lookup_table);
@@ -325,6 +325,19 @@ TYPED_TEST_P(fm_index_cursor_collection_test, lazy_locate)
     it.extend_right("ACG"_dna4);
 
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
+
+    // several batches of occurrences are located in lockstep and assigned to their texts
+    typename TypeParam::index_type::text_type long_text(5);
+    for (auto & t : long_text)
+        random_text(t, 400);
+    typename TypeParam::index_type long_fm{long_text};
+
+    for (auto const & query : {"A"_dna4, "CG"_dna4})
+    {
+        TypeParam long_it = TypeParam(long_fm);
+        long_it.extend_right(query);
+        EXPECT_TRUE(std::ranges::equal(long_it.locate(), long_it.lazy_locate()));
+    }
 }
 
 TYPED_TEST_P(fm_index_cursor_collection_test, concept_check)
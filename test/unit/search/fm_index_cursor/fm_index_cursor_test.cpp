@@ -18,3 +18,15 @@ INSTANTIATE_TYPED_TEST_CASE_P(bi_default_traits, fm_index_cursor_test, it_t3);
 
 using it_t4 = bi_fm_index_cursor<bi_fm_index<std::vector<dna4>, bi_fm_index_byte_alphabet_traits>>;
 INSTANTIATE_TYPED_TEST_CASE_P(bi_byte_alphabet_traits, fm_index_cursor_test, it_t4);
+
+using it_t5 = fm_index_cursor<fm_index<std::vector<dna4>, fm_index_epr_traits<dna4>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(epr_traits, fm_index_cursor_test, it_t5);
+
+using it_t6 = bi_fm_index_cursor<bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits<dna4>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_epr_traits, fm_index_cursor_test, it_t6);
+
+using it_t7 = fm_index_cursor<fm_index<std::vector<dna4>, fm_index_sampling_traits<1>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(sampling_traits, fm_index_cursor_test, it_t7);
+
+using it_t8 = bi_fm_index_cursor<bi_fm_index<std::vector<dna4>, bi_fm_index_sampling_traits<64>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_sampling_traits, fm_index_cursor_test, it_t8);
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <optional>
 #include <type_traits>
 
 #include "../helper.hpp"
@@ -294,6 +295,111 @@ TYPED_TEST_P(fm_index_cursor_test, lazy_locate)
     it.extend_right("ACG"_dna4);
 
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
+
+    // several batches of occurrences are located in lockstep
+    typename TypeParam::index_type::text_type long_text{};
+    random_text(long_text, 2000);
+    typename TypeParam::index_type long_fm{long_text};
+
+    for (auto const & query : {""_dna4, "A"_dna4, "CG"_dna4})
+    {
+        TypeParam long_it = TypeParam(long_fm);
+        long_it.extend_right(query);
+        EXPECT_TRUE(std::ranges::equal(long_it.locate(), long_it.lazy_locate()));
+    }
+}
+
+TYPED_TEST_P(fm_index_cursor_test, kmer_lookup_table)
+{
+    typename TypeParam::index_type::text_type text{"ACGAACGCTTAGACGTGCAA"_dna4};
+    typename TypeParam::index_type fm{text};
+    typename TypeParam::index_type fm_table{text, fm_index_construction_config{1, 0, {}, 3}};
+    EXPECT_NE(fm, fm_table);
+
+    // all queries of length 1 to 5 must behave like without the table (lookups of length 1 to 3 and longer ones)
+    for (size_t length = 1; length <= 5; ++length)
+    {
+        std::vector<dna4> query(length);
+        for (size_t kmer = 0; kmer < (1ULL << (2 * length)); ++kmer)
+        {
+            for (size_t i = 0; i < length; ++i)
+                assign_rank_to((kmer >> (2 * (length - 1 - i))) & 3, query[i]);
+
+            TypeParam it(fm);
+            TypeParam it_table(fm_table);
+            bool const found = it.extend_right(query);
+            ASSERT_EQ(found, it_table.extend_right(query));
+            if (!found)
+            {
+                EXPECT_EQ(it_table.query_length(), 0u);
+                continue;
+            }
+
+            EXPECT_EQ(it_table.query_length(), length);
+            EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+
+            // the parent node has to be restored correctly
+            bool const cycled = it.cycle_back();
+            ASSERT_EQ(cycled, it_table.cycle_back());
+            if (cycled)
+                EXPECT_EQ(uniquify(it.locate()), uniquify(it_table.locate()));
+        }
+    }
+}
+
+TYPED_TEST_P(fm_index_cursor_test, search_batch)
+{
+    using index_t = typename TypeParam::index_type;
+
+    typename index_t::text_type text{};
+    random_text(text, 2000);
+    index_t fm{text};
+    index_t fm_table{text, fm_index_construction_config{1, 0, {}, 4}};
+
+    // more queries than are searched at the same time, substrings of the text and (mostly) absent random strings
+    std::vector<std::vector<dna4>> queries{{}};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        size_t const length = std::rand() % 30;
+        if (i % 2 == 0)
+        {
+            size_t const begin = std::rand() % (text.size() - length);
+            queries.emplace_back(text.begin() + begin, text.begin() + begin + length);
+        }
+        else
+        {
+            random_text(queries.emplace_back(), length);
+        }
+    }
+
+    for (index_t const * index : {&fm, &fm_table})
+    {
+        std::vector<std::optional<TypeParam>> const cursors = index->search_batch(queries);
+        ASSERT_EQ(cursors.size(), queries.size());
+
+        size_t found{0};
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            TypeParam it(*index);
+            ASSERT_EQ(it.extend_right(queries[i]), cursors[i].has_value());
+            if (!cursors[i])
+                continue;
+
+            ++found;
+            EXPECT_EQ(cursors[i]->query_length(), queries[i].size());
+            EXPECT_EQ(uniquify(cursors[i]->locate()), uniquify(it.locate()));
+        }
+
+        // the callback is invoked once for every query that occurs
+        std::vector<size_t> reported{};
+        index->search_batch(queries, [&] (size_t const query_id, TypeParam const & cursor)
+        {
+            reported.push_back(query_id);
+            EXPECT_EQ(cursor.query_length(), queries[query_id].size());
+        });
+        EXPECT_EQ(reported.size(), found);
+        EXPECT_EQ(uniquify(reported).size(), found);
+    }
 }
 
 TYPED_TEST_P(fm_index_cursor_test, concept_check)
@@ -303,4 +409,4 @@ TYPED_TEST_P(fm_index_cursor_test, concept_check)
 
 REGISTER_TYPED_TEST_CASE_P(fm_index_cursor_test, ctr, begin, extend_right_range, extend_right_char,
                            extend_right_range_and_cycle, extend_right_char_and_cycle, extend_right_and_cycle, query,
-                           incomplete_alphabet, lazy_locate, concept_check);
+                           incomplete_alphabet, lazy_locate, kmer_lookup_table, search_batch, concept_check);
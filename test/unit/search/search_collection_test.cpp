@@ -123,6 +123,20 @@ TYPED_TEST(search_test, multiple_queries)
                                                                           {{0, 0}, {0, 4}, {1, 0}, {1, 4}}}));
 }
 
+TYPED_TEST(search_test, in_text_verification)
+{
+    // Verified hits do not cross the borders of the texts.
+    std::vector<std::vector<dna4>> const queries{{"ACGT"_dna4, "CCGT"_dna4, "GTACA"_dna4, "TACGTA"_dna4}};
+
+    for (uint8_t errors : {1, 2})
+    {
+        configuration const cfg = max_error{total{errors}};
+        auto const expected = search(this->index, queries, cfg);
+        for (uint64_t threshold : {1u, 4u, 100u})
+            EXPECT_EQ(search(this->index, queries, cfg | in_text_verification{threshold}), expected);
+    }
+}
+
 TYPED_TEST(search_string_test, error_free_string)
 {
     using result_t = std::pair<typename TypeParam::size_type, typename TypeParam::size_type>;
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <functional>
 #include <type_traits>
 
 #include <seqan3/search/algorithm/all.hpp>
@@ -20,7 +21,10 @@ class search_configuration_test : public ::testing::Test
 using test_types = ::testing::Types<search_cfg::max_error_rate<>,
                                     search_cfg::max_error<>,
                                     search_cfg::mode<detail::search_mode_best>,
-                                    search_cfg::output<detail::search_output_text_position>>;
+                                    search_cfg::output<detail::search_output_text_position>,
+                                    search_cfg::parallel,
+                                    search_cfg::in_text_verification,
+                                    search_cfg::on_hit<std::function<void(size_t, size_t)>>>;
 
 TYPED_TEST_CASE(search_configuration_test, test_types);
 
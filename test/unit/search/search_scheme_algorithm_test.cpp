@@ -312,4 +312,97 @@ TEST(search_scheme_test, search_scheme_edit)
     test_search_scheme_edit(detail::optimum_search_scheme<0, 3>, seed, SEQAN3_SEARCH_TEST_ITERATIONS);
 }
 
+TEST(search_scheme_test, computed_search_scheme_edit)
+{
+    time_t seed = std::time(nullptr);
+    std::srand(seed);
+
+    dna4_vector text, query;
+    random_text(text, 1000);
+    bi_fm_index index(text);
+
+    for (uint8_t max_error : {4, 5})
+    {
+        auto const search_scheme = detail::compute_ss(0, max_error);
+        detail::search_param const error_left{max_error, max_error, max_error, max_error};
+
+        for (uint64_t query_length = max_error + 1; query_length < 24; query_length += 3)
+        {
+            // Take the query from the text such that there are hits for every number of errors.
+            uint64_t const begin_pos = std::rand() % (text.size() - query_length);
+            query.assign(text.begin() + begin_pos, text.begin() + begin_pos + query_length);
+            for (uint8_t e = 0; e < max_error / 2; ++e)
+                assign_rank_to(std::rand() % 4, query[std::rand() % query_length]);
+
+            std::vector<uint64_t> hits_trivial, hits_ss;
+            detail::search_ss<false>(index, query, error_left, search_scheme, [&hits_ss] (auto const & it)
+            {
+                auto const & hits_tmp = it.locate();
+                hits_ss.insert(hits_ss.end(), hits_tmp.begin(), hits_tmp.end());
+            });
+            detail::search_trivial<false>(index, query, error_left, [&hits_trivial] (auto const & it)
+            {
+                auto const & hits_tmp = it.locate();
+                hits_trivial.insert(hits_trivial.end(), hits_tmp.begin(), hits_tmp.end());
+            });
+
+            EXPECT_EQ(uniquify(hits_ss), uniquify(hits_trivial)) << "Seed: " << seed;
+        }
+    }
+}
+
+template <typename index_t>
+inline void test_search_error_levels(time_t const seed)
+{
+    dna4_vector text, query;
+    random_text(text, 1000);
+    index_t index(text);
+
+    auto locate_into = [] (std::vector<uint64_t> & hits)
+    {
+        return [&hits] (auto const & it)
+        {
+            auto const & hits_tmp = it.locate();
+            hits.insert(hits.end(), hits_tmp.begin(), hits_tmp.end());
+        };
+    };
+
+    for (uint8_t max_error : {1, 2, 3, 4})
+    {
+        // Hamming distance and edit distance.
+        for (detail::search_param const error_left : {detail::search_param{max_error, max_error, 0, 0},
+                                                      detail::search_param{max_error, max_error, max_error, max_error}})
+        {
+            for (uint64_t query_length = max_error + 1; query_length < 16; query_length += 2)
+            {
+                uint64_t const begin_pos = std::rand() % (text.size() - query_length);
+                query.assign(text.begin() + begin_pos, text.begin() + begin_pos + query_length);
+                assign_rank_to(std::rand() % 4, query[std::rand() % query_length]);
+
+                std::vector<uint64_t> hits_all, hits_levels;
+                detail::search_algo<false>(index, query, 0, error_left, locate_into(hits_all));
+
+                // Searching each error level with equal lower and upper bounds finds the same hits.
+                detail::search_param error_left2{error_left};
+                for (uint8_t e = 0; e <= max_error; ++e)
+                {
+                    error_left2.total = e;
+                    detail::search_algo<false>(index, query, e, error_left2, locate_into(hits_levels));
+                }
+
+                EXPECT_EQ(uniquify(hits_levels), uniquify(hits_all)) << "Seed: " << seed;
+            }
+        }
+    }
+}
+
+TEST(search_scheme_test, error_levels)
+{
+    time_t seed = std::time(nullptr);
+    std::srand(seed);
+
+    test_search_error_levels<fm_index<dna4_vector>>(seed);
+    test_search_error_levels<bi_fm_index<dna4_vector>>(seed);
+}
+
 #undef SEQAN3_SEARCH_TEST_ITERATIONS
@@ -138,3 +138,26 @@ TEST(search_scheme_test, error_distribution_disjoint_optimum_search_schemes)
     ret = check_disjoint_search_scheme<0, 3, false>();
     EXPECT_TRUE(ret);
 }
+
+TEST(search_scheme_test, computed_search_schemes)
+{
+    for (uint8_t max_error = 0; max_error < 9; ++max_error)
+    {
+        auto const & ss{detail::compute_ss(0, max_error)};
+        EXPECT_EQ(ss.size(), max_error + 1u);
+
+        std::vector<std::vector<uint8_t> > error_distributions;
+        search_scheme_error_distribution(error_distributions, ss);
+        uint64_t const size = error_distributions.size();
+        std::sort(error_distributions.begin(), error_distributions.end());
+        error_distributions.erase(std::unique(error_distributions.begin(), error_distributions.end()),
+                                  error_distributions.end());
+        EXPECT_EQ(size, error_distributions.size()); // searches are disjoint
+
+        for (auto const & search : ss)
+        {
+            EXPECT_EQ(search.blocks(), max_error + 1u);
+            EXPECT_EQ(search.u.front(), 0u); // every search starts with an exact block
+        }
+    }
+}
@@ -6,11 +6,13 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <mutex>
 #include <type_traits>
 
 #include "helper.hpp"
 
 #include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/search/fm_index/r_index.hpp>
 
 #include <gtest/gtest.h>
 
@@ -34,8 +36,9 @@ public:
     T index{text};
 };
 
-using fm_index_types        = ::testing::Types<fm_index<std::vector<dna4>>, bi_fm_index<std::vector<dna4>>>;
-using fm_index_string_types = ::testing::Types<fm_index<std::string>, bi_fm_index<std::string>>;
+using fm_index_types        = ::testing::Types<fm_index<std::vector<dna4>>, bi_fm_index<std::vector<dna4>>,
+                                               r_index<std::vector<dna4>>>;
+using fm_index_string_types = ::testing::Types<fm_index<std::string>, bi_fm_index<std::string>, r_index<std::string>>;
 
 TYPED_TEST_CASE(search_test, fm_index_types);
 TYPED_TEST_CASE(search_string_test, fm_index_string_types);
@@ -109,6 +112,182 @@ TYPED_TEST(search_test, multiple_queries)
     EXPECT_EQ(uniquify(search(this->index, queries, cfg)), (hits_result_t{{}, {0}, {0, 4}})); // 0, 1 and 2 hits
 }
 
+TYPED_TEST(search_test, parallel)
+{
+    using hits_result_t = std::vector<std::vector<typename TypeParam::size_type>>;
+    std::vector<std::vector<dna4>> const patterns{{"ACGTA"_dna4, "GG"_dna4, "CCGT"_dna4, "ACGTACGTACGT"_dna4,
+                                                   "TTTT"_dna4}};
+    std::vector<std::vector<dna4>> queries{};
+    for (size_t i = 0; i < 100; ++i)
+        queries.push_back(patterns[i % patterns.size()]);
+
+    for (uint32_t threads : {0u, 1u, 4u, 200u})
+    {
+        configuration const cfg = max_error{total{1}};
+        hits_result_t expected = uniquify(search(this->index, queries, cfg));
+        EXPECT_EQ(uniquify(search(this->index, queries, cfg | search_cfg::parallel{threads})), expected);
+    }
+
+    {   // every query is written into its own slot
+        configuration const cfg = max_error{total{0}} | search_cfg::parallel{4};
+        std::vector<std::vector<dna4>> const three_queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4}};
+        EXPECT_EQ(uniquify(search(this->index, three_queries, cfg)), (hits_result_t{{}, {0}, {0, 4}}));
+    }
+
+    {   // empty range of queries
+        std::vector<std::vector<dna4>> const no_queries{};
+        EXPECT_TRUE(search(this->index, no_queries, max_error{total{0}} | search_cfg::parallel{4}).empty());
+    }
+}
+
+TYPED_TEST(search_test, on_hit)
+{
+    using hits_result_t = std::vector<std::vector<typename TypeParam::size_type>>;
+    std::vector<std::vector<dna4>> const queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4, "CGTA"_dna4}};
+
+    {   // a range of queries
+        configuration const cfg = max_error{total{1}};
+        hits_result_t hits(queries.size());
+        search(this->index, queries, cfg | search_cfg::on_hit{[&] (size_t const id, auto const pos)
+        {
+            hits[id].push_back(pos);
+        }});
+        EXPECT_EQ(uniquify(hits), uniquify(search(this->index, queries, cfg)));
+    }
+
+    {   // a single query
+        configuration const cfg = max_error{total{0}};
+        std::vector<typename TypeParam::size_type> hits{};
+        search(this->index, "ACGT"_dna4, cfg | search_cfg::on_hit{[&] (size_t const id, auto const pos)
+        {
+            EXPECT_EQ(id, 0u);
+            hits.push_back(pos);
+        }});
+        EXPECT_EQ(uniquify(hits), (std::vector<typename TypeParam::size_type>{0, 4, 8}));
+    }
+
+    {   // combined with parallel, the callback is invoked concurrently
+        std::vector<std::vector<dna4>> many_queries{};
+        for (size_t i = 0; i < 100; ++i)
+            many_queries.push_back(queries[i % queries.size()]);
+
+        configuration const cfg = max_error{total{1}};
+        std::mutex hits_mutex{};
+        hits_result_t hits(many_queries.size());
+        auto collect = [&] (size_t const id, auto const pos)
+        {
+            std::lock_guard lock{hits_mutex};
+            hits[id].push_back(pos);
+        };
+        search(this->index, many_queries, cfg | search_cfg::parallel{4} | search_cfg::on_hit{collect});
+        EXPECT_EQ(uniquify(hits), uniquify(search(this->index, many_queries, cfg)));
+    }
+
+    {   // cursors are reported if requested
+        configuration const cfg = max_error{total{0}} | output{index_cursor};
+        size_t count = 0;
+        search(this->index, queries, cfg | search_cfg::on_hit{[&] (size_t, auto const & cursor)
+        {
+            count += cursor.count();
+        }});
+        EXPECT_EQ(count, 0u + 1u + 2u + 2u);
+    }
+}
+
+TYPED_TEST(search_test, unique_hits)
+{
+    // With many errors on a repetitive text the same text position is reached by several cursors.
+    // Every text position must be reported once, the hits are sorted and equal the positions of the cursors.
+    auto locate_cursors = [this] (auto const & query, auto const & cfg)
+    {
+        std::vector<typename TypeParam::size_type> positions{};
+        for (auto const & cursor : search(this->index, query, cfg | output{index_cursor}))
+            for (auto const & pos : cursor.locate())
+                positions.push_back(pos);
+        return uniquify(positions);
+    };
+
+    for (uint8_t errors : {1, 2})
+    {
+        configuration const cfg = max_error{total{errors}};
+        for (auto const & query : {"ACGT"_dna4, "CGTAC"_dna4, "TTT"_dna4})
+        {
+            auto hits = search(this->index, query, cfg);
+            EXPECT_TRUE(std::is_sorted(hits.begin(), hits.end()));
+            EXPECT_EQ(hits, uniquify(hits));
+            EXPECT_EQ(hits, locate_cursors(query, cfg));
+        }
+
+        std::vector<std::vector<dna4>> const queries{{"ACGT"_dna4, "CGTAC"_dna4, "TTT"_dna4}};
+        auto const all_hits = search(this->index, queries, cfg);
+        ASSERT_EQ(all_hits.size(), queries.size());
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            EXPECT_TRUE(std::is_sorted(all_hits[i].begin(), all_hits[i].end()));
+            EXPECT_EQ(all_hits[i], uniquify(all_hits[i]));
+            EXPECT_EQ(all_hits[i], locate_cursors(queries[i], cfg));
+        }
+    }
+}
+
+TYPED_TEST(search_test, in_text_verification)
+{
+    // The hits do not depend on the number of occurrences at which the search switches to the text.
+    std::vector<std::vector<dna4>> const queries{{"ACGT"_dna4, "CCGT"_dna4, "CGTACGT"_dna4, "AGTAGTAC"_dna4,
+                                                  "TTT"_dna4, "GTACA"_dna4, "ACGTACGTACGT"_dna4}};
+
+    for (uint8_t errors : {0, 1, 2, 3})
+    {
+        configuration const cfg = max_error{total{errors}};
+        auto const expected = search(this->index, queries, cfg);
+        for (uint64_t threshold : {0u, 1u, 2u, 3u, 100u})
+            EXPECT_EQ(search(this->index, queries, cfg | in_text_verification{threshold}), expected);
+    }
+
+    {   // restricted error types and other modes are searched in the index only
+        configuration const cfg = max_error{total{2}, substitution{1}};
+        EXPECT_EQ(search(this->index, queries, cfg | in_text_verification{100}), search(this->index, queries, cfg));
+        configuration const cfg2 = max_error{total{1}} | mode{all_best};
+        EXPECT_EQ(search(this->index, queries, cfg2 | in_text_verification{100}), search(this->index, queries, cfg2));
+    }
+}
+
+TEST(search_in_text_verification, bi_fm_index_with_errors)
+{
+    // On a text without repeats the search schemes reach rare infixes long before the end of the query.
+    std::vector<dna4> text(2000);
+    uint32_t state = 42;
+    for (dna4 & c : text)
+    {
+        state = state * 1103515245u + 12345u;
+        c.assign_rank((state >> 16) % 4);
+    }
+    bi_fm_index<std::vector<dna4>> index{text};
+
+    std::vector<std::vector<dna4>> queries{{text.begin() + 100, text.begin() + 130},
+                                           {text.begin() + 500, text.begin() + 525},
+                                           {text.begin() + 1000, text.begin() + 1030}};
+    queries[0][10] = (queries[0][10] == 'A'_dna4) ? 'C'_dna4 : 'A'_dna4; // substitution
+    queries[2].erase(queries[2].begin() + 15);                          // deletion
+
+    for (uint8_t errors : {1, 2, 3})
+    {
+        configuration const cfg = max_error{total{errors}};
+        auto const expected = search(index, queries, cfg);
+        for (uint64_t threshold : {1u, 4u, 100u})
+        {
+            auto const verified = search(index, queries, cfg | in_text_verification{threshold});
+            ASSERT_EQ(verified.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                EXPECT_FALSE(expected[i].empty());
+                EXPECT_EQ(verified[i].size(), expected[i].size());
+            }
+            EXPECT_EQ(verified, expected);
+        }
+    }
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     configuration const cfg = max_error{total{0}, substitution{1}};